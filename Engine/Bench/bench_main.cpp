@@ -0,0 +1,1103 @@
+#include "../Core/ComponentReflection.h"
+#include "../Core/Components.h"
+#include "../Core/Logger.h"
+#include "../Core/Platform/AsyncIo.h"
+#include "../Core/Platform/FileSystem.h"
+#include "../Core/Platform/Vfs.h"
+#include "../Core/Scene.h"
+#include "../Editor/Asset/DerivedDataCache.h"
+#include "../Editor/Asset/ImportPipeline.h"
+#include "../Graphics/Culling/FrustumCuller.h"
+#include "../Graphics/MeshFile.h"
+#include "../Graphics/MeshLibrary.h"
+#include "../Graphics/MeshLod.h"
+#include "../Graphics/MeshOptimizer.h"
+#include "../Graphics/ObjImporter.h"
+#include "../Physics/PhysicsSystem.h"
+#include "../UI/RexUI/App/RexUIEngine.h"
+#include "../UI/RexUI/Widgets/Basic/ButtonWidget.h"
+#include "../UI/RexUI/Widgets/Basic/PanelWidget.h"
+#include "../UI/RexUI/Widgets/Basic/TextWidget.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// rex-bench: deterministic, headless performance scenarios.
+//
+// Every scenario builds its data from fixed seeds, runs a warm-up pass and then
+// times a fixed number of samples. Results are written as JSON and can be
+// compared against a previous run (`--baseline`) with a relative tolerance;
+// any scenario whose median got slower than that fails the run.
+
+namespace {
+
+using namespace rex;
+using BenchClock = std::chrono::steady_clock;
+
+constexpr float DEG2RAD = 0.01745329251994329577f;
+
+// xorshift64*: same sequence on every platform and standard library.
+class BenchRng {
+public:
+    explicit BenchRng(uint64_t seed)
+        : m_state(seed ? seed : 0x9e3779b97f4a7c15ull) {}
+
+    uint64_t next() {
+        m_state ^= m_state >> 12;
+        m_state ^= m_state << 25;
+        m_state ^= m_state >> 27;
+        return m_state * 0x2545f4914f6cdd1dull;
+    }
+
+    uint32_t below(uint32_t bound) {
+        return static_cast<uint32_t>((next() >> 32) % bound);
+    }
+
+    float unit() {
+        return static_cast<float>(next() >> 40) / static_cast<float>(1ull << 24);
+    }
+
+private:
+    uint64_t m_state;
+};
+
+struct SampleSummary {
+    double min = 0.0;
+    double median = 0.0;
+    double p95 = 0.0;
+    double max = 0.0;
+    double mean = 0.0;
+};
+
+SampleSummary summarize(std::vector<double> samples) {
+    SampleSummary out{};
+    if (samples.empty()) return out;
+    std::sort(samples.begin(), samples.end());
+    const auto at = [&](double p) {
+        const auto index = static_cast<std::size_t>(std::ceil(p * static_cast<double>(samples.size())));
+        return samples[std::min(samples.size() - 1, index > 0 ? index - 1 : 0)];
+    };
+    out.min = samples.front();
+    out.max = samples.back();
+    out.median = at(0.5);
+    out.p95 = at(0.95);
+    double sum = 0.0;
+    for (double s : samples) sum += s;
+    out.mean = sum / static_cast<double>(samples.size());
+    return out;
+}
+
+struct BenchResult {
+    std::string name;
+    std::vector<double> samplesMs;
+    std::vector<std::pair<std::string, double>> counters;
+
+    void counter(std::string key, double value) {
+        counters.emplace_back(std::move(key), value);
+    }
+};
+
+// Runs `fn` once untimed, then `samples` timed times.
+template <typename Fn>
+void measure(BenchResult& result, int samples, Fn&& fn) {
+    fn();
+    result.samplesMs.reserve(result.samplesMs.size() + static_cast<std::size_t>(samples));
+    for (int i = 0; i < samples; ++i) {
+        const auto begin = BenchClock::now();
+        fn();
+        result.samplesMs.push_back(std::chrono::duration<double, std::milli>(BenchClock::now() - begin).count());
+    }
+}
+
+struct Scenario {
+    const char* name;
+    const char* description;
+    std::function<void(BenchResult&, double scale)> run;
+};
+
+// --- ECS -------------------------------------------------------------------
+
+struct Velocity {
+    Vec3 value{0, 0, 0};
+};
+
+void benchEcsChurn(BenchResult& result, double scale) {
+    const int liveTarget = std::max(1000, static_cast<int>(50000 * scale));
+    const int churnPerSample = liveTarget / 5;
+
+    core::ecs::World world;
+    BenchRng rng(0xC0FFEEull);
+    std::vector<EntityId> live;
+    live.reserve(static_cast<std::size_t>(liveTarget));
+
+    const auto spawn = [&] {
+        const EntityId id = world.createEntity();
+        world.addComponent<Transform>(id, Transform{{rng.unit() * 100.0f, 0.0f, rng.unit() * 100.0f}});
+        world.addComponent<Velocity>(id, Velocity{{rng.unit(), 0.0f, rng.unit()}});
+        if (rng.below(4) == 0) world.addComponent<MeshRenderer>(id);
+        live.push_back(id);
+    };
+
+    for (int i = 0; i < liveTarget; ++i) spawn();
+
+    measure(result, 20, [&] {
+        for (int i = 0; i < churnPerSample; ++i) {
+            const std::size_t victim = rng.below(static_cast<uint32_t>(live.size()));
+            world.destroyEntity(live[victim]);
+            live[victim] = live.back();
+            live.pop_back();
+        }
+        for (int i = 0; i < churnPerSample; ++i) spawn();
+        // Component add/remove without entity turnover.
+        for (int i = 0; i < churnPerSample; ++i) {
+            const EntityId id = live[rng.below(static_cast<uint32_t>(live.size()))];
+            if (!world.removeComponent<MeshRenderer>(id)) world.addComponent<MeshRenderer>(id);
+        }
+    });
+
+    result.counter("live_entities", static_cast<double>(live.size()));
+    result.counter("ops_per_sample", static_cast<double>(churnPerSample) * 3.0);
+}
+
+void benchEcsQuery(BenchResult& result, double scale) {
+    const int entityCount = std::max(1000, static_cast<int>(100000 * scale));
+
+    core::ecs::World world;
+    BenchRng rng(0x5EED0001ull);
+    for (int i = 0; i < entityCount; ++i) {
+        const EntityId id = world.createEntity();
+        world.addComponent<Transform>(id, Transform{{rng.unit() * 500.0f, rng.unit() * 20.0f, rng.unit() * 500.0f}});
+        if (i % 2 == 0) world.addComponent<Velocity>(id, Velocity{{rng.unit() - 0.5f, 0.0f, rng.unit() - 0.5f}});
+        if (i % 4 == 0) world.addComponent<MeshRenderer>(id);
+    }
+
+    uint64_t visited = 0;
+    double checksum = 0.0;
+    measure(result, 30, [&] {
+        visited = 0;
+        world.each<Velocity, Transform>([&](EntityId, Velocity& v, Transform& t) {
+            t.position = t.position + v.value * (1.0f / 60.0f);
+            ++visited;
+        });
+        world.each<MeshRenderer, Transform>([&](EntityId, MeshRenderer& r, Transform& t) {
+            checksum += static_cast<double>(t.position.y * r.roughness);
+            ++visited;
+        });
+        world.each<Transform>([&](EntityId, Transform& t) {
+            checksum += static_cast<double>(t.position.x);
+            ++visited;
+        });
+    });
+
+    result.counter("entities", entityCount);
+    result.counter("visited_per_sample", static_cast<double>(visited));
+    result.counter("checksum", checksum != 0.0 ? 1.0 : 0.0);
+}
+
+// --- Physics ---------------------------------------------------------------
+
+void benchPhysicsPile(BenchResult& result, double scale, int boxCount, int steps) {
+    const int boxes = std::max(8, static_cast<int>(boxCount * scale));
+    const float dt = 1.0f / 60.0f;
+
+    Scene scene;
+    PhysicsSystem physics;
+    physics.setSolverIterations(12, 6);
+    physics.setMaxSubSteps(8);
+    physics.setGravity({0.0f, -9.81f, 0.0f});
+
+    // Columns of 10 boxes on a static slab, slightly jittered so stacks topple into piles.
+    constexpr int kStackHeight = 10;
+    const int columns = (boxes + kStackHeight - 1) / kStackHeight;
+    const int side = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(columns))));
+    const float spacing = 1.6f;
+    const float extent = static_cast<float>(side) * spacing + 8.0f;
+
+    const EntityId ground = scene.createEntity();
+    Transform& groundTransform = scene.addComponent<Transform>(ground, Transform{{0.0f, -0.5f, 0.0f}});
+    groundTransform.scale = {extent * 2.0f, 1.0f, extent * 2.0f};
+    scene.addComponent<RigidBodyComponent>(ground, RigidBodyComponent{BodyType::Static, 0.0f});
+
+    BenchRng rng(0xB0B0ull + static_cast<uint64_t>(boxCount));
+    for (int i = 0; i < boxes; ++i) {
+        const int column = i / kStackHeight;
+        const int level = i % kStackHeight;
+        const float x = (static_cast<float>(column % side) - side * 0.5f) * spacing + (rng.unit() - 0.5f) * 0.3f;
+        const float z = (static_cast<float>(column / side) - side * 0.5f) * spacing + (rng.unit() - 0.5f) * 0.3f;
+
+        const EntityId e = scene.createEntity();
+        scene.addComponent<Transform>(e, Transform{{x, 0.5f + static_cast<float>(level) * 1.02f, z}});
+        RigidBodyComponent& rb = scene.addComponent<RigidBodyComponent>(e, RigidBodyComponent{BodyType::Dynamic, 1.0f});
+        rb.restitution = 0.05f;
+        rb.enableCCD = false;
+    }
+
+    measure(result, steps, [&] {
+        physics.update(scene, dt);
+    });
+
+    double sumHeight = 0.0;
+    scene.each<RigidBodyComponent>([&](EntityId id, RigidBodyComponent& rb) {
+        if (rb.type != BodyType::Dynamic) return;
+        if (const auto* t = scene.getComponent<Transform>(id)) sumHeight += t->position.y;
+    });
+
+    result.counter("bodies", boxes);
+    result.counter("steps", static_cast<double>(physics.stepCount()));
+    result.counter("mean_height", sumHeight / static_cast<double>(boxes));
+}
+
+// --- Culling ---------------------------------------------------------------
+
+void benchVoxelCulling(BenchResult& result, double scale) {
+    const int half = std::max(16, static_cast<int>(128 * std::sqrt(scale)));
+    constexpr int kLayers = 3;
+
+    Scene scene;
+    uint64_t blocks = 0;
+    for (int x = -half; x < half; ++x) {
+        for (int z = -half; z < half; ++z) {
+            const float h = 4.5f
+                + std::sin(float(x) * 0.22f) * 1.9f
+                + std::cos(float(z) * 0.17f) * 1.5f
+                + std::sin(float(x + z) * 0.11f) * 1.0f;
+            const int top = std::clamp(static_cast<int>(std::floor(h)), 2, 9);
+            for (int y = top - kLayers + 1; y <= top; ++y) {
+                const EntityId e = scene.createEntity();
+                scene.addComponent<Transform>(e, Transform{{float(x), float(y), float(z)}});
+                scene.addComponent<MeshRenderer>(e);
+                ++blocks;
+            }
+        }
+    }
+
+    gfx::FrustumCuller culler;
+    std::pmr::unsynchronized_pool_resource pool;
+    gfx::VisibleList visible(&pool);
+    uint64_t visibleTotal = 0;
+    constexpr int kViews = 8;
+
+    measure(result, 10, [&] {
+        visibleTotal = 0;
+        for (int view = 0; view < kViews; ++view) {
+            const float yaw = static_cast<float>(view) * (360.0f / kViews) * DEG2RAD;
+            const Vec3 forward = normalize(Vec3{std::sin(yaw), -0.35f, std::cos(yaw)});
+            visible.clear();
+            culler.collectVisible(scene, {0.0f, 16.0f, 0.0f}, forward, 60.0f, 16.0f / 9.0f, 0.1f, 160.0f, visible);
+            visibleTotal += visible.size();
+        }
+    });
+
+    result.counter("blocks", static_cast<double>(blocks));
+    result.counter("views_per_sample", kViews);
+    result.counter("visible_per_view", static_cast<double>(visibleTotal) / kViews);
+}
+
+// --- RexUI -----------------------------------------------------------------
+
+class CountingUIBackend final : public ui::renderer::IRenderBackend {
+public:
+    bool beginFrame(const ui::renderer::RenderFrameContext&) override { return true; }
+    bool submit(const ui::runtime::render::DrawList& drawList) override {
+        commands = drawList.size();
+        return true;
+    }
+    bool endFrame() override { return true; }
+
+    std::size_t commands = 0;
+};
+
+void benchRexUI(BenchResult& result, double scale) {
+    using namespace ui::widgets::basic;
+
+    const int rows = std::max(10, static_cast<int>(100 * std::sqrt(scale)));
+    const int perRow = rows;
+
+    auto root = std::make_shared<PanelWidget>();
+    root->setOrientation(PanelOrientation::Vertical);
+    root->setBackgroundColor({0.1f, 0.1f, 0.12f, 1.0f});
+    uint64_t widgets = 1;
+    for (int r = 0; r < rows; ++r) {
+        auto row = std::make_shared<PanelWidget>();
+        row->setOrientation(PanelOrientation::Horizontal);
+        row->setBorderColor({0.3f, 0.3f, 0.3f, 1.0f});
+        row->setBorderThickness(1.0f);
+        ++widgets;
+        for (int c = 0; c < perRow; ++c) {
+            if ((r + c) % 3 == 0) {
+                auto button = std::make_shared<ButtonWidget>();
+                button->setText("B" + std::to_string(r * perRow + c));
+                row->addChild(button);
+            } else {
+                auto text = std::make_shared<TextWidget>();
+                text->setText("Item " + std::to_string(r * perRow + c));
+                row->addChild(text);
+            }
+            ++widgets;
+        }
+        root->addChild(row);
+    }
+
+    CountingUIBackend backend;
+    ui::app::RexUIEngine engine(&backend);
+    engine.setRoot(root);
+    engine.setViewport(1920, 1080);
+
+    uint64_t frameIndex = 1;
+    measure(result, 30, [&] {
+        engine.runFrame(1.0f / 60.0f, frameIndex++);
+    });
+
+    result.counter("widgets", static_cast<double>(widgets));
+    result.counter("draw_commands", static_cast<double>(backend.commands));
+}
+
+// --- OBJ -------------------------------------------------------------------
+
+std::string makeGridObj(int resolution) {
+    std::string out;
+    out.reserve(static_cast<std::size_t>(resolution + 1) * (resolution + 1) * 64 +
+                static_cast<std::size_t>(resolution) * resolution * 64);
+    char line[256];
+    for (int z = 0; z <= resolution; ++z) {
+        for (int x = 0; x <= resolution; ++x) {
+            const float fx = static_cast<float>(x) / resolution;
+            const float fz = static_cast<float>(z) / resolution;
+            const float fy = std::sin(fx * 12.0f) * std::cos(fz * 9.0f) * 0.1f;
+            std::snprintf(line, sizeof(line), "v %.6f %.6f %.6f\nvt %.6f %.6f\nvn 0.000000 1.000000 0.000000\n",
+                          fx, fy, fz, fx, fz);
+            out += line;
+        }
+    }
+    const int stride = resolution + 1;
+    for (int z = 0; z < resolution; ++z) {
+        for (int x = 0; x < resolution; ++x) {
+            const int a = z * stride + x + 1;
+            const int b = a + 1;
+            const int c = a + stride;
+            const int d = c + 1;
+            std::snprintf(line, sizeof(line), "f %d/%d/%d %d/%d/%d %d/%d/%d\nf %d/%d/%d %d/%d/%d %d/%d/%d\n",
+                          a, a, a, c, c, c, b, b, b, b, b, b, c, c, c, d, d, d);
+            out += line;
+        }
+    }
+    return out;
+}
+
+void benchObjParse(BenchResult& result, double scale) {
+    const int resolution = std::max(16, static_cast<int>(256 * std::sqrt(scale)));
+    const std::string source = makeGridObj(resolution);
+
+    gfx::ObjImportStats stats{};
+    std::optional<gfx::ObjMesh> mesh;
+    bool ok = true;
+    measure(result, 8, [&] {
+        mesh = gfx::ObjImporter::importText(source, {}, &stats);
+        ok = mesh.has_value() && ok;
+    });
+
+    const SampleSummary summary = summarize(result.samplesMs);
+    const double megabytes = static_cast<double>(source.size()) / (1024.0 * 1024.0);
+    result.counter("bytes", static_cast<double>(source.size()));
+    result.counter("triangles", static_cast<double>(stats.triangles));
+    result.counter("vertices", static_cast<double>(stats.vertices));
+    result.counter("threads", static_cast<double>(stats.threads));
+    result.counter("mb_per_s", summary.median > 0.0 ? megabytes / (summary.median / 1000.0) : 0.0);
+    result.counter("parse_ok", ok && stats.vertices == static_cast<uint64_t>(resolution + 1) * (resolution + 1) ? 1.0 : 0.0);
+}
+
+// --- Import derived-data cache ---------------------------------------------
+
+// Timed samples are warm imports (every asset a cache hit); the cold pass that cooks and stores
+// each asset is reported as a counter.
+void benchImportCache(BenchResult& result, double scale) {
+    const int assetCount = std::max(2, static_cast<int>(16 * scale));
+    const std::filesystem::path root = std::filesystem::temp_directory_path() / "rex-bench-import";
+    std::error_code ec;
+    std::filesystem::remove_all(root, ec);
+    std::filesystem::create_directories(root / "Source", ec);
+
+    std::vector<std::string> sources;
+    std::size_t sourceBytes = 0;
+    for (int i = 0; i < assetCount; ++i) {
+        const std::string obj = makeGridObj(96 + i);
+        const std::filesystem::path path = root / "Source" / ("grid" + std::to_string(i) + ".obj");
+        std::ofstream(path, std::ios::binary) << obj;
+        sources.push_back(path.string());
+        sourceBytes += obj.size();
+    }
+
+    editor::asset::DerivedDataCache cache(root / "DerivedData", 1ull << 30);
+    editor::asset::ImportPipeline pipeline;
+    pipeline.setDerivedDataCache(&cache);
+    pipeline.registerImporter(
+        "obj",
+        [](const editor::asset::ImportRequest& request) {
+            editor::asset::ImportResult out{};
+            if (auto mesh = gfx::MeshLibrary::loadObj(request.sourcePath)) {
+                gfx::buildLodChain(mesh->vertices, mesh->indices, mesh->submeshes, mesh->lods);
+                gfx::optimizeMesh(mesh->vertices, mesh->indices, mesh->submeshes);
+                out.success = true;
+                out.cooked = gfx::MeshLibrary::encode(*mesh);
+            }
+            return out;
+        },
+        4,
+        [](std::span<const std::byte> cooked) -> std::shared_ptr<void> {
+            auto mesh = gfx::MeshLibrary::decode(cooked);
+            return mesh ? std::make_shared<gfx::MeshData>(std::move(*mesh)) : nullptr;
+        });
+
+    bool ok = true;
+    const auto importAll = [&] {
+        int hits = 0;
+        for (int i = 0; i < assetCount; ++i) {
+            const editor::asset::ImportResult imported =
+                pipeline.importAsset({sources[i], "grid" + std::to_string(i), "obj", {}});
+            ok = imported.success && ok;
+            hits += imported.cacheHit ? 1 : 0;
+        }
+        return hits;
+    };
+
+    const auto coldBegin = BenchClock::now();
+    const int coldHits = importAll();
+    const double coldMs = std::chrono::duration<double, std::milli>(BenchClock::now() - coldBegin).count();
+    int warmHits = 0;
+    measure(result, 8, [&] { warmHits = importAll(); });
+    ok = coldHits == 0 && warmHits == assetCount && ok;
+
+    const editor::asset::DerivedDataCacheStats stats = cache.stats();
+    std::filesystem::remove_all(root, ec);
+
+    const double warmMs = summarize(result.samplesMs).median;
+    result.counter("assets", assetCount);
+    result.counter("source_bytes", static_cast<double>(sourceBytes));
+    result.counter("cache_bytes", static_cast<double>(stats.bytes));
+    result.counter("cold_ms", coldMs);
+    result.counter("speedup", warmMs > 0.0 ? coldMs / warmMs : 0.0);
+    result.counter("hits_ok", ok ? 1.0 : 0.0);
+}
+
+// --- Mesh load --------------------------------------------------------------
+
+// Drops the file from the page cache so the next read comes from storage (no-op elsewhere).
+void evictFromPageCache(const std::filesystem::path& path) {
+#if defined(__linux__)
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return;
+    ::fdatasync(fd);
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    ::close(fd);
+#else
+    (void)path;
+#endif
+}
+
+// Timed samples load the cooked .rexmesh (map + validate + a copy standing in for the driver's
+// upload copy); the same prop loaded from OBJ is reported as a counter. Both start cold.
+void benchMeshLoad(BenchResult& result, double scale) {
+    const int resolution = std::max(16, static_cast<int>(512 * std::sqrt(scale)));
+    const std::filesystem::path root = std::filesystem::temp_directory_path() / "rex-bench-mesh";
+    std::error_code ec;
+    std::filesystem::create_directories(root, ec);
+    const std::filesystem::path objPath = root / "prop.obj";
+    const std::filesystem::path meshPath = root / "prop.rexmesh";
+    std::ofstream(objPath, std::ios::binary) << makeGridObj(resolution);
+
+    bool ok = true;
+    std::vector<std::byte> staging;
+    const auto upload = [&](const gfx::MeshData& data) {
+        const size_t bytes = gfx::MeshLibrary::gpuBytes(data);
+        staging.resize(bytes);
+        std::memcpy(staging.data(), data.vertexBytes().data(), data.vertexBytes().size());
+        std::memcpy(staging.data() + data.vertexBytes().size(), data.indexStream().data(),
+                    data.indexStream().size_bytes());
+        return bytes;
+    };
+
+    double objMs = 0.0;
+    {
+        evictFromPageCache(objPath);
+        const auto begin = BenchClock::now();
+        auto obj = gfx::MeshLibrary::loadObj(objPath.string(), nullptr, gfx::ObjImportOptions{});
+        ok = obj && upload(*obj) > 0 && ok;
+        objMs = std::chrono::duration<double, std::milli>(BenchClock::now() - begin).count();
+        ok = obj && gfx::saveMeshFile(meshPath.string(), {obj->vertices, obj->indices, {}, {}}) && ok;
+    }
+
+    size_t bytes = 0;
+    measure(result, 8, [&] {
+        evictFromPageCache(meshPath);
+        auto mesh = gfx::MeshLibrary::loadMeshFile(meshPath.string());
+        ok = mesh && (bytes = upload(*mesh)) > 0 && ok;
+    });
+
+    const size_t objBytes = static_cast<size_t>(std::filesystem::file_size(objPath, ec));
+    const size_t meshBytes = static_cast<size_t>(std::filesystem::file_size(meshPath, ec));
+    std::filesystem::remove_all(root, ec);
+
+    const double meshMs = summarize(result.samplesMs).median;
+    result.counter("obj_bytes", static_cast<double>(objBytes));
+    result.counter("rexmesh_bytes", static_cast<double>(meshBytes));
+    result.counter("gpu_bytes", static_cast<double>(bytes));
+    result.counter("obj_ms", objMs);
+    result.counter("speedup", meshMs > 0.0 ? objMs / meshMs : 0.0);
+    result.counter("load_ok", ok ? 1.0 : 0.0);
+}
+
+// Grid with its triangles shuffled, so the input has no cache locality to start from. Timed
+// samples are full optimizeMesh() runs on a fresh copy.
+void benchMeshOptimize(BenchResult& result, double scale) {
+    const int resolution = std::max(16, static_cast<int>(256 * std::sqrt(scale)));
+    auto grid = gfx::ObjImporter::importText(makeGridObj(resolution));
+    bool ok = grid.has_value();
+    if (!grid) grid.emplace();
+
+    BenchRng rng(0x0B7u);
+    const uint32_t triangleCount = static_cast<uint32_t>(grid->indices.size() / 3);
+    for (uint32_t t = triangleCount; t > 1; --t) {
+        const uint32_t other = rng.below(t);
+        for (uint32_t k = 0; k < 3; ++k) std::swap(grid->indices[(t - 1) * 3 + k], grid->indices[other * 3 + k]);
+    }
+
+    gfx::MeshOptimizeReport report{};
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    measure(result, 8, [&] {
+        vertices = grid->vertices;
+        indices = grid->indices;
+        report = gfx::optimizeMesh(vertices, indices);
+    });
+
+    std::vector<PackedVertex> packed;
+    float maxError = 0.0f;
+    gfx::quantizeVertices(vertices, packed, &maxError);
+    const double floatBytes = static_cast<double>(vertices.size() * sizeof(Vertex));
+
+    result.counter("triangles", static_cast<double>(triangleCount));
+    result.counter("acmr_before", report.before.acmr);
+    result.counter("acmr_after", report.after.acmr);
+    result.counter("atvr_after", report.after.atvr);
+    result.counter("overdraw_kept", static_cast<double>(report.overdrawRanges));
+    result.counter("packed_ratio", floatBytes > 0.0 ? static_cast<double>(packed.size() * sizeof(PackedVertex)) / floatBytes : 0.0);
+    result.counter("max_position_error", maxError);
+    result.counter("optimize_ok", ok && indices.size() == grid->indices.size() && report.after.acmr < report.before.acmr ? 1.0 : 0.0);
+}
+
+// Lumpy UV sphere with a texture seam and welded poles; timed samples build the whole chain.
+void benchMeshLod(BenchResult& result, double scale) {
+    const int rings = std::max(16, static_cast<int>(256 * std::sqrt(scale)));
+    const int segments = rings * 2;
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    for (int r = 0; r <= rings; ++r) {
+        for (int s = 0; s <= segments; ++s) {
+            const float theta = 3.14159265f * static_cast<float>(r) / static_cast<float>(rings);
+            const float phi = 6.28318531f * static_cast<float>(s % segments) / static_cast<float>(segments);
+            const Vec3 n{std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi)};
+            const float bump = 1.0f + 0.05f * std::sin(phi * 5.0f) * std::sin(theta * 7.0f);
+            vertices.push_back({n * bump, n, {static_cast<float>(s) / segments, static_cast<float>(r) / rings}});
+        }
+    }
+    for (int r = 0; r < rings; ++r) {
+        for (int s = 0; s < segments; ++s) {
+            const uint32_t a = static_cast<uint32_t>(r * (segments + 1) + s);
+            const uint32_t c = a + static_cast<uint32_t>(segments + 1);
+            indices.insert(indices.end(), {a, c, a + 1, a + 1, c, c + 1});
+        }
+    }
+
+    gfx::LodChainReport report;
+    std::vector<uint32_t> chainIndices;
+    std::vector<gfx::MeshSubmesh> submeshes;
+    std::vector<gfx::MeshLod> lods;
+    measure(result, 4, [&] {
+        chainIndices = indices;
+        submeshes.clear();
+        report = gfx::buildLodChain(vertices, chainIndices, submeshes, lods);
+    });
+
+    // Walk the screen size from 100 down to 0.01 of the viewport and back: levels must only
+    // coarsen going out, reach the last level and return to LOD 0, and with hysteresis each
+    // threshold is crossed once per direction.
+    const std::vector<MeshLodRange> ranges = gfx::makeLodRanges(submeshes, lods);
+    bool ok = ranges.size() == lods.size() && lods.size() > 1;
+    uint32_t lod = 0;
+    uint32_t coarsest = 0;
+    uint32_t switches = 0;
+    for (int step = 0; step <= 4000; ++step) {
+        const float t = static_cast<float>(step < 2000 ? step : 4000 - step) / 2000.0f;
+        const uint32_t next = gfx::selectLod(ranges, 100.0f * std::pow(10.0f, -4.0f * t), lod, 0.1f);
+        ok = (step < 2000 ? next >= lod : next <= lod) && ok;
+        switches += next != lod ? 1 : 0;
+        coarsest = std::max(coarsest, next);
+        lod = next;
+    }
+    ok = ok && lod == 0 && coarsest + 1 == ranges.size();
+
+    result.counter("triangles", static_cast<double>(indices.size() / 3));
+    result.counter("levels", static_cast<double>(lods.size()));
+    for (size_t i = 1; i < report.indexCounts.size() && i <= 2; ++i) {
+        result.counter("lod" + std::to_string(i) + "_ratio", static_cast<double>(report.indexCounts[i]) / report.indexCounts[0]);
+        result.counter("lod" + std::to_string(i) + "_error", report.errors[i]);
+    }
+    result.counter("switches", switches);
+    result.counter("lod_ok", ok && switches == 2 * (lods.size() - 1) ? 1.0 : 0.0);
+}
+
+// --- Scene serialization ---------------------------------------------------
+
+void benchSceneSaveLoad(BenchResult& result, double scale) {
+    const int entityCount = std::max(1000, static_cast<int>(200000 * scale));
+    const core::serialization::SceneSerializer serializer = makeSceneSerializer();
+
+    Scene scene;
+    BenchRng rng(0x5CE4Eull);
+    core::resource::AssetPathTable assets;
+    const core::resource::AssetId rock = assets.add("assets/rock.rexmesh");
+    for (int i = 0; i < entityCount; ++i) {
+        const EntityId id = scene.createEntity();
+        scene.addComponent<Transform>(id, Transform{{rng.unit() * 500.0f, rng.unit() * 50.0f, rng.unit() * 500.0f},
+                                                    {0.0f, rng.unit() * 360.0f, 0.0f}});
+        if (i % 2 == 0) {
+            MeshRenderer& renderer = scene.addComponent<MeshRenderer>(id, nullptr, Vec3{rng.unit(), rng.unit(), rng.unit()});
+            if (i % 4 == 0) renderer.meshAsset = rock;
+        }
+        if (i % 4 == 0) scene.addComponent<RigidBodyComponent>(id).mass = 1.0f + rng.unit();
+        if (i % 100 == 0) scene.addComponent<Light>(id, Vec3{1.0f, 0.9f, 0.8f}, 4.0f);
+    }
+
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "rex-bench-scene.bin";
+    Scene loaded;
+    double saveMs = 0.0;
+    double loadMs = 0.0;
+    std::size_t fileBytes = 0;
+    bool ok = true;
+    measure(result, 8, [&] {
+        const auto begin = BenchClock::now();
+        ok = serializer.saveToFile(scene, path, &assets) && ok;
+        const auto saved = BenchClock::now();
+        core::serialization::SceneLoadReport report{};
+        core::resource::AssetPathTable loadedAssets;
+        ok = serializer.loadFromFile(path, loaded, &report, &loadedAssets) && ok;
+        ok = report.entities == static_cast<uint32_t>(entityCount) && ok;
+        const std::string* rockPath = loadedAssets.find(rock);
+        ok = rockPath && *rockPath == "assets/rock.rexmesh" && ok;
+        saveMs += std::chrono::duration<double, std::milli>(saved - begin).count();
+        loadMs += std::chrono::duration<double, std::milli>(BenchClock::now() - saved).count();
+    });
+    std::size_t rockRefs = 0;
+    loaded.each<MeshRenderer>([&](EntityId, const MeshRenderer& renderer) {
+        if (renderer.meshAsset == rock) ++rockRefs;
+    });
+    ok = rockRefs == static_cast<std::size_t>((entityCount + 3) / 4) && ok;
+    fileBytes = static_cast<std::size_t>(std::filesystem::file_size(path));
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+
+    // Totals include the warm-up pass.
+    const double megabytes = static_cast<double>(fileBytes) / (1024.0 * 1024.0) * 9.0;
+    result.counter("entities", static_cast<double>(entityCount));
+    result.counter("bytes", static_cast<double>(fileBytes));
+    result.counter("save_mb_per_s", saveMs > 0.0 ? megabytes / (saveMs / 1000.0) : 0.0);
+    result.counter("load_mb_per_s", loadMs > 0.0 ? megabytes / (loadMs / 1000.0) : 0.0);
+    result.counter("roundtrip_ok", ok ? 1.0 : 0.0);
+}
+
+// --- Virtual file system ---------------------------------------------------
+
+// Many small text assets (the startup pattern): every sample mounts the archive and reads every
+// file through the VFS; the same files read loose through a directory mount are a counter.
+void benchVfsPak(BenchResult& result, double scale) {
+    const int fileCount = std::max(100, static_cast<int>(2000 * scale));
+    const std::filesystem::path root = std::filesystem::temp_directory_path() / "rex-bench-vfs";
+    std::error_code ec;
+    std::filesystem::remove_all(root, ec);
+
+    BenchRng rng(0x7F5ull);
+    std::vector<std::string> paths;
+    std::size_t sourceBytes = 0;
+    for (int i = 0; i < fileCount; ++i) {
+        const std::string path = "shaders/group" + std::to_string(i % 16) + "/asset" + std::to_string(i) + ".txt";
+        std::string text;
+        const int lines = 16 + static_cast<int>(rng.unit() * 240.0f);
+        for (int line = 0; line < lines; ++line) {
+            text += "uniform vec4 param" + std::to_string(line) + " = vec4(" + std::to_string(rng.unit()) + ", 0.0, 1.0, " +
+                    std::to_string(i) + ");\n";
+        }
+        std::filesystem::create_directories((root / "Loose" / path).parent_path(), ec);
+        std::ofstream(root / "Loose" / path, std::ios::binary) << text;
+        paths.push_back(path);
+        sourceBytes += text.size();
+    }
+
+    const std::filesystem::path pakPath = root / "assets.rexpak";
+    const auto packBegin = BenchClock::now();
+    bool ok = core::platform::VirtualFileSystem::packDirectory(root / "Loose", pakPath) == static_cast<std::size_t>(fileCount);
+    const double packMs = std::chrono::duration<double, std::milli>(BenchClock::now() - packBegin).count();
+
+    std::size_t checksum = 0;
+    const auto readAll = [&](const std::filesystem::path& source) {
+        core::platform::VirtualFileSystem vfs;
+        bool mounted = vfs.mount(source);
+        std::size_t sum = 0;
+        for (const std::string& path : paths) {
+            const core::platform::VfsFile file = vfs.open(path);
+            mounted = file.valid() && mounted;
+            for (const std::byte b : file.bytes()) sum += std::to_integer<std::size_t>(b);
+        }
+        return mounted ? sum : 0;
+    };
+
+    const std::size_t expected = readAll(root / "Loose");
+    const auto looseBegin = BenchClock::now();
+    for (int i = 0; i < 8; ++i) ok = readAll(root / "Loose") == expected && ok;
+    const double looseMs = std::chrono::duration<double, std::milli>(BenchClock::now() - looseBegin).count() / 8.0;
+    measure(result, 8, [&] { checksum = readAll(pakPath); });
+    ok = expected != 0 && checksum == expected && ok;
+
+    const std::size_t pakBytes = static_cast<std::size_t>(std::filesystem::file_size(pakPath, ec));
+    std::filesystem::remove_all(root, ec);
+
+    const double pakMs = summarize(result.samplesMs).median;
+    result.counter("files", fileCount);
+    result.counter("source_bytes", static_cast<double>(sourceBytes));
+    result.counter("pak_ratio", static_cast<double>(pakBytes) / static_cast<double>(std::max<std::size_t>(sourceBytes, 1)));
+    result.counter("pack_ms", packMs);
+    result.counter("loose_ms", looseMs);
+    result.counter("speedup", pakMs > 0.0 ? looseMs / pakMs : 0.0);
+    result.counter("read_ok", ok ? 1.0 : 0.0);
+}
+
+// --- Async file I/O --------------------------------------------------------
+
+// Cold streaming reads: every sample evicts the files and reads them in 256 KB chunks, all
+// requests in flight at once, through AsyncIo (io_uring where available). The worker-thread
+// fallback and a sequential FileSystem::readBinary pass over the same cold files are counters.
+void benchAsyncIo(BenchResult& result, double scale) {
+    const int fileCount = 16;
+    const std::size_t fileBytes = std::max<std::size_t>(std::size_t{1} << 20, static_cast<std::size_t>((4u << 20) * scale)) & ~std::size_t{4095};
+    constexpr std::size_t kChunk = std::size_t{256} << 10;
+    const std::filesystem::path root = std::filesystem::temp_directory_path() / "rex-bench-aio";
+    std::error_code ec;
+    std::filesystem::create_directories(root, ec);
+
+    BenchRng rng(0xA10ull);
+    std::vector<std::filesystem::path> paths;
+    std::vector<std::uint64_t> words(fileBytes / sizeof(std::uint64_t));
+    for (int i = 0; i < fileCount; ++i) {
+        for (std::uint64_t& word : words) word = rng.next();
+        paths.push_back(root / ("stream" + std::to_string(i) + ".bin"));
+        std::ofstream(paths.back(), std::ios::binary).write(reinterpret_cast<const char*>(words.data()),
+                                                            static_cast<std::streamsize>(fileBytes));
+    }
+    const auto evictAll = [&] {
+        for (const auto& path : paths) evictFromPageCache(path);
+    };
+
+    bool ok = true;
+    std::vector<std::vector<std::byte>> expected;
+    evictAll();
+    const auto syncBegin = BenchClock::now();
+    for (const auto& path : paths) {
+        auto bytes = core::platform::FileSystem::readBinary(path);
+        ok = bytes && bytes->size() == fileBytes && ok;
+        expected.push_back(bytes ? std::move(*bytes) : std::vector<std::byte>{});
+    }
+    const double syncMs = std::chrono::duration<double, std::milli>(BenchClock::now() - syncBegin).count();
+
+    std::vector<core::platform::IoFile> files;
+    for (const auto& path : paths) files.emplace_back(path);
+    std::vector<std::vector<std::byte>> buffers(fileCount, std::vector<std::byte>(fileBytes));
+    const auto readAll = [&](core::platform::AsyncIo& io) {
+        std::vector<std::future<core::platform::IoResult>> pending;
+        for (int i = 0; i < fileCount; ++i) {
+            for (std::size_t offset = 0; offset < fileBytes; offset += kChunk) {
+                pending.push_back(io.read(files[i], offset, std::span(buffers[i]).subspan(offset, std::min(kChunk, fileBytes - offset))));
+            }
+        }
+        bool complete = true;
+        for (auto& request : pending) {
+            const core::platform::IoResult read = request.get();
+            complete = read.ok() && complete;
+        }
+        for (int i = 0; i < fileCount; ++i) complete = buffers[i] == expected[i] && complete;
+        return complete;
+    };
+
+    double fallbackMs = 0.0;
+    {
+        core::platform::AsyncIoConfig config;
+        config.forceFallback = true;
+        core::platform::AsyncIo io(config);
+        evictAll();
+        const auto begin = BenchClock::now();
+        ok = readAll(io) && ok;
+        fallbackMs = std::chrono::duration<double, std::milli>(BenchClock::now() - begin).count();
+    }
+
+    core::platform::AsyncIo io;
+    measure(result, 8, [&] {
+        evictAll();
+        ok = readAll(io) && ok;
+    });
+    const core::platform::AsyncIoStats stats = io.stats();
+
+    files.clear();
+    std::filesystem::remove_all(root, ec);
+
+    const double asyncMs = summarize(result.samplesMs).median;
+    const double totalMb = static_cast<double>(fileBytes) * fileCount / (1024.0 * 1024.0);
+    result.counter("io_uring", io.backend() == "io_uring" ? 1.0 : 0.0);
+    result.counter("total_mb", totalMb);
+    result.counter("mb_per_s", asyncMs > 0.0 ? totalMb * 1000.0 / asyncMs : 0.0);
+    result.counter("fallback_ms", fallbackMs);
+    result.counter("sync_ms", syncMs);
+    result.counter("requests_per_submit",
+                   stats.submitCalls > 0 ? static_cast<double>(stats.submitted) / static_cast<double>(stats.submitCalls) : 0.0);
+    result.counter("max_in_flight", stats.maxInFlight);
+    result.counter("speedup", asyncMs > 0.0 ? syncMs / asyncMs : 0.0);
+    result.counter("read_ok", ok ? 1.0 : 0.0);
+}
+
+std::vector<Scenario> makeScenarios() {
+    return {
+        {"ecs_churn", "create/destroy entities and toggle components at 50k live", benchEcsChurn},
+        {"ecs_query_100k", "single and joined each() over 100k entities", benchEcsQuery},
+        {"physics_pile_1k", "1k boxes stacked and piling on a slab", [](BenchResult& r, double s) { benchPhysicsPile(r, s, 1000, 120); }},
+        {"physics_pile_5k", "5k boxes stacked and piling on a slab", [](BenchResult& r, double s) { benchPhysicsPile(r, s, 5000, 60); }},
+        {"physics_pile_10k", "10k boxes stacked and piling on a slab", [](BenchResult& r, double s) { benchPhysicsPile(r, s, 10000, 30); }},
+        {"voxel_culling", "frustum culling of a 256x256x3 voxel world from 8 views", benchVoxelCulling},
+        {"rexui_10k_widgets", "RexUI layout and draw-list build for a 10k-widget tree", benchRexUI},
+        {"obj_parse", "OBJ parse of a 131k-triangle grid from memory", benchObjParse},
+        {"mesh_load", "cold load of a 524k-triangle prop from .rexmesh (OBJ time as counter)", benchMeshLoad},
+        {"mesh_optimize", "vertex cache, overdraw and fetch optimisation of a shuffled 131k-triangle grid", benchMeshOptimize},
+        {"mesh_lod", "QEM LOD chain for a 262k-triangle sphere and LOD selection sweep", benchMeshLod},
+        {"import_cache", "warm import of 16 OBJ files through the derived-data cache", benchImportCache},
+        {"scene_save_load", "binary column save and load of a 200k-entity scene through a file", benchSceneSaveLoad},
+        {"vfs_pak", "read 2000 small files from a compressed .rexpak vs. a loose directory mount", benchVfsPak},
+        {"async_io", "cold chunked reads of 16 x 4 MB files through io_uring (thread fallback and sync as counters)", benchAsyncIo},
+    };
+}
+
+// --- Output and baseline ---------------------------------------------------
+
+void appendJsonString(std::string& out, std::string_view text) {
+    out += '"';
+    for (const char c : text) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    out += '"';
+}
+
+void appendJsonNumber(std::string& out, double value) {
+    char buffer[64];
+    std::snprintf(buffer, sizeof(buffer), "%.6g", std::isfinite(value) ? value : 0.0);
+    out += buffer;
+}
+
+std::string toJson(const std::vector<BenchResult>& results, double scale) {
+    std::string out = "{\n  \"version\": 1,\n";
+#if defined(NDEBUG)
+    out += "  \"build\": \"release\",\n";
+#else
+    out += "  \"build\": \"debug\",\n";
+#endif
+    out += "  \"scale\": ";
+    appendJsonNumber(out, scale);
+    out += ",\n  \"scenarios\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const BenchResult& result = results[i];
+        const SampleSummary summary = summarize(result.samplesMs);
+        out += "    {\"name\": ";
+        appendJsonString(out, result.name);
+        out += ", \"samples\": " + std::to_string(result.samplesMs.size());
+        out += ", \"ms\": {\"min\": ";
+        appendJsonNumber(out, summary.min);
+        out += ", \"median\": ";
+        appendJsonNumber(out, summary.median);
+        out += ", \"p95\": ";
+        appendJsonNumber(out, summary.p95);
+        out += ", \"max\": ";
+        appendJsonNumber(out, summary.max);
+        out += ", \"mean\": ";
+        appendJsonNumber(out, summary.mean);
+        out += "}, \"counters\": {";
+        for (std::size_t c = 0; c < result.counters.size(); ++c) {
+            if (c > 0) out += ", ";
+            appendJsonString(out, result.counters[c].first);
+            out += ": ";
+            appendJsonNumber(out, result.counters[c].second);
+        }
+        out += "}}";
+        out += i + 1 < results.size() ? ",\n" : "\n";
+    }
+    out += "  ]\n}\n";
+    return out;
+}
+
+// Reads scenario medians back from a file written by toJson. Only that layout
+// is understood: each "name" is followed by its "median" before the next "name".
+bool loadBaseline(const std::string& path, std::unordered_map<std::string, double>& medians) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+    const std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    std::size_t cursor = 0;
+    while ((cursor = text.find("\"name\"", cursor)) != std::string::npos) {
+        const std::size_t open = text.find('"', text.find(':', cursor) + 1);
+        const std::size_t close = open == std::string::npos ? open : text.find('"', open + 1);
+        if (close == std::string::npos) break;
+        std::string name = text.substr(open + 1, close - open - 1);
+
+        const std::size_t nextName = text.find("\"name\"", close);
+        const std::size_t median = text.find("\"median\"", close);
+        cursor = close;
+        if (median == std::string::npos || median > nextName) continue;
+        const std::size_t colon = text.find(':', median);
+        medians[std::move(name)] = std::strtod(text.c_str() + colon + 1, nullptr);
+    }
+    return true;
+}
+
+struct BenchOptions {
+    std::string outPath = "rex-bench.json";
+    std::string baselinePath;
+    // Allowed relative slowdown of a scenario median against the baseline.
+    double tolerance = 0.10;
+    // Multiplies entity/body/widget counts; 1.0 is the reference workload.
+    double scale = 1.0;
+    std::vector<std::string> filters;
+    bool list = false;
+};
+
+BenchOptions parseOptions(int argc, char** argv) {
+    BenchOptions options{};
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--out" && hasValue) {
+            options.outPath = argv[++i];
+        } else if (arg == "--baseline" && hasValue) {
+            options.baselinePath = argv[++i];
+        } else if (arg == "--tolerance" && hasValue) {
+            options.tolerance = std::max(0.0, std::strtod(argv[++i], nullptr));
+        } else if (arg == "--scale" && hasValue) {
+            options.scale = std::clamp(std::strtod(argv[++i], nullptr), 0.01, 10.0);
+        } else if (arg == "--filter" && hasValue) {
+            options.filters.emplace_back(argv[++i]);
+        } else if (arg == "--list") {
+            options.list = true;
+        } else {
+            Logger::warn("Unknown or incomplete option: {}", arg);
+        }
+    }
+    return options;
+}
+
+bool selected(const BenchOptions& options, std::string_view name) {
+    if (options.filters.empty()) return true;
+    return std::any_of(options.filters.begin(), options.filters.end(), [&](const std::string& filter) {
+        return name.find(filter) != std::string_view::npos;
+    });
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const BenchOptions options = parseOptions(argc, argv);
+    const std::vector<Scenario> scenarios = makeScenarios();
+
+    if (options.list) {
+        for (const Scenario& scenario : scenarios) {
+            Logger::info("{:<20} {}", scenario.name, scenario.description);
+        }
+        Logger::flush();
+        return 0;
+    }
+
+    std::unordered_map<std::string, double> baseline;
+    if (!options.baselinePath.empty() && !loadBaseline(options.baselinePath, baseline)) {
+        Logger::error("Cannot read baseline {}", options.baselinePath);
+        Logger::flush();
+        return 1;
+    }
+
+#if !defined(NDEBUG)
+    Logger::warn("rex-bench built without NDEBUG; timings are not representative");
+#endif
+
+    std::vector<BenchResult> results;
+    int regressions = 0;
+    for (const Scenario& scenario : scenarios) {
+        if (!selected(options, scenario.name)) continue;
+
+        BenchResult result;
+        result.name = scenario.name;
+        {
+            // Scenario setup logs (e.g. model loads) would interleave with the report.
+            const LogLevel previous = core::diagnostics::LogBackend::instance().level();
+            Logger::setLevel(LogLevel::Warn);
+            scenario.run(result, options.scale);
+            Logger::setLevel(previous);
+        }
+
+        const SampleSummary summary = summarize(result.samplesMs);
+        std::string verdict;
+        if (const auto it = baseline.find(result.name); it != baseline.end() && it->second > 0.0) {
+            const double ratio = summary.median / it->second;
+            char buffer[64];
+            std::snprintf(buffer, sizeof(buffer), " | baseline %.3f ms (%+.1f%%)", it->second, (ratio - 1.0) * 100.0);
+            verdict = buffer;
+            if (ratio > 1.0 + options.tolerance) {
+                verdict += " REGRESSION";
+                ++regressions;
+            }
+        }
+        Logger::info("{:<20} median {:8.3f} ms  p95 {:8.3f} ms  min {:8.3f} ms{}",
+                     result.name, summary.median, summary.p95, summary.min, verdict);
+        results.push_back(std::move(result));
+    }
+
+    const std::string json = toJson(results, options.scale);
+    if (!options.outPath.empty()) {
+        std::ofstream out(options.outPath, std::ios::binary | std::ios::trunc);
+        if (!out || !out.write(json.data(), static_cast<std::streamsize>(json.size()))) {
+            Logger::error("Cannot write {}", options.outPath);
+            Logger::flush();
+            return 1;
+        }
+        Logger::info("Wrote {} ({} scenarios)", options.outPath, results.size());
+    }
+
+    if (regressions > 0) {
+        Logger::error("{} scenario(s) slower than baseline by more than {:.0f}%", regressions, options.tolerance * 100.0);
+    }
+    Logger::flush();
+    return regressions > 0 ? 2 : 0;
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "Components.h"
+#include "Reflection/FieldList.h"
+#include "Serialization/SceneSerializer.h"
+
+namespace rex {
+
+// 필드는 여기서 한 번만 선언한다. 컴파일 타임 순회(forEachField)와 런타임 TypeRegistry 메타가
+// 같은 목록에서 나온다. 런타임 포인터/핸들(MeshRenderer::mesh/meshHandle, RigidBodyComponent::internalBody)은
+// 제외하고, 에셋 참조는 경로 기반 AssetId(MeshRenderer::meshAsset)로 저장한다.
+REX_REFLECT_FIELDS(Transform, "Transform",
+    REX_FIELD(Transform, position, Vec3),
+    REX_FIELD(Transform, rotation, Vec3),
+    REX_FIELD(Transform, scale, Vec3))
+
+REX_REFLECT_FIELDS(MeshRenderer, "MeshRenderer",
+    REX_FIELD(MeshRenderer, meshAsset, std::uint64_t),
+    REX_FIELD(MeshRenderer, color, Vec3),
+    REX_FIELD(MeshRenderer, metallic, float),
+    REX_FIELD(MeshRenderer, roughness, float),
+    REX_FIELD(MeshRenderer, ao, float))
+
+REX_REFLECT_FIELDS(RigidBodyComponent, "RigidBodyComponent",
+    REX_FIELD(RigidBodyComponent, type, BodyType),
+    REX_FIELD(RigidBodyComponent, mass, float),
+    REX_FIELD(RigidBodyComponent, restitution, float),
+    REX_FIELD(RigidBodyComponent, staticFriction, float),
+    REX_FIELD(RigidBodyComponent, dynamicFriction, float),
+    REX_FIELD(RigidBodyComponent, linearDamping, float),
+    REX_FIELD(RigidBodyComponent, angularDamping, float),
+    REX_FIELD(RigidBodyComponent, enableCCD, bool),
+    REX_FIELD(RigidBodyComponent, velocity, Vec3),
+    REX_FIELD(RigidBodyComponent, angularVelocity, Vec3))
+
+REX_REFLECT_FIELDS(Camera, "Camera",
+    REX_FIELD(Camera, fov, float),
+    REX_FIELD(Camera, aspect, float),
+    REX_FIELD(Camera, nearPlane, float),
+    REX_FIELD(Camera, farPlane, float),
+    REX_FIELD(Camera, isPerspective, bool))
+
+REX_REFLECT_FIELDS(Light, "Light",
+    REX_FIELD(Light, type, Light::Type),
+    REX_FIELD(Light, color, Vec3),
+    REX_FIELD(Light, intensity, float),
+    REX_FIELD(Light, castShadows, bool),
+    REX_FIELD(Light, volumetric, bool),
+    REX_FIELD(Light, range, float),
+    REX_FIELD(Light, innerConeDeg, float),
+    REX_FIELD(Light, outerConeDeg, float),
+    REX_FIELD(Light, attenuationConstant, float),
+    REX_FIELD(Light, attenuationLinear, float),
+    REX_FIELD(Light, attenuationQuadratic, float))
+
+// 기본 컴포넌트 메타를 TypeRegistry에 한 번만 등록한다.
+inline void registerComponentReflection() {
+    static const bool registered = [] {
+        core::reflection::registerFields<Transform>();
+        core::reflection::registerFields<MeshRenderer>();
+        core::reflection::registerFields<RigidBodyComponent>();
+        core::reflection::registerFields<Camera>();
+        core::reflection::registerFields<Light>();
+        return true;
+    }();
+    (void)registered;
+}
+
+// 기본 컴포넌트를 모두 등록한 씬 직렬화기.
+inline core::serialization::SceneSerializer makeSceneSerializer() {
+    registerComponentReflection();
+    core::serialization::SceneSerializer serializer;
+    serializer.registerComponent<Transform>();
+    serializer.registerComponent<MeshRenderer>();
+    serializer.registerComponent<RigidBodyComponent>();
+    serializer.registerComponent<Camera>();
+    serializer.registerComponent<Light>();
+    return serializer;
+}
+
+// TODO [Core-Components-001]:
+// 책임: 기본 컴포넌트 리플렉션 등록 및 씬 직렬화기 구성
+// 요구사항:
+//  - Transform/MeshRenderer/RigidBodyComponent/Camera/Light 필드 메타 등록
+//  - 런타임 포인터/핸들 필드 제외, 에셋 참조는 AssetId로 저장
+//  - 필드 1회 선언(컴파일 타임/런타임 메타 공용)
+//  - 등록 1회 보장
+// 의존성:
+//  - Core/Components
+//  - Reflection/FieldList
+//  - Serialization/SceneSerializer
+// 구현 단계: Phase D
+// 성능 고려사항:
+//  - 등록은 최초 호출 시 1회
+//  - 필드 선언 순서대로 등록해 컬럼 복사 구간 병합 유도
+// 테스트 전략:
+//  - 등록 메타 오프셋/크기 검증 테스트
+//  - 씬 라운드트립 테스트
+
+} // namespace rex
@@ -1,12 +1,12 @@
 #pragma once
 #include "RexMath.h"
 #include "../Graphics/Mesh.h"
+#include "../Graphics/MeshHandle.h"
+#include "Resource/AssetPath.h"
 #include "../Physics/RigidBody.h"
 
 namespace rex {
 
-class Model;
-
 struct Transform {
     Vec3 position{0, 0, 0};
     Vec3 rotation{0, 0, 0};
@@ -23,17 +23,27 @@ struct Transform {
 };
 
 struct MeshRenderer {
-    Model* model = nullptr;
-    Mesh* mesh = nullptr; // Fallback for simple shapes
+    // Streamed asset, resolved through the renderer's MeshLibrary every frame. The owner holds
+    // the library reference (acquire/release); the component only names the mesh.
+    gfx::MeshHandle meshHandle{};
+    // Saved reference to the streamed asset (see MeshLibrary::assetPaths()); the handle itself is
+    // per run and is re-acquired from this after a scene load.
+    core::resource::AssetId meshAsset = 0;
+    // Mesh owned by the application (simple shapes), or the placeholder drawn until meshHandle
+    // is resident.
+    Mesh* mesh = nullptr;
     Vec3 color{1, 1, 1};
     float metallic = 0.0f;
     float roughness = 0.5f;
     float ao = 1.0f;
 
     MeshRenderer() = default;
-    MeshRenderer(Model* mod, Mesh* m, Vec3 col) : model(mod), mesh(m), color(col) {}
-    MeshRenderer(Model* mod, Mesh* m, Vec3 col, float met, float rough, float ambient)
-        : model(mod), mesh(m), color(col), metallic(met), roughness(rough), ao(ambient) {}
+    MeshRenderer(Mesh* m, Vec3 col) : mesh(m), color(col) {}
+    MeshRenderer(Mesh* m, Vec3 col, float met, float rough, float ambient)
+        : mesh(m), color(col), metallic(met), roughness(rough), ao(ambient) {}
+    MeshRenderer(gfx::MeshHandle handle, core::resource::AssetId asset, Mesh* placeholder,
+                 Vec3 col, float met, float rough, float ambient)
+        : meshHandle(handle), meshAsset(asset), mesh(placeholder), color(col), metallic(met), roughness(rough), ao(ambient) {}
 };
 
 struct RigidBodyComponent {
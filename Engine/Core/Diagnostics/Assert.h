@@ -7,7 +7,7 @@
 #define REX_ASSERT(EXPR, FMT, ...)                                              \
     do {                                                                        \
         if (!(EXPR)) {                                                          \
-            ::rex::core::diagnostics::Logger::error("Assertion failed: " FMT, ##__VA_ARGS__); \
+            ::rex::core::diagnostics::Logger::fatal("Assertion failed: " FMT, ##__VA_ARGS__); \
             std::abort();                                                       \
         }                                                                       \
     } while (0)
@@ -0,0 +1,273 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "../Time/FrameTimeHistogram.h"
+#include "Logger.h"
+#include "TraceRecorder.h"
+
+namespace rex::core::diagnostics {
+
+struct FrameWatchdogConfig {
+    // 이 시간(ms)을 넘는 프레임은 덤프한다. 0이면 끈다.
+    double budgetMs = 0.0;
+    // 최근 프레임 p99의 이 배수를 넘는 프레임은 덤프한다. 0이면 끈다.
+    double p99Multiplier = 0.0;
+    // 덤프에 담을 프레임 수(급증 프레임 포함).
+    std::size_t windowFrames = 120;
+    // p99 판정을 시작하기 전 최소 표본 수. 로딩 직후 프레임이 기준을 흐리지 않게 한다.
+    std::size_t warmupFrames = 240;
+    // 덤프 후 이 프레임 수 동안은 판정하지 않는다. 연달아 튀는 구간이 파일을 쏟아내지 않게 한다.
+    std::size_t cooldownFrames = 120;
+    // 세션당 최대 덤프 수. 0이면 무제한.
+    std::size_t maxDumps = 16;
+    std::filesystem::path outputDirectory = "Spikes";
+};
+
+// 최근 windowFrames 프레임의 기록(프레임 시간, 페이즈 시간, 할당기/렌더 카운터)을 링으로 유지하다가
+// 예산이나 p99 배수를 넘는 프레임이 나오면 그 구간의 트레이스를 Chrome trace JSON으로 쓴다.
+// 트레이스 이벤트는 TraceRecorder 링에서 가져오므로, 꺼져 있으면 첫 프레임에서 세션을 시작한다.
+// beginFrame/setCounter/endFrame은 한 스레드(프레임 루프)에서만 호출한다.
+class FrameWatchdog {
+public:
+    static constexpr std::size_t kMaxCounters = 32;
+
+    struct Counter {
+        TraceName name;
+        double value = 0.0;
+    };
+
+    struct FrameRecord {
+        std::uint64_t frameIndex = 0;
+        std::uint64_t beginTicks = 0;
+        std::uint64_t endTicks = 0;
+        double frameMs = 0.0;
+        std::vector<Counter> counters;
+    };
+
+    explicit FrameWatchdog(FrameWatchdogConfig config = {}) {
+        configure(std::move(config));
+    }
+
+    FrameWatchdog(const FrameWatchdog&) = delete;
+    FrameWatchdog& operator=(const FrameWatchdog&) = delete;
+
+    void configure(FrameWatchdogConfig config) {
+        config_ = std::move(config);
+        config_.windowFrames = std::max<std::size_t>(config_.windowFrames, 1);
+        records_.assign(config_.windowFrames, FrameRecord{});
+        for (FrameRecord& record : records_) record.counters.reserve(kMaxCounters);
+        history_ = time::FrameTimeHistogram(1024, 0.05, 250.0);
+        head_ = 0;
+        count_ = 0;
+        cooldown_ = 0;
+        inFrame_ = false;
+    }
+
+    const FrameWatchdogConfig& config() const {
+        return config_;
+    }
+
+    bool enabled() const {
+        return config_.budgetMs > 0.0 || config_.p99Multiplier > 0.0;
+    }
+
+    void beginFrame(std::uint64_t frameIndex) {
+        if (!enabled()) return;
+        TraceRecorder& recorder = TraceRecorder::instance();
+        if (!recorder.enabled()) recorder.start();
+
+        FrameRecord& record = records_[head_];
+        record.frameIndex = frameIndex;
+        record.beginTicks = TraceClock::now();
+        record.endTicks = record.beginTicks;
+        record.frameMs = 0.0;
+        record.counters.clear();
+        frameBegin_ = Clock::now();
+        inFrame_ = true;
+    }
+
+    // 열린 프레임에 값을 기록한다. 같은 이름은 덮어쓴다. 값은 덤프의 metadata에만 실리므로
+    // 타임라인에도 보여야 하면 REX_TRACE_COUNTER를 따로 남긴다.
+    // 프레임 밖에서 호출하거나 kMaxCounters를 넘으면 무시된다.
+    void setCounter(TraceName name, double value) {
+        if (!inFrame_) return;
+        std::vector<Counter>& counters = records_[head_].counters;
+        auto it = std::find_if(counters.begin(), counters.end(), [&](const Counter& counter) {
+            return counter.name.c_str() == name.c_str();
+        });
+        if (it != counters.end()) {
+            it->value = value;
+        } else if (counters.size() < kMaxCounters) {
+            counters.push_back({name, value});
+        }
+    }
+
+    // 프레임을 닫고 판정한다. 덤프를 썼으면 true.
+    bool endFrame() {
+        if (!inFrame_) return false;
+        inFrame_ = false;
+
+        FrameRecord& record = records_[head_];
+        record.endTicks = TraceClock::now();
+        record.frameMs = std::chrono::duration<double, std::milli>(Clock::now() - frameBegin_).count();
+        TraceRecorder::instance().recordComplete("Watchdog Frame", "frame", record.beginTicks, record.endTicks);
+
+        head_ = (head_ + 1) % records_.size();
+        count_ = std::min(count_ + 1, records_.size());
+
+        // 덤프를 쓴 직후 프레임은 파일 쓰기 비용을 포함하므로 기준 분포에서도 뺀다.
+        if (cooldown_ > 0) {
+            --cooldown_;
+            if (!skipNextSample_) history_.add(record.frameMs);
+            skipNextSample_ = false;
+            return false;
+        }
+
+        const double p99Ms = history_.count() >= config_.warmupFrames ? history_.percentile(0.99) : 0.0;
+        history_.add(record.frameMs);
+
+        const char* reason = nullptr;
+        if (config_.budgetMs > 0.0 && record.frameMs > config_.budgetMs) {
+            reason = "budget";
+        } else if (config_.p99Multiplier > 0.0 && p99Ms > 0.0 && record.frameMs > p99Ms * config_.p99Multiplier) {
+            reason = "p99";
+        }
+        if (!reason) return false;
+        if (config_.maxDumps > 0 && dumpCount_ >= config_.maxDumps) return false;
+
+        const bool written = dump(record, reason, p99Ms);
+        cooldown_ = config_.cooldownFrames;
+        skipNextSample_ = true;
+        return written;
+    }
+
+    std::size_t dumpCount() const {
+        return dumpCount_;
+    }
+
+    const std::filesystem::path& lastDumpPath() const {
+        return lastDumpPath_;
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    bool dump(const FrameRecord& spike, const char* reason, double p99Ms) {
+        std::error_code ec;
+        std::filesystem::create_directories(config_.outputDirectory, ec);
+
+        char fileName[96];
+        std::snprintf(fileName, sizeof(fileName), "spike_%06zu_frame%llu_%.1fms.json",
+                      dumpCount_, static_cast<unsigned long long>(spike.frameIndex), spike.frameMs);
+        const std::filesystem::path path = config_.outputDirectory / fileName;
+
+        const std::size_t oldest = (head_ + records_.size() - count_) % records_.size();
+        TraceExportOptions options{};
+        options.beginTicks = records_[oldest].beginTicks;
+        options.endTicks = spike.endTicks;
+        options.metadataJson = metadataJson(spike, reason, p99Ms, oldest);
+
+        TraceRecorder& recorder = TraceRecorder::instance();
+        if (!recorder.exportChromeTrace(path, options)) {
+            Logger::error("Frame watchdog failed to write {}", path.string());
+            return false;
+        }
+        ++dumpCount_;
+        lastDumpPath_ = path;
+        Logger::warn("Frame {} took {:.2f} ms ({}: budget {:.2f} ms, p99 {:.2f} ms); {} frames written to {}",
+                     spike.frameIndex, spike.frameMs, reason, config_.budgetMs, p99Ms, count_, path.string());
+        return true;
+    }
+
+    std::string metadataJson(const FrameRecord& spike, const char* reason, double p99Ms, std::size_t oldest) const {
+        std::string out;
+        out.reserve(256 + count_ * 64 * (1 + spike.counters.size()));
+        out += "{\"watchdog\":{\"reason\":\"";
+        out += reason;
+        out += "\",\"frameIndex\":";
+        out += std::to_string(spike.frameIndex);
+        out += ",\"frameMs\":";
+        appendNumber(out, spike.frameMs);
+        out += ",\"budgetMs\":";
+        appendNumber(out, config_.budgetMs);
+        out += ",\"p99Ms\":";
+        appendNumber(out, p99Ms);
+        out += ",\"p99Multiplier\":";
+        appendNumber(out, config_.p99Multiplier);
+        out += ",\"frames\":[";
+        for (std::size_t i = 0; i < count_; ++i) {
+            const FrameRecord& record = records_[(oldest + i) % records_.size()];
+            if (i > 0) out += ',';
+            out += "\n{\"frame\":";
+            out += std::to_string(record.frameIndex);
+            out += ",\"ms\":";
+            appendNumber(out, record.frameMs);
+            out += ",\"counters\":{";
+            for (std::size_t c = 0; c < record.counters.size(); ++c) {
+                if (c > 0) out += ',';
+                // 카운터 이름은 코드 안의 리터럴/intern 문자열이라 따옴표와 역슬래시만 막는다.
+                out += '"';
+                for (const char* p = record.counters[c].name.c_str(); *p; ++p) {
+                    if (*p == '"' || *p == '\\') out += '\\';
+                    out += *p;
+                }
+                out += "\":";
+                appendNumber(out, record.counters[c].value);
+            }
+            out += "}}";
+        }
+        out += "]}}";
+        return out;
+    }
+
+    static void appendNumber(std::string& out, double value) {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.9g", value);
+        out += buffer;
+    }
+
+    FrameWatchdogConfig config_{};
+    std::vector<FrameRecord> records_;
+    std::size_t head_ = 0;
+    std::size_t count_ = 0;
+    time::FrameTimeHistogram history_{1024};
+    std::size_t cooldown_ = 0;
+    bool skipNextSample_ = false;
+    bool inFrame_ = false;
+    Clock::time_point frameBegin_{};
+    std::size_t dumpCount_ = 0;
+    std::filesystem::path lastDumpPath_;
+};
+
+// TODO [Core-Diagnostics-008]:
+// 책임: 프레임 급증(hitch) 자동 감지 및 직전 구간 트레이스 덤프
+// 요구사항:
+//  - 최근 N프레임 기록 링 유지(프레임 시간, 페이즈 시간, 할당기/렌더 카운터)
+//  - 절대 예산(ms) 또는 롤링 p99 배수 초과 시 덤프
+//  - warm-up, cooldown, 세션당 최대 덤프 수
+//  - Chrome trace JSON + metadata.watchdog 프레임 기록
+// 의존성:
+//  - Diagnostics/TraceRecorder
+//  - Diagnostics/Logger
+//  - Time/FrameTimeHistogram
+// 구현 단계: Phase D
+// 성능 고려사항:
+//  - 평상시 프레임당 할당 0(카운터 벡터 사전 예약)
+//  - 덤프 비용은 급증 프레임 다음 프레임에만 발생, 기준 분포에서 제외
+//  - 트레이스 링 용량이 창보다 작으면 오래된 이벤트가 빠질 수 있음(droppedEvents 확인)
+// 테스트 전략:
+//  - 예산 초과 프레임에서 덤프 1회 및 cooldown 동안 미덤프 테스트
+//  - p99 배수 판정 warm-up 경계 테스트
+//  - 덤프 JSON의 프레임 수/카운터 일관성 테스트
+
+} // namespace rex::core::diagnostics
@@ -0,0 +1,554 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "LogSink.h"
+
+namespace rex::core::diagnostics {
+
+// 문자열류 인자는 바이트를 복사해 두고 포맷 시 string_view로 되살린다.
+template <typename T>
+inline constexpr bool kLogStringArg = std::is_convertible_v<const std::decay_t<T>&, std::string_view>;
+
+// 그 외 인자는 trivially copyable이면 값 그대로 복사해 지연 포맷한다.
+// 하나라도 해당하지 않으면 호출 스레드에서 즉시 포맷한다.
+template <typename T>
+inline constexpr bool kLogDeferrableArg = kLogStringArg<T> || std::is_trivially_copyable_v<std::decay_t<T>>;
+
+template <typename T>
+using LogDecodedArg = std::conditional_t<kLogStringArg<T>, std::string_view, std::decay_t<T>>;
+
+template <typename T>
+struct LogArgCodec {
+    static std::size_t size(const T& value) {
+        if constexpr (kLogStringArg<T>) {
+            return sizeof(std::uint32_t) + std::string_view(value).size();
+        } else {
+            return sizeof(std::decay_t<T>);
+        }
+    }
+
+    static std::byte* encode(std::byte* cursor, const T& value) {
+        if constexpr (kLogStringArg<T>) {
+            const std::string_view text(value);
+            const auto length = static_cast<std::uint32_t>(text.size());
+            std::memcpy(cursor, &length, sizeof(length));
+            std::memcpy(cursor + sizeof(length), text.data(), text.size());
+            return cursor + sizeof(length) + text.size();
+        } else {
+            const std::decay_t<T> copy = value;
+            std::memcpy(cursor, &copy, sizeof(copy));
+            return cursor + sizeof(copy);
+        }
+    }
+
+    static LogDecodedArg<T> decode(const std::byte*& cursor) {
+        if constexpr (kLogStringArg<T>) {
+            std::uint32_t length = 0;
+            std::memcpy(&length, cursor, sizeof(length));
+            const std::string_view text(reinterpret_cast<const char*>(cursor + sizeof(length)), length);
+            cursor += sizeof(length) + length;
+            return text;
+        } else {
+            std::decay_t<T> value;
+            std::memcpy(&value, cursor, sizeof(value));
+            cursor += sizeof(value);
+            return value;
+        }
+    }
+};
+
+using LogFormatFn = void (*)(std::string_view format, const std::byte* payload, std::string& out);
+
+template <typename... Args>
+void formatLogPayload(std::string_view format, const std::byte* payload, std::string& out) {
+    [[maybe_unused]] const std::byte* cursor = payload;
+    // 중괄호 초기화는 왼쪽부터 평가되므로 인코딩 순서대로 디코딩된다.
+    std::tuple<LogDecodedArg<Args>...> values{LogArgCodec<Args>::decode(cursor)...};
+    try {
+        std::apply([&](auto&... decoded) {
+            std::vformat_to(std::back_inserter(out), format, std::make_format_args(decoded...));
+        }, values);
+    } catch (const std::format_error&) {
+        out += "<log format error> ";
+        out += format;
+    }
+}
+
+inline constexpr std::size_t kLogSlotBytes = 256;
+
+struct LogSlotHeader {
+    std::int64_t timestampNs = 0;
+    std::string_view format;
+    // nullptr이면 payload가 포맷이 끝난 텍스트다(heapText면 std::string*).
+    LogFormatFn formatter = nullptr;
+    std::uint32_t payloadSize = 0;
+    LogLevel level = LogLevel::Info;
+    bool heapText = false;
+};
+
+struct LogSlot {
+    LogSlotHeader header{};
+    std::byte payload[kLogSlotBytes - sizeof(LogSlotHeader)];
+};
+
+static_assert(sizeof(LogSlot) == kLogSlotBytes);
+
+// 스레드 하나가 쓰고 로거 스레드가 읽는 SPSC 링.
+class LogThreadQueue {
+public:
+    LogThreadQueue(std::uint32_t threadIndex, std::size_t capacity)
+        : capacity_(std::max<std::size_t>(capacity, 2))
+        , slots_(std::make_unique<LogSlot[]>(capacity_))
+        , threadIndex_(threadIndex) {}
+
+    // 가득 차면 nullptr. 성공하면 commitWrite로 공개한다.
+    LogSlot* beginWrite() {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head - cachedTail_ >= capacity_) {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+            if (head - cachedTail_ >= capacity_) return nullptr;
+        }
+        return &slots_[head % capacity_];
+    }
+
+    void commitWrite() {
+        head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    const LogSlot* peek() const {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == head_.load(std::memory_order_acquire)) return nullptr;
+        return &slots_[tail % capacity_];
+    }
+
+    void pop() {
+        tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    std::size_t size() const {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    }
+
+    std::size_t capacity() const {
+        return capacity_;
+    }
+
+    std::uint32_t threadIndex() const {
+        return threadIndex_;
+    }
+
+private:
+    std::size_t capacity_ = 0;
+    std::unique_ptr<LogSlot[]> slots_;
+    std::uint32_t threadIndex_ = 0;
+    alignas(64) std::atomic<std::size_t> head_{0};
+    std::size_t cachedTail_ = 0;
+    alignas(64) std::atomic<std::size_t> tail_{0};
+};
+
+struct LogBackendStats {
+    std::uint64_t messages = 0;
+    // 큐가 가득 차 생산자가 기다린 횟수.
+    std::uint64_t producerStalls = 0;
+    // 슬롯에 담기지 않아 힙 문자열로 넘긴 메시지 수.
+    std::uint64_t spilledMessages = 0;
+};
+
+// 로그 인자를 스레드별 큐에 캡처하고 백그라운드 스레드에서 포맷/출력한다.
+// 동기 모드에서는 호출 스레드가 포맷하고 싱크에 바로 쓴다.
+class LogBackend {
+public:
+    static constexpr std::size_t kDefaultSlotsPerThread = 512;
+
+    static LogBackend& instance() {
+        static LogBackend backend;
+        return backend;
+    }
+
+    ~LogBackend() {
+        // 정적 소멸 이후에 남는 로그는 동기 경로로 보낸다.
+        stopped_.store(true, std::memory_order_release);
+        stopWorker();
+    }
+
+    LogBackend(const LogBackend&) = delete;
+    LogBackend& operator=(const LogBackend&) = delete;
+
+    void addSink(std::shared_ptr<ILogSink> sink) {
+        if (!sink) return;
+        std::lock_guard<std::mutex> lock(sinkMutex_);
+        sinks_.push_back(std::move(sink));
+    }
+
+    void clearSinks() {
+        flush();
+        std::lock_guard<std::mutex> lock(sinkMutex_);
+        sinks_.clear();
+    }
+
+    void setLevel(LogLevel level) {
+        level_.store(level, std::memory_order_relaxed);
+    }
+
+    LogLevel level() const {
+        return level_.load(std::memory_order_relaxed);
+    }
+
+    bool enabled(LogLevel level) const {
+        return level >= this->level();
+    }
+
+    // 끄면 남은 큐를 비우고 백그라운드 스레드를 멈춘다.
+    void setAsynchronous(bool asynchronous) {
+        asynchronous_.store(asynchronous, std::memory_order_release);
+        if (!asynchronous) stopWorker();
+    }
+
+    bool asynchronous() const {
+        return asynchronous_.load(std::memory_order_acquire);
+    }
+
+    // 이후 처음 로그를 남기는 스레드의 큐 크기.
+    void setSlotsPerThread(std::size_t slots) {
+        slotsPerThread_.store(std::max<std::size_t>(slots, 2), std::memory_order_relaxed);
+    }
+
+    template <typename... Args>
+    void submit(LogLevel level, std::string_view format, Args&&... args) {
+        if (!asynchronous() || stopped_.load(std::memory_order_acquire)) {
+            writeNow(level, currentTimestampNs(), format, std::forward<Args>(args)...);
+            return;
+        }
+        ensureWorker();
+
+        LogThreadQueue& queue = localQueue();
+        LogSlot* slot = queue.beginWrite();
+        while (!slot) {
+            stalls_.fetch_add(1, std::memory_order_relaxed);
+            wake();
+            std::this_thread::yield();
+            slot = queue.beginWrite();
+        }
+
+        LogSlotHeader& header = slot->header;
+        header.timestampNs = currentTimestampNs();
+        header.level = level;
+        header.format = format;
+        header.heapText = false;
+        encodePayload(*slot, format, std::forward<Args>(args)...);
+        queue.commitWrite();
+
+        // Trace/Info는 다음 폴링 주기에 처리되도록 두고, 경고 이상이나 큐 절반 이상이면 즉시 깨운다.
+        if (level >= LogLevel::Warn || queue.size() * 2 >= queue.capacity()) {
+            wake();
+        }
+    }
+
+    // 호출 시점까지 제출된 메시지가 모두 싱크에 쓰이고 flush될 때까지 기다린다.
+    void flush() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!workerStarted_.load(std::memory_order_acquire)) {
+            lock.unlock();
+            std::lock_guard<std::mutex> sinkLock(sinkMutex_);
+            for (auto& sink : sinks_) sink->flush();
+            return;
+        }
+        const std::uint64_t ticket = ++flushRequested_;
+        wakeCv_.notify_one();
+        flushedCv_.wait(lock, [&] {
+            return flushCompleted_ >= ticket || !workerStarted_.load(std::memory_order_acquire);
+        });
+    }
+
+    LogBackendStats stats() const {
+        LogBackendStats out{};
+        out.messages = messages_.load(std::memory_order_relaxed);
+        out.producerStalls = stalls_.load(std::memory_order_relaxed);
+        out.spilledMessages = spilled_.load(std::memory_order_relaxed);
+        return out;
+    }
+
+private:
+    struct PendingMessage {
+        std::int64_t timestampNs = 0;
+        std::size_t offset = 0;
+        std::size_t size = 0;
+        std::uint32_t threadIndex = 0;
+        LogLevel level = LogLevel::Info;
+    };
+
+    LogBackend() {
+        sinks_.push_back(std::make_shared<ConsoleLogSink>());
+    }
+
+    // 큐 잠금 없이 깨운다. 깨우기를 놓쳐도 워커의 폴링 주기 안에 처리된다.
+    void wake() {
+        wakeRequested_.store(true, std::memory_order_release);
+        wakeCv_.notify_one();
+    }
+
+    static std::int64_t currentTimestampNs() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    template <typename... Args>
+    void encodePayload(LogSlot& slot, std::string_view format, Args&&... args) {
+        LogSlotHeader& header = slot.header;
+        if constexpr ((kLogDeferrableArg<Args> && ...)) {
+            const std::size_t bytes = (std::size_t{0} + ... + LogArgCodec<std::decay_t<Args>>::size(args));
+            if (bytes <= sizeof(slot.payload)) {
+                std::byte* cursor = slot.payload;
+                ((cursor = LogArgCodec<std::decay_t<Args>>::encode(cursor, args)), ...);
+                header.formatter = &formatLogPayload<std::decay_t<Args>...>;
+                header.payloadSize = static_cast<std::uint32_t>(bytes);
+                return;
+            }
+        }
+
+        // 지연 포맷할 수 없는 인자이거나 슬롯보다 크면 여기서 포맷한다.
+        std::string text;
+        formatEager(text, format, args...);
+        header.formatter = nullptr;
+        if (text.size() <= sizeof(slot.payload)) {
+            std::memcpy(slot.payload, text.data(), text.size());
+            header.payloadSize = static_cast<std::uint32_t>(text.size());
+        } else {
+            auto* heap = new std::string(std::move(text));
+            std::memcpy(slot.payload, &heap, sizeof(heap));
+            header.payloadSize = 0;
+            header.heapText = true;
+            spilled_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    template <typename... Args>
+    static void formatEager(std::string& out, std::string_view format, Args&... args) {
+        try {
+            std::vformat_to(std::back_inserter(out), format, std::make_format_args(args...));
+        } catch (const std::format_error&) {
+            out += "<log format error> ";
+            out += format;
+        }
+    }
+
+    template <typename... Args>
+    void writeNow(LogLevel level, std::int64_t timestampNs, std::string_view format, Args&&... args) {
+        std::string text;
+        formatEager(text, format, args...);
+        LogMessage message{};
+        message.level = level;
+        message.timestampNs = timestampNs;
+        message.threadIndex = 0;
+        message.text = text;
+        std::lock_guard<std::mutex> lock(sinkMutex_);
+        for (auto& sink : sinks_) {
+            sink->write(message);
+            sink->flush();
+        }
+        messages_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // 스레드가 끝날 때 큐를 백엔드에 돌려준다. 큐는 백엔드가 소유하므로 남은 메시지는 그대로
+    // 출력되고, 다음에 로그를 남기는 새 스레드가 큐를 이어받는다(잠금이 생산자 교대를 순서화).
+    struct LocalQueueLease {
+        LogBackend* backend = nullptr;
+        LogThreadQueue* queue = nullptr;
+
+        ~LocalQueueLease() {
+            if (backend && queue) backend->retireQueue(queue);
+        }
+    };
+
+    LogThreadQueue& localQueue() {
+        thread_local LocalQueueLease lease;
+        if (!lease.queue) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!freeQueues_.empty()) {
+                lease.queue = freeQueues_.back();
+                freeQueues_.pop_back();
+            } else {
+                queues_.push_back(std::make_unique<LogThreadQueue>(
+                    static_cast<std::uint32_t>(queues_.size() + 1),
+                    slotsPerThread_.load(std::memory_order_relaxed)));
+                lease.queue = queues_.back().get();
+            }
+            lease.backend = this;
+        }
+        return *lease.queue;
+    }
+
+    void retireQueue(LogThreadQueue* queue) {
+        // 백엔드 소멸 뒤에 끝나는 스레드는 돌려줄 곳이 없다.
+        if (stopped_.load(std::memory_order_acquire)) return;
+        std::lock_guard<std::mutex> lock(mutex_);
+        freeQueues_.push_back(queue);
+    }
+
+    void ensureWorker() {
+        if (workerStarted_.load(std::memory_order_acquire)) return;
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (worker_.joinable()) return;
+        stopRequested_ = false;
+        worker_ = std::thread([this] { workerMain(); });
+        workerStarted_.store(true, std::memory_order_release);
+    }
+
+    void stopWorker() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!worker_.joinable() || stopRequested_) return;
+            stopRequested_ = true;
+        }
+        wakeCv_.notify_one();
+        worker_.join();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            workerStarted_.store(false, std::memory_order_release);
+            stopRequested_ = false;
+        }
+        flushedCv_.notify_all();
+    }
+
+    void workerMain() {
+        std::vector<LogThreadQueue*> queues;
+        std::vector<PendingMessage> batch;
+        std::string arena;
+
+        while (true) {
+            bool stopping = false;
+            std::uint64_t ticket = 0;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wakeCv_.wait_for(lock, std::chrono::milliseconds(10), [&] {
+                    return stopRequested_ || flushRequested_ != flushCompleted_
+                        || wakeRequested_.load(std::memory_order_acquire);
+                });
+                wakeRequested_.store(false, std::memory_order_relaxed);
+                stopping = stopRequested_;
+                ticket = flushRequested_;
+                queues.clear();
+                for (const auto& queue : queues_) queues.push_back(queue.get());
+            }
+
+            drain(queues, batch, arena);
+
+            if (ticket != 0 || stopping) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                flushCompleted_ = std::max(flushCompleted_, ticket);
+            }
+            flushedCv_.notify_all();
+            if (stopping) break;
+        }
+    }
+
+    // 모든 큐를 비우고 타임스탬프 순으로 싱크에 쓴다. 스레드 안의 순서는 항상 보존되고,
+    // 스레드 사이 순서는 한 배치 안에서만 타임스탬프로 맞춘다.
+    void drain(const std::vector<LogThreadQueue*>& queues, std::vector<PendingMessage>& batch, std::string& arena) {
+        batch.clear();
+        arena.clear();
+        for (LogThreadQueue* queue : queues) {
+            while (const LogSlot* slot = queue->peek()) {
+                const LogSlotHeader& header = slot->header;
+                PendingMessage pending{};
+                pending.timestampNs = header.timestampNs;
+                pending.level = header.level;
+                pending.threadIndex = queue->threadIndex();
+                pending.offset = arena.size();
+                if (header.formatter) {
+                    header.formatter(header.format, slot->payload, arena);
+                } else if (header.heapText) {
+                    std::string* heap = nullptr;
+                    std::memcpy(&heap, slot->payload, sizeof(heap));
+                    arena += *heap;
+                    delete heap;
+                } else {
+                    arena.append(reinterpret_cast<const char*>(slot->payload), header.payloadSize);
+                }
+                pending.size = arena.size() - pending.offset;
+                batch.push_back(pending);
+                queue->pop();
+            }
+        }
+        if (batch.empty()) return;
+
+        std::stable_sort(batch.begin(), batch.end(), [](const PendingMessage& a, const PendingMessage& b) {
+            return a.timestampNs < b.timestampNs;
+        });
+
+        std::lock_guard<std::mutex> lock(sinkMutex_);
+        for (const PendingMessage& pending : batch) {
+            LogMessage message{};
+            message.level = pending.level;
+            message.timestampNs = pending.timestampNs;
+            message.threadIndex = pending.threadIndex;
+            message.text = std::string_view(arena).substr(pending.offset, pending.size);
+            for (auto& sink : sinks_) sink->write(message);
+        }
+        for (auto& sink : sinks_) sink->flush();
+        messages_.fetch_add(batch.size(), std::memory_order_relaxed);
+    }
+
+    std::atomic<LogLevel> level_{LogLevel::Trace};
+    std::atomic<bool> asynchronous_{true};
+    std::atomic<bool> workerStarted_{false};
+    std::atomic<bool> stopped_{false};
+    std::atomic<bool> wakeRequested_{false};
+    std::atomic<std::size_t> slotsPerThread_{kDefaultSlotsPerThread};
+
+    std::mutex mutex_;
+    std::condition_variable wakeCv_;
+    std::condition_variable flushedCv_;
+    std::thread worker_;
+    bool stopRequested_ = false;
+    std::uint64_t flushRequested_ = 0;
+    std::uint64_t flushCompleted_ = 0;
+    std::vector<std::unique_ptr<LogThreadQueue>> queues_;
+    // 끝난 스레드가 돌려준 큐. 짧게 사는 스레드가 많아도 큐 수는 동시 스레드 수로 묶인다.
+    std::vector<LogThreadQueue*> freeQueues_;
+
+    std::mutex sinkMutex_;
+    std::vector<std::shared_ptr<ILogSink>> sinks_;
+
+    std::atomic<std::uint64_t> messages_{0};
+    std::atomic<std::uint64_t> stalls_{0};
+    std::atomic<std::uint64_t> spilled_{0};
+};
+
+// TODO [Core-Diagnostics-007]:
+// 책임: 비동기 로그 백엔드(스레드별 큐 + 백그라운드 포맷/출력)
+// 요구사항:
+//  - 인자 캡처 후 지연 포맷(문자열은 바이트 복사)
+//  - 스레드별 lock-free SPSC 큐(스레드 종료 시 반납, 새 스레드가 재사용)
+//  - flush 동기화, 동기 모드 전환
+//  - 종료 시 잔여 메시지 출력
+// 의존성:
+//  - Diagnostics/LogSink
+// 구현 단계: Phase D
+// 성능 고려사항:
+//  - 호출 경로 할당 0(슬롯 초과/비지연 인자만 예외)
+//  - 백그라운드 스레드의 포맷 버퍼 재사용
+// 테스트 전략:
+//  - 다중 스레드 메시지 유실/순서 테스트
+//  - 큐 포화 시 생산자 대기 테스트
+//  - flush 후 싱크 반영 테스트
+
+} // namespace rex::core::diagnostics
@@ -0,0 +1,226 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace rex::core::diagnostics {
+
+enum class LogLevel {
+    Trace, Info, Warn, Error, Fatal
+};
+
+inline const char* logLevelLabel(LogLevel level) {
+    switch (level) {
+    case LogLevel::Trace: return "[TRACE]";
+    case LogLevel::Info: return "[INFO ]";
+    case LogLevel::Warn: return "[WARN ]";
+    case LogLevel::Error: return "[ERROR]";
+    case LogLevel::Fatal: return "[FATAL]";
+    }
+    return "[?????]";
+}
+
+// 싱크에 전달되는 포맷 완료 메시지. text는 write 호출 동안만 유효하다.
+struct LogMessage {
+    LogLevel level = LogLevel::Info;
+    // system_clock 기준 epoch 나노초.
+    std::int64_t timestampNs = 0;
+    // 로그를 남긴 스레드의 로거 내부 번호(1부터).
+    std::uint32_t threadIndex = 0;
+    std::string_view text;
+};
+
+// 싱크는 로거 백그라운드 스레드(동기 모드에서는 호출 스레드)에서 로거 락 아래 호출된다.
+class ILogSink {
+public:
+    virtual ~ILogSink() = default;
+    virtual void write(const LogMessage& message) = 0;
+    // 배치 하나를 쓴 뒤 호출된다.
+    virtual void flush() {}
+};
+
+// 기존 콘솔 출력 형식("[LEVEL] text", 레벨 색상)을 유지한다.
+class ConsoleLogSink final : public ILogSink {
+public:
+    explicit ConsoleLogSink(bool color = true)
+        : color_(color) {}
+
+    void write(const LogMessage& message) override {
+        line_.clear();
+        if (color_) {
+            line_ += colorCode(message.level);
+            line_ += logLevelLabel(message.level);
+            line_ += "\033[0m";
+        } else {
+            line_ += logLevelLabel(message.level);
+        }
+        line_ += ' ';
+        line_ += message.text;
+        line_ += '\n';
+        std::fwrite(line_.data(), 1, line_.size(), stdout);
+    }
+
+    void flush() override {
+        std::fflush(stdout);
+    }
+
+private:
+    static const char* colorCode(LogLevel level) {
+        switch (level) {
+        case LogLevel::Trace: return "\033[90m";
+        case LogLevel::Info: return "\033[32m";
+        case LogLevel::Warn: return "\033[33m";
+        case LogLevel::Error: return "\033[31m";
+        case LogLevel::Fatal: return "\033[41m";
+        }
+        return "";
+    }
+
+    bool color_ = true;
+    std::string line_;
+};
+
+// 크기 기반 로테이션 파일 싱크. rex.log가 maxBytes를 넘으면 rex.1.log, rex.2.log ... 로 밀어내고
+// maxFiles개를 넘는 가장 오래된 파일은 지운다.
+class RotatingFileLogSink final : public ILogSink {
+public:
+    explicit RotatingFileLogSink(std::filesystem::path path,
+                                 std::uint64_t maxBytes = 8ull * 1024ull * 1024ull,
+                                 std::uint32_t maxFiles = 3)
+        : path_(std::move(path))
+        , maxBytes_(maxBytes)
+        , maxFiles_(maxFiles) {
+        open();
+    }
+
+    ~RotatingFileLogSink() override {
+        close();
+    }
+
+    RotatingFileLogSink(const RotatingFileLogSink&) = delete;
+    RotatingFileLogSink& operator=(const RotatingFileLogSink&) = delete;
+
+    bool isOpen() const {
+        return file_ != nullptr;
+    }
+
+    const std::filesystem::path& path() const {
+        return path_;
+    }
+
+    void write(const LogMessage& message) override {
+        if (!file_) return;
+
+        line_.clear();
+        appendTimestamp(message.timestampNs);
+        line_ += ' ';
+        line_ += logLevelLabel(message.level);
+        line_ += " [T";
+        line_ += std::to_string(message.threadIndex);
+        line_ += "] ";
+        line_ += message.text;
+        line_ += '\n';
+
+        if (maxBytes_ > 0 && size_ > 0 && size_ + line_.size() > maxBytes_) {
+            rotate();
+            if (!file_) return;
+        }
+        size_ += std::fwrite(line_.data(), 1, line_.size(), file_);
+    }
+
+    void flush() override {
+        if (file_) std::fflush(file_);
+    }
+
+private:
+    void open() {
+        std::error_code ec;
+        if (path_.has_parent_path()) std::filesystem::create_directories(path_.parent_path(), ec);
+        file_ = std::fopen(path_.string().c_str(), "ab");
+        size_ = 0;
+        if (file_) {
+            const auto existing = std::filesystem::file_size(path_, ec);
+            size_ = ec ? 0 : existing;
+        }
+    }
+
+    void close() {
+        if (file_) std::fclose(file_);
+        file_ = nullptr;
+    }
+
+    std::filesystem::path rotatedPath(std::uint32_t index) const {
+        std::filesystem::path out = path_;
+        out.replace_filename(path_.stem().string() + "." + std::to_string(index) + path_.extension().string());
+        return out;
+    }
+
+    void rotate() {
+        close();
+        std::error_code ec;
+        if (maxFiles_ == 0) {
+            std::filesystem::remove(path_, ec);
+        } else {
+            std::filesystem::remove(rotatedPath(maxFiles_), ec);
+            for (std::uint32_t i = maxFiles_; i > 1; --i) {
+                std::filesystem::rename(rotatedPath(i - 1), rotatedPath(i), ec);
+            }
+            std::filesystem::rename(path_, rotatedPath(1), ec);
+        }
+        open();
+    }
+
+    // "YYYY-MM-DD HH:MM:SS.mmm"(로컬 시간). 초 단위 문자열은 캐시한다.
+    void appendTimestamp(std::int64_t timestampNs) {
+        const std::int64_t seconds = timestampNs / 1000000000;
+        if (seconds != cachedSecond_) {
+            cachedSecond_ = seconds;
+            const std::time_t time = static_cast<std::time_t>(seconds);
+            std::tm local{};
+#if defined(_WIN32)
+            localtime_s(&local, &time);
+#else
+            localtime_r(&time, &local);
+#endif
+            char buffer[32];
+            std::strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", &local);
+            cachedSecondText_ = buffer;
+        }
+        char millis[8];
+        std::snprintf(millis, sizeof(millis), ".%03d", static_cast<int>((timestampNs / 1000000) % 1000));
+        line_ += cachedSecondText_;
+        line_ += millis;
+    }
+
+    std::filesystem::path path_;
+    std::uint64_t maxBytes_ = 0;
+    std::uint32_t maxFiles_ = 0;
+    std::FILE* file_ = nullptr;
+    std::uint64_t size_ = 0;
+    std::int64_t cachedSecond_ = -1;
+    std::string cachedSecondText_;
+    std::string line_;
+};
+
+// TODO [Core-Diagnostics-006]:
+// 책임: 로그 레벨 및 출력 싱크(콘솔/로테이션 파일) 제공
+// 요구사항:
+//  - 싱크 인터페이스(write/flush)
+//  - 콘솔 색상 출력
+//  - 크기 기반 파일 로테이션
+// 의존성:
+//  - 없음
+// 구현 단계: Phase D
+// 성능 고려사항:
+//  - 라인 버퍼 재사용
+//  - 타임스탬프 초 단위 캐시
+// 테스트 전략:
+//  - 로테이션 경계/파일 개수 테스트
+//  - 출력 형식 테스트
+
+} // namespace rex::core::diagnostics
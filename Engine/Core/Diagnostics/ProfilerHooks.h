@@ -1,65 +1,81 @@
 #pragma once
 
-#include <chrono>
-#include <functional>
-#include <string>
+#include <cstdint>
+
+#include "TraceRecorder.h"
 
 namespace rex::core::diagnostics {
 
-class ProfilerHooks {
+// 스코프 구간을 TraceRecorder에 Complete 이벤트 하나로 기록한다.
+// 중첩은 같은 스레드의 시간 포함 관계로 표현되므로 별도 스택이 필요 없다.
+// 레코더가 꺼져 있으면 시계도 읽지 않는다.
+class ScopedProfile {
 public:
-    using ScopeCallback = std::function<void(const std::string&, double)>;
+#if REX_ENABLE_TRACING
+    explicit ScopedProfile(TraceName name, TraceName category = "rex")
+        : name_(name)
+        , category_(category)
+        , begin_(TraceRecorder::instance().enabled() ? TraceClock::now() : 0) {}
 
-    static void setScopeCallback(ScopeCallback cb) {
-        callback() = std::move(cb);
+    ~ScopedProfile() {
+        if (begin_ == 0) return;
+        TraceRecorder::instance().recordComplete(name_, category_, begin_, TraceClock::now());
     }
+#else
+    explicit ScopedProfile(TraceName, TraceName = "rex") {}
+#endif
 
-    static void emitScope(const std::string& name, double ms) {
-        if (callback()) {
-            callback()(name, ms);
-        }
-    }
+    ScopedProfile(const ScopedProfile&) = delete;
+    ScopedProfile& operator=(const ScopedProfile&) = delete;
 
+#if REX_ENABLE_TRACING
 private:
-    static ScopeCallback& callback() {
-        static ScopeCallback cb{};
-        return cb;
-    }
+    TraceName name_;
+    TraceName category_;
+    std::uint64_t begin_ = 0;
+#endif
 };
 
-class ScopedProfile {
-public:
-    explicit ScopedProfile(std::string name)
-        : name_(std::move(name))
-        , begin_(Clock::now()) {}
+#define REX_TRACE_CONCAT_INNER(a, b) a##b
+#define REX_TRACE_CONCAT(a, b) REX_TRACE_CONCAT_INNER(a, b)
 
-    ~ScopedProfile() {
-        const auto end = Clock::now();
-        const auto elapsed = std::chrono::duration<double, std::milli>(end - begin_);
-        ProfilerHooks::emitScope(name_, elapsed.count());
-    }
-
-private:
-    using Clock = std::chrono::steady_clock;
-    std::string name_;
-    Clock::time_point begin_{};
-};
+#if REX_ENABLE_TRACING
+#define REX_TRACE_SCOPE(NAME) \
+    ::rex::core::diagnostics::ScopedProfile REX_TRACE_CONCAT(rexTraceScope_, __LINE__)(NAME)
+#define REX_TRACE_SCOPE_CAT(CATEGORY, NAME) \
+    ::rex::core::diagnostics::ScopedProfile REX_TRACE_CONCAT(rexTraceScope_, __LINE__)(NAME, CATEGORY)
+#define REX_TRACE_INSTANT(NAME) ::rex::core::diagnostics::TraceRecorder::instance().instant(NAME)
+#define REX_TRACE_COUNTER(NAME, VALUE) \
+    ::rex::core::diagnostics::TraceRecorder::instance().counter(NAME, static_cast<double>(VALUE))
+#define REX_TRACE_FLOW_BEGIN(NAME, ID) ::rex::core::diagnostics::TraceRecorder::instance().flowBegin(NAME, ID)
+#define REX_TRACE_FLOW_STEP(NAME, ID) ::rex::core::diagnostics::TraceRecorder::instance().flowStep(NAME, ID)
+#define REX_TRACE_FLOW_END(NAME, ID) ::rex::core::diagnostics::TraceRecorder::instance().flowEnd(NAME, ID)
+#define REX_TRACE_THREAD_NAME(NAME) ::rex::core::diagnostics::TraceRecorder::instance().setThreadName(NAME)
+#else
+#define REX_TRACE_SCOPE(NAME) ((void)0)
+#define REX_TRACE_SCOPE_CAT(CATEGORY, NAME) ((void)0)
+#define REX_TRACE_INSTANT(NAME) ((void)0)
+#define REX_TRACE_COUNTER(NAME, VALUE) ((void)0)
+#define REX_TRACE_FLOW_BEGIN(NAME, ID) ((void)0)
+#define REX_TRACE_FLOW_STEP(NAME, ID) ((void)0)
+#define REX_TRACE_FLOW_END(NAME, ID) ((void)0)
+#define REX_TRACE_THREAD_NAME(NAME) ((void)0)
+#endif
 
 // TODO [Core-Diagnostics-004]:
-// 책임: 프로파일링 훅 및 scoped 타이머 제공
+// 책임: 트레이스 스코프 및 계측 매크로 제공
 // 요구사항:
-//  - 스코프 단위 시간 측정
-//  - 외부 프로파일러 sink 연동
-//  - 문자열 기반 샘플 식별
+//  - 스코프 단위 시간 측정(중첩 지원)
+//  - 카운터/인스턴트/플로우 매크로
+//  - 정적 문자열/intern 이름 기반 식별
 // 의존성:
-//  - 없음
+//  - Diagnostics/TraceRecorder
 // 구현 단계: Phase D
 // 성능 고려사항:
-//  - 타이머 호출 비용 최소화
-//  - 릴리즈 빌드 비활성화 경로 제공
+//  - 스코프당 할당 0, 시계 읽기 2회
+//  - shipping 빌드에서 매크로 완전 제거
 // 테스트 전략:
-//  - 측정값 범위 테스트
-//  - 콜백 호출 테스트
+//  - 중첩 스코프 포함 관계 테스트
+//  - 비활성 시 이벤트 미기록 테스트
 
 } // namespace rex::core::diagnostics
-
@@ -0,0 +1,530 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define REX_TRACE_HAS_RDTSC 1
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define REX_TRACE_HAS_RDTSC 1
+#else
+#define REX_TRACE_HAS_RDTSC 0
+#endif
+
+#if !REX_TRACE_HAS_RDTSC && defined(__unix__)
+#include <time.h>
+#endif
+
+// shipping 빌드에서는 트레이스 스코프/카운터/플로우 매크로가 모두 사라진다.
+#ifndef REX_ENABLE_TRACING
+#if defined(REX_SHIPPING)
+#define REX_ENABLE_TRACING 0
+#else
+#define REX_ENABLE_TRACING 1
+#endif
+#endif
+
+namespace rex::core::diagnostics {
+
+// 트레이스 이벤트 이름. 문자열 리터럴이거나 TraceRecorder::intern 결과만 허용한다.
+// 이벤트에는 포인터만 저장되므로 이름은 프로세스 수명 동안 유효해야 한다.
+class TraceName {
+public:
+    template <std::size_t N>
+    consteval TraceName(const char (&literal)[N])
+        : value_(literal) {}
+
+    constexpr const char* c_str() const {
+        return value_;
+    }
+
+private:
+    friend class TraceRecorder;
+
+    struct InternedTag {};
+
+    constexpr TraceName(InternedTag, const char* value)
+        : value_(value) {}
+
+    const char* value_ = "";
+};
+
+// 고해상도 타임스탬프. x86은 rdtsc(불변 TSC 가정), 그 외에는 CLOCK_MONOTONIC을 쓴다.
+// 틱 단위는 플랫폼마다 다르며, 나노초 변환은 TraceRecorder가 보정한다.
+struct TraceClock {
+    static std::uint64_t now() {
+#if REX_TRACE_HAS_RDTSC
+        return static_cast<std::uint64_t>(__rdtsc());
+#elif defined(__unix__)
+        timespec ts{};
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<std::uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<std::uint64_t>(ts.tv_nsec);
+#else
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    static std::uint64_t nowNanoseconds() {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+};
+
+enum class TraceEventType : std::uint8_t {
+    Complete,
+    Instant,
+    Counter,
+    FlowBegin,
+    FlowStep,
+    FlowEnd
+};
+
+// Complete는 payload에 지속 틱, Counter는 double 비트, Flow는 flow id를 담는다.
+struct TraceEvent {
+    std::uint64_t ticks = 0;
+    std::uint64_t payload = 0;
+    const char* name = nullptr;
+    const char* category = nullptr;
+    TraceEventType type = TraceEventType::Complete;
+};
+
+// 스레드 하나가 쓰고 익스포터가 읽는 고정 크기 링. 가득 차면 가장 오래된 이벤트를 덮어쓴다.
+// 슬롯은 relaxed atomic 워드라서 기록 중 익스포트해도 데이터 레이스가 아니다(x86에서는 일반 store와 같다).
+class TraceThreadBuffer {
+public:
+    TraceThreadBuffer(std::uint32_t tid, std::size_t capacity)
+        : capacity_(roundUpPow2(capacity))
+        , mask_(capacity_ - 1)
+        , slots_(std::make_unique<Slot[]>(capacity_))
+        , tid_(tid) {}
+
+    // 소유 스레드에서만 호출한다.
+    void push(const TraceEvent& event) {
+        const std::uint64_t head = head_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[head & mask_];
+        slot.ticks.store(event.ticks, std::memory_order_relaxed);
+        slot.payload.store(event.payload, std::memory_order_relaxed);
+        slot.name.store(event.name, std::memory_order_relaxed);
+        slot.category.store(event.category, std::memory_order_relaxed);
+        slot.type.store(event.type, std::memory_order_relaxed);
+        head_.store(head + 1, std::memory_order_release);
+    }
+
+    void setThreadName(const char* name) {
+        threadName_.store(name, std::memory_order_release);
+    }
+
+    const char* threadName() const {
+        return threadName_.load(std::memory_order_acquire);
+    }
+
+    std::uint32_t tid() const {
+        return tid_;
+    }
+
+    std::uint64_t written() const {
+        return head_.load(std::memory_order_acquire);
+    }
+
+    std::size_t capacity() const {
+        return capacity_;
+    }
+
+    // 남아 있는 이벤트를 오래된 순서로 복사한다.
+    // 복사 중 덮어써진 슬롯은 복사 후 head를 다시 읽어 버린다.
+    void snapshot(std::vector<TraceEvent>& out) const {
+        const std::uint64_t head = head_.load(std::memory_order_acquire);
+        const std::uint64_t first = head > capacity_ ? head - capacity_ : 0;
+        const std::size_t base = out.size();
+        for (std::uint64_t i = first; i < head; ++i) {
+            const Slot& slot = slots_[i & mask_];
+            TraceEvent event{};
+            event.ticks = slot.ticks.load(std::memory_order_relaxed);
+            event.payload = slot.payload.load(std::memory_order_relaxed);
+            event.name = slot.name.load(std::memory_order_relaxed);
+            event.category = slot.category.load(std::memory_order_relaxed);
+            event.type = slot.type.load(std::memory_order_relaxed);
+            out.push_back(event);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const std::uint64_t headAfter = head_.load(std::memory_order_relaxed);
+        const std::uint64_t validFirst = headAfter > capacity_ ? headAfter - capacity_ : 0;
+        if (validFirst > first) {
+            const auto stale = static_cast<std::size_t>(std::min(validFirst - first, head - first));
+            out.erase(out.begin() + static_cast<std::ptrdiff_t>(base),
+                      out.begin() + static_cast<std::ptrdiff_t>(base + stale));
+        }
+    }
+
+private:
+    static std::size_t roundUpPow2(std::size_t value) {
+        std::size_t out = 64;
+        while (out < value) out <<= 1;
+        return out;
+    }
+
+    struct Slot {
+        std::atomic<std::uint64_t> ticks{0};
+        std::atomic<std::uint64_t> payload{0};
+        std::atomic<const char*> name{nullptr};
+        std::atomic<const char*> category{nullptr};
+        std::atomic<TraceEventType> type{TraceEventType::Complete};
+    };
+
+    std::size_t capacity_ = 0;
+    std::size_t mask_ = 0;
+    std::unique_ptr<Slot[]> slots_;
+    std::uint32_t tid_ = 0;
+    std::atomic<std::uint64_t> head_{0};
+    std::atomic<const char*> threadName_{nullptr};
+};
+
+// 프로세스 전역 트레이스 레코더.
+// 익스포트 범위. 틱 구간과 겹치는 이벤트만 내보낸다(Complete 이벤트는 일부만 겹쳐도 포함).
+struct TraceExportOptions {
+    std::uint64_t beginTicks = 0;
+    std::uint64_t endTicks = ~std::uint64_t{0};
+    // 비어 있지 않으면 최상위 "metadata" 키의 값으로 그대로 넣는다. 올바른 JSON 값이어야 한다.
+    std::string metadataJson;
+};
+
+// 기록 경로는 스레드별 링에 쓰기만 하며 락이 없다. 락은 스레드 첫 기록 시 링 등록과
+// intern, 익스포트에서만 잡는다.
+class TraceRecorder {
+public:
+    static constexpr std::size_t kDefaultEventsPerThread = 1u << 16;
+
+    static TraceRecorder& instance() {
+        static TraceRecorder recorder;
+        return recorder;
+    }
+
+    TraceRecorder(const TraceRecorder&) = delete;
+    TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+    // 이전 기록은 버리고 새 세션을 시작한다. eventsPerThread는 이후 생성되는 링에 적용된다.
+    void start(std::size_t eventsPerThread = kDefaultEventsPerThread) {
+        eventsPerThread_.store(std::max<std::size_t>(eventsPerThread, 64), std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            originTicks_ = TraceClock::now();
+            originNs_ = TraceClock::nowNanoseconds();
+        }
+        enabled_.store(true, std::memory_order_release);
+    }
+
+    void stop() {
+        enabled_.store(false, std::memory_order_release);
+    }
+
+    bool enabled() const {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    // 동적 이름을 프로세스 수명 동안 유지되는 TraceName으로 바꾼다. 같은 문자열은 같은 포인터를 돌려준다.
+    TraceName intern(std::string_view name) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto it = interned_.emplace(name).first;
+        return TraceName(TraceName::InternedTag{}, it->c_str());
+    }
+
+    // 링이 아직 없으면 이름만 기억해 두었다가 첫 기록 때 붙인다(기록하지 않는 스레드는 링을 만들지 않는다).
+    void setThreadName(TraceName name) {
+        ThreadSlot& slot = threadSlot();
+        slot.name = name.c_str();
+        if (slot.buffer) slot.buffer->setThreadName(slot.name);
+    }
+
+    void recordComplete(TraceName name, TraceName category, std::uint64_t beginTicks, std::uint64_t endTicks) {
+        if (!enabled()) return;
+        push({beginTicks, endTicks - beginTicks, name.c_str(), category.c_str(), TraceEventType::Complete});
+    }
+
+    void instant(TraceName name, TraceName category = "rex") {
+        if (!enabled()) return;
+        push({TraceClock::now(), 0, name.c_str(), category.c_str(), TraceEventType::Instant});
+    }
+
+    void counter(TraceName name, double value) {
+        if (!enabled()) return;
+        std::uint64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        push({TraceClock::now(), bits, name.c_str(), "counter", TraceEventType::Counter});
+    }
+
+    // 플로우 이벤트는 같은 id로 스레드/프레임을 넘는 작업 흐름을 잇는다.
+    // 트레이스 뷰어는 플로우를 감싸는 스코프 안에서 호출된 경우에만 화살표를 그린다.
+    void flowBegin(TraceName name, std::uint64_t id) {
+        if (!enabled()) return;
+        push({TraceClock::now(), id, name.c_str(), "flow", TraceEventType::FlowBegin});
+    }
+
+    void flowStep(TraceName name, std::uint64_t id) {
+        if (!enabled()) return;
+        push({TraceClock::now(), id, name.c_str(), "flow", TraceEventType::FlowStep});
+    }
+
+    void flowEnd(TraceName name, std::uint64_t id) {
+        if (!enabled()) return;
+        push({TraceClock::now(), id, name.c_str(), "flow", TraceEventType::FlowEnd});
+    }
+
+    // Chrome trace event 형식(JSON object). chrome://tracing, Perfetto UI에서 열 수 있다.
+    // 기록 중에도 호출할 수 있지만, 일관된 결과를 원하면 stop() 이후 호출한다.
+    std::string toChromeJson(const TraceExportOptions& options = {}) {
+        std::vector<std::shared_ptr<TraceThreadBuffer>> buffers;
+        std::uint64_t originTicks = 0;
+        std::uint64_t originNs = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            buffers = buffers_;
+            originTicks = originTicks_;
+            originNs = originNs_;
+        }
+
+        const double nsPerTick = calibrateNsPerTick(originTicks, originNs);
+        const auto toMicros = [&](std::uint64_t ticks) {
+            const double deltaTicks = ticks >= originTicks
+                ? static_cast<double>(ticks - originTicks)
+                : -static_cast<double>(originTicks - ticks);
+            return deltaTicks * nsPerTick / 1000.0;
+        };
+
+        std::string out;
+        out.reserve(4096);
+        out += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        bool first = true;
+        const auto beginEvent = [&]() {
+            if (!first) out += ",\n";
+            first = false;
+        };
+
+        std::vector<TraceEvent> events;
+        for (const auto& buffer : buffers) {
+            const std::uint32_t tid = buffer->tid();
+            if (const char* threadName = buffer->threadName()) {
+                beginEvent();
+                out += "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":";
+                out += std::to_string(tid);
+                out += ",\"args\":{\"name\":";
+                appendJsonString(out, threadName);
+                out += "}}";
+            }
+
+            events.clear();
+            buffer->snapshot(events);
+            for (const TraceEvent& event : events) {
+                if (event.ticks < originTicks) continue;
+                if (event.ticks > options.endTicks) continue;
+                const std::uint64_t eventEnd = event.type == TraceEventType::Complete
+                    ? event.ticks + event.payload
+                    : event.ticks;
+                if (eventEnd < options.beginTicks) continue;
+                beginEvent();
+                appendEvent(out, event, tid, toMicros(event.ticks), nsPerTick);
+            }
+        }
+
+        out += ']';
+        if (!options.metadataJson.empty()) {
+            out += ",\n\"metadata\":";
+            out += options.metadataJson;
+        }
+        out += "}\n";
+        return out;
+    }
+
+    bool exportChromeTrace(const std::filesystem::path& path, const TraceExportOptions& options = {}) {
+        const std::string json = toChromeJson(options);
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file) return false;
+        file.write(json.data(), static_cast<std::streamsize>(json.size()));
+        return static_cast<bool>(file);
+    }
+
+    std::size_t threadCount() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return buffers_.size();
+    }
+
+    // 링 덮어쓰기로 잃은 이벤트 수. 0이 아니면 eventsPerThread를 늘린다.
+    std::uint64_t droppedEvents() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::uint64_t dropped = 0;
+        for (const auto& buffer : buffers_) {
+            const std::uint64_t written = buffer->written();
+            if (written > buffer->capacity()) dropped += written - buffer->capacity();
+        }
+        return dropped;
+    }
+
+private:
+    TraceRecorder() {
+        originTicks_ = TraceClock::now();
+        originNs_ = TraceClock::nowNanoseconds();
+    }
+
+    void push(const TraceEvent& event) {
+        localBuffer().push(event);
+    }
+
+    struct ThreadSlot {
+        TraceThreadBuffer* buffer = nullptr;
+        const char* name = nullptr;
+    };
+
+    static ThreadSlot& threadSlot() {
+        thread_local ThreadSlot slot;
+        return slot;
+    }
+
+    TraceThreadBuffer& localBuffer() {
+        ThreadSlot& slot = threadSlot();
+        if (!slot.buffer) {
+            // 링은 레코더가 소유하므로 스레드가 끝난 뒤에도 익스포트할 수 있다.
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto created = std::make_shared<TraceThreadBuffer>(
+                nextTid_++, eventsPerThread_.load(std::memory_order_relaxed));
+            created->setThreadName(slot.name);
+            slot.buffer = created.get();
+            buffers_.push_back(std::move(created));
+        }
+        return *slot.buffer;
+    }
+
+    // rdtsc 틱을 나노초로 바꾸는 비율을 세션 시작 이후 경과 시간으로 구한다.
+    static double calibrateNsPerTick(std::uint64_t originTicks, std::uint64_t originNs) {
+#if REX_TRACE_HAS_RDTSC
+        std::uint64_t nowTicks = TraceClock::now();
+        std::uint64_t nowNs = TraceClock::nowNanoseconds();
+        if (nowNs - originNs < 10000000ull) {
+            // 구간이 너무 짧으면 비율 오차가 크므로 잠시 기다려 보정 구간을 늘린다.
+            const std::uint64_t until = originNs + 10000000ull;
+            while (TraceClock::nowNanoseconds() < until) {}
+            nowTicks = TraceClock::now();
+            nowNs = TraceClock::nowNanoseconds();
+        }
+        if (nowTicks <= originTicks) return 1.0;
+        return static_cast<double>(nowNs - originNs) / static_cast<double>(nowTicks - originTicks);
+#else
+        (void)originTicks;
+        (void)originNs;
+        return 1.0;
+#endif
+    }
+
+    static void appendJsonString(std::string& out, const char* text) {
+        out += '"';
+        for (const char* p = text ? text : ""; *p; ++p) {
+            const char c = *p;
+            if (c == '"' || c == '\\') {
+                out += '\\';
+                out += c;
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                char escaped[8];
+                std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+                out += escaped;
+            } else {
+                out += c;
+            }
+        }
+        out += '"';
+    }
+
+    static void appendNumber(std::string& out, double value) {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.3f", value);
+        out += buffer;
+    }
+
+    static void appendEvent(std::string& out, const TraceEvent& event, std::uint32_t tid,
+                            double tsMicros, double nsPerTick) {
+        static constexpr const char* kPhase[] = {"X", "i", "C", "s", "t", "f"};
+        out += "{\"ph\":\"";
+        out += kPhase[static_cast<std::size_t>(event.type)];
+        out += "\",\"name\":";
+        appendJsonString(out, event.name);
+        out += ",\"cat\":";
+        appendJsonString(out, event.category);
+        out += ",\"pid\":1,\"tid\":";
+        out += std::to_string(tid);
+        out += ",\"ts\":";
+        appendNumber(out, tsMicros);
+
+        switch (event.type) {
+        case TraceEventType::Complete:
+            out += ",\"dur\":";
+            appendNumber(out, static_cast<double>(event.payload) * nsPerTick / 1000.0);
+            break;
+        case TraceEventType::Instant:
+            out += ",\"s\":\"t\"";
+            break;
+        case TraceEventType::Counter: {
+            double value = 0.0;
+            std::memcpy(&value, &event.payload, sizeof(value));
+            out += ",\"args\":{\"value\":";
+            char buffer[32];
+            std::snprintf(buffer, sizeof(buffer), "%.9g", value);
+            out += buffer;
+            out += '}';
+            break;
+        }
+        case TraceEventType::FlowBegin:
+        case TraceEventType::FlowStep:
+        case TraceEventType::FlowEnd:
+            out += ",\"id\":";
+            out += std::to_string(event.payload);
+            // 끝점은 자신을 감싸는 스코프에 붙인다.
+            if (event.type == TraceEventType::FlowEnd) out += ",\"bp\":\"e\"";
+            break;
+        }
+        out += '}';
+    }
+
+    std::atomic<bool> enabled_{false};
+    std::atomic<std::size_t> eventsPerThread_{kDefaultEventsPerThread};
+    mutable std::mutex mutex_;
+    std::vector<std::shared_ptr<TraceThreadBuffer>> buffers_;
+    std::unordered_set<std::string> interned_;
+    std::uint32_t nextTid_ = 1;
+    std::uint64_t originTicks_ = 0;
+    std::uint64_t originNs_ = 0;
+};
+
+// TODO [Core-Diagnostics-005]:
+// 책임: 스레드별 링 버퍼 기반 저오버헤드 트레이스 기록 및 Chrome trace 익스포트
+// 요구사항:
+//  - 정적 문자열/intern 이름만 사용(기록 경로 할당 0)
+//  - rdtsc/CLOCK_MONOTONIC 타임스탬프
+//  - 중첩 스코프, 카운터, 인스턴트, 플로우 이벤트
+//  - Chrome/Perfetto JSON 익스포트(전체 또는 틱 구간 + 메타데이터)
+//  - shipping 빌드 비활성화
+// 의존성:
+//  - 없음
+// 구현 단계: Phase D
+// 성능 고려사항:
+//  - 기록 경로는 atomic 로드 1회 + 링 쓰기
+//  - 링 등록/익스포트만 락 사용
+// 테스트 전략:
+//  - 다중 스레드 기록 후 JSON 유효성 테스트
+//  - 링 오버플로 시 최신 이벤트 보존 테스트
+//  - 틱→시간 보정 오차 테스트
+
+} // namespace rex::core::diagnostics
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <functional>
 #include <unordered_set>
 #include <utility>
@@ -19,6 +20,21 @@ public:
         return id;
     }
 
+    // 직렬화 복원용. 지정한 ID를 살아 있는 엔티티로 만든다. 이미 살아 있으면 false.
+    bool restoreEntity(EntityId id) {
+        if (!alive_.insert(id).second) return false;
+        if (id >= nextId_) nextId_ = id + 1;
+        return true;
+    }
+
+    void reserveEntities(std::size_t count) {
+        alive_.reserve(count);
+    }
+
+    const std::unordered_set<EntityId>& entities() const {
+        return alive_;
+    }
+
     bool isAlive(EntityId id) const {
         return alive_.find(id) != alive_.end();
     }
@@ -102,6 +118,7 @@ public:
     }
 
     template <typename T1, typename T2, typename... TRest, typename Func>
+        requires(sizeof...(TRest) > 0)
     void each(Func&& func) {
         auto* base = storage_.template tryPool<T1>();
         if (!base) return;
@@ -134,6 +151,7 @@ private:
 //  - create/destroy entity API
 //  - add/get/remove/has component API
 //  - query(each) 진입점 제공
+//  - 직렬화용 엔티티 열거/ID 복원
 // 의존성:
 //  - ECS/ComponentStorage
 // 구현 단계: Phase C
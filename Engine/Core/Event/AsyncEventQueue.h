@@ -1,51 +1,270 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <mutex>
-#include <queue>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "EventBus.h"
 
 namespace rex::core::event {
 
+enum class BackpressurePolicy : std::uint8_t {
+    Drop = 0,
+    Coalesce,
+    Block
+};
+
+struct AsyncEventQueueConfig {
+    std::size_t capacity = 8192;
+    BackpressurePolicy policy = BackpressurePolicy::Block;
+    std::size_t flushBatchSize = 256;
+};
+
+// 다중 생산자/단일 소비자(bounded) 링 버퍼. enqueue는 lock-free이며,
+// 큐가 가득 찼을 때만 backpressure 정책에 따라 처리한다. flush는 enqueue 순서(FIFO)대로
+// 발행하고, Coalesce로 넘친 이벤트도 넘칠 당시의 링 위치에 끼워 넣는다.
+// 생성한 스레드를 소비자로 보며, 다른 스레드가 flush하면 setConsumerThread로 알려 준다.
 class AsyncEventQueue {
 public:
-    void enqueue(const EngineEvent& event) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        queue_.push(event);
+    explicit AsyncEventQueue(AsyncEventQueueConfig config = {})
+        : config_(config),
+          consumerThread_(std::this_thread::get_id()) {
+        const std::size_t capacity = std::bit_ceil(std::max<std::size_t>(config_.capacity, 2));
+        config_.capacity = capacity;
+        config_.flushBatchSize = std::max<std::size_t>(config_.flushBatchSize, 1);
+        mask_ = capacity - 1;
+        cells_ = std::make_unique<Cell[]>(capacity);
+        for (std::size_t i = 0; i < capacity; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        batch_.reserve(config_.flushBatchSize);
     }
 
-    void flush(EventBus& bus) {
-        std::queue<EngineEvent> local;
-        {
-            std::lock_guard<std::mutex> lock(mutex_);
-            std::swap(local, queue_);
+    AsyncEventQueue(const AsyncEventQueue&) = delete;
+    AsyncEventQueue& operator=(const AsyncEventQueue&) = delete;
+
+    // coalesceKey는 Coalesce 정책에서만 쓰인다. 0이면 이벤트 타입을 키로 삼는다.
+    // 이벤트가 버려졌을 때만 false를 반환한다.
+    bool enqueue(EngineEvent event, std::uint64_t coalesceKey = 0) {
+        if (tryPush(event)) return true;
+
+        switch (config_.policy) {
+            case BackpressurePolicy::Drop:
+                break;
+            case BackpressurePolicy::Coalesce:
+                if (coalesce(std::move(event), coalesceKey)) return true;
+                break;
+            case BackpressurePolicy::Block:
+                // 소비자 스레드가 스스로를 기다리면 교착되므로 그 경우는 버린다.
+                if (consumerThread_.load(std::memory_order_acquire) == std::this_thread::get_id()) break;
+                while (!tryPush(event)) {
+                    std::this_thread::yield();
+                }
+                return true;
         }
-        while (!local.empty()) {
-            bus.publish(local.front());
-            local.pop();
+
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // Block 정책의 자기 교착 방지에 쓰인다. flush하는 스레드가 바뀌면 flush 전에 호출한다.
+    void setConsumerThread(std::thread::id id = std::this_thread::get_id()) {
+        consumerThread_.store(id, std::memory_order_release);
+    }
+
+    // 호출 시점까지 들어온 이벤트를 move로 꺼내 enqueue 순서대로 발행한다. 링에서는 배치
+    // 단위로 꺼내 생산자에게 슬롯을 빨리 돌려준다. 소비자 스레드 전용.
+    std::size_t flush(EventBus& bus) {
+        setConsumerThread();
+
+        const std::size_t end = enqueuePos_.load(std::memory_order_acquire);
+        takeOverflow(end);
+        std::size_t nextOverflow = 0;
+        std::size_t dispatched = 0;
+        const auto publishOverflowUpTo = [&](std::size_t position) {
+            for (; nextOverflow < overflowBatch_.size() && overflowBatch_[nextOverflow].stamp <= position; ++nextOverflow) {
+                bus.publish(overflowBatch_[nextOverflow].event);
+                ++dispatched;
+            }
+        };
+
+        while (dequeuePos_ != end) {
+            batch_.clear();
+            const std::size_t first = dequeuePos_;
+            while (batch_.size() < config_.flushBatchSize && dequeuePos_ != end) {
+                if (!tryPop()) break;
+            }
+            if (batch_.empty()) break;
+            for (std::size_t i = 0; i < batch_.size(); ++i) {
+                publishOverflowUpTo(first + i);
+                bus.publish(batch_[i]);
+            }
+            dispatched += batch_.size();
         }
+        batch_.clear();
+
+        publishOverflowUpTo(dequeuePos_);
+        restoreOverflow(nextOverflow);
+        return dispatched;
+    }
+
+    std::size_t sizeApprox() const {
+        const std::size_t head = enqueuePos_.load(std::memory_order_relaxed);
+        const std::size_t tail = dequeuePos_;
+        return head >= tail ? head - tail : 0;
+    }
+
+    std::size_t capacity() const {
+        return config_.capacity;
+    }
+
+    BackpressurePolicy policy() const {
+        return config_.policy;
+    }
+
+    std::uint64_t droppedCount() const {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t coalescedCount() const {
+        return coalesced_.load(std::memory_order_relaxed);
     }
 
 private:
-    std::mutex mutex_;
-    std::queue<EngineEvent> queue_;
+    struct Cell {
+        std::atomic<std::size_t> sequence{0};
+        EngineEvent event{};
+    };
+
+    bool tryPush(EngineEvent& event) {
+        std::size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells_[pos & mask_];
+            const std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.event = std::move(event);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // 슬롯을 예약했지만 아직 쓰지 않은 생산자가 있으면 false를 돌려 다음 flush로 미룬다.
+    bool tryPop() {
+        Cell& cell = cells_[dequeuePos_ & mask_];
+        const std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+        if (seq != dequeuePos_ + 1) return false;
+
+        batch_.push_back(std::move(cell.event));
+        cell.event = {};
+        cell.sequence.store(dequeuePos_ + mask_ + 1, std::memory_order_release);
+        ++dequeuePos_;
+        return true;
+    }
+
+    // 넘친 이벤트. stamp는 넘칠 당시의 enqueuePos_로, 그보다 앞선 링 이벤트 뒤에 발행된다.
+    struct OverflowEvent {
+        std::uint64_t key = 0;
+        std::size_t stamp = 0;
+        EngineEvent event{};
+    };
+
+    bool coalesce(EngineEvent event, std::uint64_t key) {
+        if (key == 0) key = static_cast<std::uint64_t>(event.type) + 1;
+
+        std::lock_guard<std::mutex> lock(overflowMutex_);
+        const std::size_t stamp = enqueuePos_.load(std::memory_order_acquire);
+        auto it = overflow_.find(key);
+        if (it != overflow_.end()) {
+            // 최신 값이 최신 위치에서 발행된다.
+            it->second.stamp = stamp;
+            it->second.event = std::move(event);
+            coalesced_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+        if (overflow_.size() >= config_.capacity) return false;
+
+        overflow_.emplace(key, OverflowEvent{key, stamp, std::move(event)});
+        return true;
+    }
+
+    // end까지의 링 이벤트와 함께 발행할 수 있는 넘친 이벤트를 stamp 순으로 꺼낸다.
+    void takeOverflow(std::size_t end) {
+        overflowBatch_.clear();
+        std::lock_guard<std::mutex> lock(overflowMutex_);
+        for (auto it = overflow_.begin(); it != overflow_.end();) {
+            if (it->second.stamp <= end) {
+                overflowBatch_.push_back(std::move(it->second));
+                it = overflow_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        std::sort(overflowBatch_.begin(), overflowBatch_.end(),
+                  [](const OverflowEvent& a, const OverflowEvent& b) { return a.stamp < b.stamp; });
+    }
+
+    // 생산자가 아직 쓰지 않은 슬롯에서 멈췄으면 그 뒤에 와야 할 넘친 이벤트를 되돌린다.
+    // 그 사이 같은 키가 다시 넘쳤으면 새 값이 우선한다.
+    void restoreOverflow(std::size_t published) {
+        if (published < overflowBatch_.size()) {
+            std::lock_guard<std::mutex> lock(overflowMutex_);
+            for (std::size_t i = published; i < overflowBatch_.size(); ++i) {
+                if (!overflow_.try_emplace(overflowBatch_[i].key, std::move(overflowBatch_[i])).second) {
+                    coalesced_.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+        overflowBatch_.clear();
+    }
+
+    AsyncEventQueueConfig config_{};
+    std::size_t mask_ = 0;
+    std::unique_ptr<Cell[]> cells_;
+
+    alignas(64) std::atomic<std::size_t> enqueuePos_{0};
+    alignas(64) std::size_t dequeuePos_ = 0;
+    std::vector<EngineEvent> batch_;
+    std::atomic<std::thread::id> consumerThread_;
+
+    std::atomic<std::uint64_t> dropped_{0};
+    std::atomic<std::uint64_t> coalesced_{0};
+
+    std::mutex overflowMutex_;
+    std::unordered_map<std::uint64_t, OverflowEvent> overflow_;
+    std::vector<OverflowEvent> overflowBatch_;
 };
 
 // TODO [Core-Event-003]:
 // 책임: 비동기 이벤트 큐잉과 프레임 단위 flush 제공
 // 요구사항:
-//  - 멀티스레드 enqueue 안전성
+//  - 멀티스레드 enqueue 안전성(lock-free MPSC)
 //  - 메인 스레드 flush
-//  - 이벤트 폭주(backpressure) 확장 포인트
+//  - 이벤트 폭주(backpressure) 정책: Drop/Coalesce/Block
 // 의존성:
 //  - Event/EventBus
 // 구현 단계: Phase D
 // 성능 고려사항:
-//  - lock 구간 최소화
-//  - flush 시 복사/이동 비용 제어
+//  - enqueue 경로 lock 0 (Coalesce overflow 경로 제외)
+//  - flush 시 move 기반으로 배치 단위로 꺼내 FIFO 순서로 발행
 // 테스트 전략:
 //  - 멀티스레드 enqueue 테스트
 //  - flush 순서 테스트
+//  - 용량 초과 정책별 테스트
 
 } // namespace rex::core::event
-
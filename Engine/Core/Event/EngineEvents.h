@@ -15,7 +15,8 @@ enum class EngineEventType : std::uint16_t {
     ModuleLoaded,
     ModuleUnloaded,
     ResourceLoaded,
-    ResourceUnloaded
+    ResourceUnloaded,
+    Count
 };
 
 using EngineEventPayload = std::variant<std::monostate, bool, std::int64_t, double, std::string>;
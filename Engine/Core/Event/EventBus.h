@@ -1,38 +1,293 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <span>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
 
 #include "EngineEvents.h"
 
 namespace rex::core::event {
 
+namespace detail {
+
+template <typename T, typename TVariant>
+struct PayloadIndex;
+
+template <typename T, typename... Ts>
+struct PayloadIndex<T, std::variant<Ts...>> {
+    static constexpr std::size_t value = []() {
+        constexpr bool matches[] = {std::is_same_v<T, Ts>...};
+        for (std::size_t i = 0; i < sizeof...(Ts); ++i) {
+            if (matches[i]) return i;
+        }
+        return sizeof...(Ts);
+    }();
+};
+
+} // namespace detail
+
 class EventBus {
 public:
     using SubscriptionId = std::uint64_t;
     using Handler = std::function<void(const EngineEvent&)>;
 
+    // 모든 이벤트를 받는 구독.
     SubscriptionId subscribe(Handler handler) {
-        const SubscriptionId id = nextId_++;
-        handlers_[id] = std::move(handler);
-        return id;
+        return addSubscription(kAllChannel, std::move(handler));
+    }
+
+    // 지정한 EngineEventType만 받는 구독.
+    SubscriptionId subscribe(EngineEventType type, Handler handler) {
+        const std::size_t typeIndex = static_cast<std::size_t>(type);
+        if (typeIndex >= kTypeCount) return 0;
+        return addSubscription(typeChannel(typeIndex), std::move(handler));
     }
 
+    // 지정한 타입 중 payload가 TPayload인 이벤트만 받는다.
+    // fn은 (const TPayload&) 또는 (const EngineEvent&, const TPayload&) 시그니처.
+    template <typename TPayload, typename Fn>
+    SubscriptionId subscribe(EngineEventType type, Fn&& fn) {
+        return subscribe(type, makePayloadHandler<TPayload>(std::forward<Fn>(fn)));
+    }
+
+    // 타입과 무관하게 payload가 TPayload인 이벤트만 받는다.
+    template <typename TPayload, typename Fn>
+    SubscriptionId subscribePayload(Fn&& fn) {
+        constexpr std::size_t payloadIndex = detail::PayloadIndex<TPayload, EngineEventPayload>::value;
+        static_assert(payloadIndex < kPayloadCount, "TPayload is not an EngineEventPayload alternative");
+        return addSubscription(payloadChannel(payloadIndex), makePayloadHandler<TPayload>(std::forward<Fn>(fn)));
+    }
+
+    // 디스패치 중 호출해도 안전하다. 슬롯은 디스패치가 끝난 뒤 정리된다.
     void unsubscribe(SubscriptionId id) {
-        handlers_.erase(id);
+        auto it = owners_.find(id);
+        if (it == owners_.end()) return;
+
+        for (auto& slot : channels_[it->second]) {
+            if (slot.id == id) {
+                slot.id = 0;
+                break;
+            }
+        }
+        for (auto& pending : pendingAdds_) {
+            if (pending.slot.id == id) pending.slot.id = 0;
+        }
+        owners_.erase(it);
+
+        if (dispatchDepth_ > 0) {
+            needsCompaction_ = true;
+        } else {
+            compact();
+        }
+    }
+
+    void clear() {
+        for (auto& channel : channels_) {
+            if (dispatchDepth_ > 0) {
+                for (auto& slot : channel) slot.id = 0;
+            } else {
+                channel.clear();
+            }
+        }
+        pendingAdds_.clear();
+        owners_.clear();
+        needsCompaction_ = dispatchDepth_ > 0;
     }
 
     void publish(const EngineEvent& event) const {
-        for (const auto& [id, handler] : handlers_) {
-            (void)id;
-            if (handler) handler(event);
+        DispatchScope scope(*this);
+        dispatchEvent(event);
+    }
+
+    // 타입 구독자에게는 타입별로 묶어 디스패치한다(같은 타입 안에서는 입력 순서 유지).
+    // 전체/payload 구독자는 입력 순서 그대로 받는다. 배치는 한 번만 훑어 타입별로 나눈다.
+    void publishBatch(std::span<const EngineEvent> events) const {
+        if (events.empty()) return;
+        DispatchScope scope(*this);
+
+        // 핸들러 안에서 다시 publishBatch를 불러도 되도록 스크래치를 빌려 쓴다.
+        std::vector<std::uint32_t> order = std::move(batchOrder_);
+        std::array<std::uint32_t, kTypeCount + 1> offsets{};
+        // 예외로 값을 잃은 payload(index() == variant_npos)는 어느 채널에도 보내지 않는다.
+        for (const auto& event : events) {
+            const std::size_t typeIndex = static_cast<std::size_t>(event.type);
+            if (typeIndex < kTypeCount && !event.payload.valueless_by_exception()) ++offsets[typeIndex + 1];
+        }
+        for (std::size_t t = 0; t < kTypeCount; ++t) offsets[t + 1] += offsets[t];
+        order.resize(offsets[kTypeCount]);
+        std::array<std::uint32_t, kTypeCount> cursor{};
+        std::copy_n(offsets.begin(), kTypeCount, cursor.begin());
+        for (std::size_t i = 0; i < events.size(); ++i) {
+            const std::size_t typeIndex = static_cast<std::size_t>(events[i].type);
+            if (typeIndex < kTypeCount && !events[i].payload.valueless_by_exception()) {
+                order[cursor[typeIndex]++] = static_cast<std::uint32_t>(i);
+            }
         }
+
+        for (std::size_t typeIndex = 0; typeIndex < kTypeCount; ++typeIndex) {
+            if (!hasSubscribers(typeChannel(typeIndex))) continue;
+            for (std::uint32_t i = offsets[typeIndex]; i < offsets[typeIndex + 1]; ++i) {
+                dispatch(typeChannel(typeIndex), events[order[i]]);
+            }
+        }
+        batchOrder_ = std::move(order);
+
+        const bool payloadSubscribers = hasPayloadSubscribers();
+        const bool allSubscribers = hasSubscribers(kAllChannel);
+        if (!payloadSubscribers && !allSubscribers) return;
+        for (const auto& event : events) {
+            if (event.payload.valueless_by_exception()) continue;
+            if (payloadSubscribers) dispatch(payloadChannel(event.payload.index()), event);
+            if (allSubscribers) dispatch(kAllChannel, event);
+        }
+    }
+
+    std::size_t subscriberCount(EngineEventType type) const {
+        const std::size_t typeIndex = static_cast<std::size_t>(type);
+        if (typeIndex >= kTypeCount) return 0;
+        return liveCount(typeChannel(typeIndex));
+    }
+
+    std::size_t subscriberCount() const {
+        return owners_.size();
     }
 
 private:
+    struct Slot {
+        SubscriptionId id = 0;
+        Handler handler{};
+    };
+
+    struct PendingAdd {
+        std::size_t channel = 0;
+        Slot slot{};
+    };
+
+    struct DispatchScope {
+        explicit DispatchScope(const EventBus& bus)
+            : bus_(bus) {
+            ++bus_.dispatchDepth_;
+        }
+
+        ~DispatchScope() {
+            if (--bus_.dispatchDepth_ == 0) {
+                bus_.applyPending();
+            }
+        }
+
+        const EventBus& bus_;
+    };
+
+    static constexpr std::size_t kTypeCount = static_cast<std::size_t>(EngineEventType::Count);
+    static constexpr std::size_t kPayloadCount = std::variant_size_v<EngineEventPayload>;
+    static constexpr std::size_t kAllChannel = 0;
+
+    static constexpr std::size_t typeChannel(std::size_t typeIndex) {
+        return 1 + typeIndex;
+    }
+
+    static constexpr std::size_t payloadChannel(std::size_t payloadIndex) {
+        return 1 + kTypeCount + payloadIndex;
+    }
+
+    template <typename TPayload, typename Fn>
+    static Handler makePayloadHandler(Fn&& fn) {
+        return [fn = std::forward<Fn>(fn)](const EngineEvent& event) {
+            const auto* payload = std::get_if<TPayload>(&event.payload);
+            if (!payload) return;
+            if constexpr (std::is_invocable_v<const Fn&, const EngineEvent&, const TPayload&>) {
+                fn(event, *payload);
+            } else {
+                fn(*payload);
+            }
+        };
+    }
+
+    SubscriptionId addSubscription(std::size_t channel, Handler handler) {
+        if (!handler) return 0;
+        const SubscriptionId id = nextId_++;
+        owners_[id] = channel;
+        if (dispatchDepth_ > 0) {
+            pendingAdds_.push_back({channel, {id, std::move(handler)}});
+        } else {
+            channels_[channel].push_back({id, std::move(handler)});
+        }
+        return id;
+    }
+
+    void dispatchEvent(const EngineEvent& event) const {
+        if (event.payload.valueless_by_exception()) return;
+        const std::size_t typeIndex = static_cast<std::size_t>(event.type);
+        if (typeIndex < kTypeCount) {
+            dispatch(typeChannel(typeIndex), event);
+        }
+        dispatch(payloadChannel(event.payload.index()), event);
+        dispatch(kAllChannel, event);
+    }
+
+    void dispatch(std::size_t channelIndex, const EngineEvent& event) const {
+        // 디스패치 중 추가는 pendingAdds_로 가므로 채널 크기/주소가 고정된다.
+        const auto& channel = channels_[channelIndex];
+        const std::size_t count = channel.size();
+        for (std::size_t i = 0; i < count; ++i) {
+            const Slot& slot = channel[i];
+            if (slot.id != 0 && slot.handler) slot.handler(event);
+        }
+    }
+
+    bool hasSubscribers(std::size_t channelIndex) const {
+        return !channels_[channelIndex].empty();
+    }
+
+    bool hasPayloadSubscribers() const {
+        for (std::size_t i = 0; i < kPayloadCount; ++i) {
+            if (hasSubscribers(payloadChannel(i))) return true;
+        }
+        return false;
+    }
+
+    std::size_t liveCount(std::size_t channelIndex) const {
+        std::size_t count = 0;
+        for (const auto& slot : channels_[channelIndex]) {
+            if (slot.id != 0) ++count;
+        }
+        return count;
+    }
+
+    void applyPending() const {
+        if (needsCompaction_) {
+            compact();
+        }
+        for (auto& pending : pendingAdds_) {
+            if (pending.slot.id == 0) continue;
+            channels_[pending.channel].push_back(std::move(pending.slot));
+        }
+        pendingAdds_.clear();
+    }
+
+    void compact() const {
+        for (auto& channel : channels_) {
+            std::erase_if(channel, [](const Slot& slot) { return slot.id == 0; });
+        }
+        needsCompaction_ = false;
+    }
+
     SubscriptionId nextId_ = 1;
-    std::unordered_map<SubscriptionId, Handler> handlers_;
+    // 발행은 const지만 디스패치가 끝날 때 미뤄 둔 구독 변경을 반영하므로 mutable.
+    mutable std::array<std::vector<Slot>, 1 + kTypeCount + kPayloadCount> channels_{};
+    std::unordered_map<SubscriptionId, std::size_t> owners_;
+    mutable std::vector<PendingAdd> pendingAdds_;
+    mutable std::size_t dispatchDepth_ = 0;
+    mutable bool needsCompaction_ = false;
+    mutable std::vector<std::uint32_t> batchOrder_;
 };
 
 // TODO [Core-Event-002]:
@@ -40,16 +295,18 @@ private:
 // 요구사항:
 //  - subscribe/unsubscribe/publish API
 //  - 핸들러 실패 격리 정책
-//  - 타입 필터링 확장 포인트
+//  - 타입(EngineEventType)/payload 타입별 채널 구독
+//  - 디스패치 중 구독/해지 안전성
+//  - 타입별 배치 디스패치(전체 구독자는 입력 순서)
 // 의존성:
 //  - Event/EngineEvents
 // 구현 단계: Phase D
 // 성능 고려사항:
-//  - publish 경로 O(N) 최적화
-//  - 핸들러 등록/해제 비용 최소화
+//  - publish 시 관심 채널만 순회
+//  - 채널별 연속 배열 유지
 // 테스트 전략:
 //  - 구독/해지 동작 테스트
-//  - 다중 핸들러 호출 테스트
+//  - 디스패치 중 해지/재구독 테스트
+//  - 배치 디스패치 순서 테스트
 
 } // namespace rex::core::event
-
@@ -1,10 +1,18 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <thread>
 
+#include "../Diagnostics/FrameWatchdog.h"
 #include "FrameContext.h"
 #include "PhaseScheduler.h"
+#include "RenderThread.h"
 
 namespace rex::core::execution {
 
@@ -14,12 +22,56 @@ public:
     virtual bool onInit() = 0;
     virtual void onShutdown() = 0;
     virtual bool shouldClose() const = 0;
+
+    // 고정 스텝이 끝난 직후 시뮬레이션 스레드에서 호출된다. Pipelined 모드에서는
+    // 이전 프레임 렌더와 동시에 실행되므로 렌더 스냅샷의 back 버퍼만 채워야 한다.
+    virtual void onBuildSnapshot(const FrameContext& context) { (void)context; }
+
+    // 렌더 페이즈가 돌고 있지 않을 때 호출된다. 스냅샷 back/front 교체 지점.
+    virtual void onPublishSnapshot(const FrameContext& context) { (void)context; }
+
+    // Pipelined 모드에서 렌더 스레드 시작/종료 시 그 스레드 위에서 호출된다.
+    virtual void onRenderThreadBegin() {}
+    virtual void onRenderThreadEnd() {}
+};
+
+enum class EngineLoopMode : std::uint8_t {
+    // 시뮬레이션과 렌더 페이즈를 호출 스레드에서 순서대로 실행한다(결정적).
+    Serial = 0,
+    // 프레임 N의 렌더 페이즈를 전용 스레드에서 돌리는 동안 프레임 N+1 시뮬레이션을 진행한다.
+    Pipelined
 };
 
 struct EngineLoopConfig {
     float fixedDeltaTime = 1.0f / 60.0f;
     float maxFrameTime = 0.1f;
     float timeScale = 1.0f;
+    EngineLoopMode mode = EngineLoopMode::Serial;
+    // true이면 스냅샷 훅과 렌더 페이즈를 건너뛴다(창/GL 없는 서버, 벤치마크).
+    bool headless = false;
+};
+
+struct HeadlessRunReport {
+    static constexpr std::size_t kUpdatePhaseCount = 3;
+
+    std::uint64_t steps = 0;
+    double wallSeconds = 0.0;
+    double stepsPerSecond = 0.0;
+    // PreUpdate/Update/PostUpdate 순서. 해당 페이즈만 돌았다고 가정한 처리량.
+    std::array<double, kUpdatePhaseCount> phaseSeconds{};
+    std::array<double, kUpdatePhaseCount> phaseStepsPerSecond{};
+};
+
+struct HeadlessRunConfig {
+    // 0이면 delegate.shouldClose()가 true가 될 때까지 돈다.
+    std::uint64_t maxSteps = 0;
+    // 0이면 제한 없이 최대 속도로, 양수이면 초당 해당 스텝 수에 맞춰 실행한다.
+    double stepRateHz = 0.0;
+    // 매 스텝 PreUpdate 직전에 호출된다. 스크립트 입력 주입 지점.
+    std::function<void(std::uint64_t step, const FrameContext&)> input;
+    // 0보다 크면 이 간격(초)마다 누적 리포트를 onReport로 전달한다.
+    double reportIntervalSeconds = 0.0;
+    std::function<void(const HeadlessRunReport&)> onReport;
 };
 
 class EngineLoop {
@@ -27,6 +79,16 @@ public:
     explicit EngineLoop(EngineLoopConfig config = {})
         : config_(config) {}
 
+    // shutdown()을 먼저 불러야 delegate가 onRenderThreadEnd/onShutdown을 받는다. 소멸자는 delegate가
+    // 이미 파괴되었을 수 있으므로 렌더 스레드만 멈추고 delegate를 부르지 않는다.
+    ~EngineLoop() {
+        threadDelegate_ = nullptr;
+        renderThread_.stop();
+    }
+
+    EngineLoop(const EngineLoop&) = delete;
+    EngineLoop& operator=(const EngineLoop&) = delete;
+
     bool init(IEngineLoopDelegate& delegate) {
         if (initialized_) return true;
         initialized_ = delegate.onInit();
@@ -35,6 +97,8 @@ public:
 
     void shutdown(IEngineLoopDelegate& delegate) {
         if (!initialized_) return;
+        renderThread_.stop();
+        threadDelegate_ = nullptr;
         delegate.onShutdown();
         initialized_ = false;
     }
@@ -46,31 +110,123 @@ public:
         const float scaledDt = std::clamp(rawDeltaTime, 0.0f, config_.maxFrameTime) * config_.timeScale;
         accumulator_ += scaledDt;
 
+        if (watchdog_) watchdog_->beginFrame(frameIndex_);
+
         FrameContext ctx{};
         ctx.frameIndex = frameIndex_;
         ctx.deltaTime = scaledDt;
         ctx.fixedDeltaTime = config_.fixedDeltaTime;
         ctx.timeScale = config_.timeScale;
 
+        PhaseMilliseconds phaseMs{};
         while (accumulator_ >= config_.fixedDeltaTime) {
-            ctx.interpolationAlpha = 0.0f;
-            scheduler.run(FramePhase::PreUpdate, ctx);
-            scheduler.run(FramePhase::Update, ctx);
-            scheduler.run(FramePhase::PostUpdate, ctx);
+            runFixedStep(scheduler, ctx);
+            addPhaseMilliseconds(scheduler, FramePhase::PreUpdate, FramePhase::PostUpdate, phaseMs);
             accumulator_ -= config_.fixedDeltaTime;
         }
 
+        if (config_.headless) {
+            endWatchdogFrame(phaseMs, FramePhase::PostUpdate);
+            ++frameIndex_;
+            return true;
+        }
+
         ctx.interpolationAlpha = (config_.fixedDeltaTime > 0.0f)
             ? (accumulator_ / config_.fixedDeltaTime)
             : 0.0f;
-        scheduler.run(FramePhase::PreRender, ctx);
-        scheduler.run(FramePhase::Render, ctx);
-        scheduler.run(FramePhase::PostRender, ctx);
+        delegate.onBuildSnapshot(ctx);
+
+        if (config_.mode == EngineLoopMode::Pipelined) {
+            if (!renderThread_.running()) startRenderThread(delegate);
+
+            const auto waitBegin = std::chrono::steady_clock::now();
+            renderThread_.waitIdle();
+            lastRenderWaitSeconds_ = std::chrono::duration<float>(std::chrono::steady_clock::now() - waitBegin).count();
+            // 렌더 스레드가 쉬는 동안 직전 프레임의 렌더 페이즈 시간을 읽는다.
+            addPhaseMilliseconds(scheduler, FramePhase::PreRender, FramePhase::PostRender, phaseMs);
+            if (watchdog_) watchdog_->setCounter("Render wait ms", lastRenderWaitSeconds_ * 1000.0);
+
+            delegate.onPublishSnapshot(ctx);
+            renderScheduler_ = &scheduler;
+            renderThread_.submit(ctx);
+        } else {
+            delegate.onPublishSnapshot(ctx);
+            runRenderPhases(scheduler, ctx);
+            addPhaseMilliseconds(scheduler, FramePhase::PreRender, FramePhase::PostRender, phaseMs);
+        }
 
+        endWatchdogFrame(phaseMs, FramePhase::PostRender);
         ++frameIndex_;
         return true;
     }
 
+    // 창/GL 없이 프레임당 고정 스텝 1회를 반복한다. 벽시계 dt와 timeScale은 쓰지 않으므로
+    // 같은 입력 스크립트에 대해 결과가 결정적이다. 렌더 페이즈는 실행하지 않는다.
+    HeadlessRunReport runHeadless(IEngineLoopDelegate& delegate, PhaseScheduler& scheduler,
+                                  const HeadlessRunConfig& run = {}) {
+        using Clock = std::chrono::steady_clock;
+        HeadlessRunReport report{};
+        if (!initialized_ && !init(delegate)) return report;
+
+        static constexpr std::array<FramePhase, HeadlessRunReport::kUpdatePhaseCount> kPhases{
+            FramePhase::PreUpdate, FramePhase::Update, FramePhase::PostUpdate};
+
+        const auto begin = Clock::now();
+        auto lastReport = begin;
+        const auto stepPeriod = (run.stepRateHz > 0.0)
+            ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / run.stepRateHz))
+            : Clock::duration::zero();
+        auto nextStep = begin;
+
+        auto finalize = [&](Clock::time_point now) {
+            report.wallSeconds = std::chrono::duration<double>(now - begin).count();
+            report.stepsPerSecond = report.wallSeconds > 0.0 ? double(report.steps) / report.wallSeconds : 0.0;
+            for (std::size_t i = 0; i < kPhases.size(); ++i) {
+                report.phaseStepsPerSecond[i] = report.phaseSeconds[i] > 0.0
+                    ? double(report.steps) / report.phaseSeconds[i]
+                    : 0.0;
+            }
+        };
+
+        while ((run.maxSteps == 0 || report.steps < run.maxSteps) && !delegate.shouldClose()) {
+            if (stepPeriod > Clock::duration::zero()) {
+                std::this_thread::sleep_until(nextStep);
+                nextStep += stepPeriod;
+            }
+
+            FrameContext ctx{};
+            ctx.frameIndex = frameIndex_;
+            ctx.deltaTime = config_.fixedDeltaTime;
+            ctx.fixedDeltaTime = config_.fixedDeltaTime;
+            ctx.timeScale = 1.0f;
+
+            if (watchdog_) watchdog_->beginFrame(frameIndex_);
+            if (run.input) run.input(report.steps, ctx);
+            runFixedStep(scheduler, ctx);
+            PhaseMilliseconds phaseMs{};
+            addPhaseMilliseconds(scheduler, FramePhase::PreUpdate, FramePhase::PostUpdate, phaseMs);
+            for (std::size_t i = 0; i < kPhases.size(); ++i) {
+                report.phaseSeconds[i] += phaseMs[static_cast<std::size_t>(kPhases[i])] * 0.001;
+            }
+            endWatchdogFrame(phaseMs, FramePhase::PostUpdate);
+
+            ++report.steps;
+            ++frameIndex_;
+
+            if (run.reportIntervalSeconds > 0.0) {
+                const auto now = Clock::now();
+                if (std::chrono::duration<double>(now - lastReport).count() >= run.reportIntervalSeconds) {
+                    lastReport = now;
+                    finalize(now);
+                    if (run.onReport) run.onReport(report);
+                }
+            }
+        }
+
+        finalize(Clock::now());
+        return report;
+    }
+
     std::uint64_t frameIndex() const {
         return frameIndex_;
     }
@@ -79,11 +235,79 @@ public:
         return config_;
     }
 
+    // 진행 중인 렌더 프레임이 끝날 때까지 기다린다. 렌더가 읽는 데이터를
+    // 시뮬레이션 스레드에서 직접 바꿔야 할 때 호출한다. Serial 모드에서는 no-op.
+    void waitForRender() {
+        if (renderThread_.running()) renderThread_.waitIdle();
+    }
+
+    // 직전 프레임에서 시뮬레이션 스레드가 렌더 완료를 기다린 시간.
+    // 0에 가까우면 시뮬레이션이 병목, 크면 렌더가 병목이다.
+    float lastRenderWaitSeconds() const {
+        return lastRenderWaitSeconds_;
+    }
+
+    // runFrame/runHeadless가 프레임마다 워치독 프레임을 열고 닫으며 페이즈 시간을 카운터로 남긴다.
+    // 다른 카운터는 델리게이트 훅이나 페이즈 콜백 안에서 setCounter로 추가한다. nullptr이면 해제.
+    void setWatchdog(diagnostics::FrameWatchdog* watchdog) {
+        watchdog_ = watchdog;
+    }
+
 private:
+    using PhaseMilliseconds = std::array<double, static_cast<std::size_t>(FramePhase::Count)>;
+
+    // 워치독 카운터 이름. FramePhase 순서.
+    static constexpr std::array<diagnostics::TraceName, static_cast<std::size_t>(FramePhase::Count)> kPhaseCounterNames{
+        "PreUpdate ms", "Update ms", "PostUpdate ms", "PreRender ms", "Render ms", "PostRender ms"};
+
+    static void addPhaseMilliseconds(const PhaseScheduler& scheduler, FramePhase first, FramePhase last,
+                                     PhaseMilliseconds& out) {
+        for (auto i = static_cast<std::size_t>(first); i <= static_cast<std::size_t>(last); ++i) {
+            out[i] += scheduler.lastPhaseMilliseconds(static_cast<FramePhase>(i));
+        }
+    }
+
+    void endWatchdogFrame(const PhaseMilliseconds& phaseMs, FramePhase last) {
+        if (!watchdog_) return;
+        for (std::size_t i = 0; i <= static_cast<std::size_t>(last); ++i) {
+            watchdog_->setCounter(kPhaseCounterNames[i], phaseMs[i]);
+        }
+        watchdog_->endFrame();
+    }
+
+    static void runFixedStep(PhaseScheduler& scheduler, FrameContext& ctx) {
+        ctx.interpolationAlpha = 0.0f;
+        scheduler.run(FramePhase::PreUpdate, ctx);
+        scheduler.run(FramePhase::Update, ctx);
+        scheduler.run(FramePhase::PostUpdate, ctx);
+    }
+
+    static void runRenderPhases(PhaseScheduler& scheduler, const FrameContext& ctx) {
+        scheduler.run(FramePhase::PreRender, ctx);
+        scheduler.run(FramePhase::Render, ctx);
+        scheduler.run(FramePhase::PostRender, ctx);
+    }
+
+    // 스레드 콜백은 delegate 참조 대신 threadDelegate_를 거친다. 소멸자가 비우면 onEnd는 아무것도 부르지 않는다.
+    void startRenderThread(IEngineLoopDelegate& delegate) {
+        threadDelegate_ = &delegate;
+        renderThread_.start(
+            [this](const FrameContext& ctx) { runRenderPhases(*renderScheduler_, ctx); },
+            [this] { if (IEngineLoopDelegate* d = threadDelegate_.load()) d->onRenderThreadBegin(); },
+            [this] { if (IEngineLoopDelegate* d = threadDelegate_.load()) d->onRenderThreadEnd(); });
+    }
+
     EngineLoopConfig config_{};
     bool initialized_ = false;
+    std::atomic<IEngineLoopDelegate*> threadDelegate_{nullptr};
     std::uint64_t frameIndex_ = 0;
     float accumulator_ = 0.0f;
+    float lastRenderWaitSeconds_ = 0.0f;
+
+    // renderScheduler_는 submit 전에 기록되고 렌더 스레드는 submit 이후에만 읽는다.
+    PhaseScheduler* renderScheduler_ = nullptr;
+    RenderThread renderThread_;
+    diagnostics::FrameWatchdog* watchdog_ = nullptr;
 };
 
 // TODO [Core-Execution-003]:
@@ -92,9 +316,14 @@ private:
 //  - init/update/render/shutdown 수명주기
 //  - fixed timestep accumulator
 //  - phase scheduler 연동
+//  - Serial/Pipelined 실행 모드(시뮬레이션 N+1 / 렌더 N 중첩)
+//  - headless 실행(무제한/고정 레이트, 스크립트 입력, 페이즈별 steps/sec)
+//  - 프레임 워치독 훅(프레임 경계, 페이즈 시간 카운터)
 // 의존성:
+//  - Diagnostics/FrameWatchdog
 //  - Execution/FrameContext
 //  - Execution/PhaseScheduler
+//  - Execution/RenderThread
 // 구현 단계: Phase A
 // 성능 고려사항:
 //  - 프레임당 불필요 할당 0
@@ -102,6 +331,7 @@ private:
 // 테스트 전략:
 //  - fixed step 회귀 테스트
 //  - 종료 조건(shouldClose) 테스트
+//  - Serial/Pipelined 모드 페이즈 호출 횟수 동등성 테스트
 
 } // namespace rex::core::execution
 
@@ -1,54 +1,402 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <chrono>
+#include <condition_variable>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
 #include <vector>
 
+#include "../Diagnostics/ProfilerHooks.h"
+#include "../Job/ThreadPool.h"
 #include "FrameContext.h"
 
 namespace rex::core::execution {
 
+enum class CallbackThreading : std::uint8_t {
+    // run()을 호출한 스레드에서 실행한다. 워커의 AnyThread 콜백과는 겹칠 수 있다.
+    MainThread = 0,
+    // 잡 시스템 워커에서 다른 콜백과 동시에 실행해도 안전하다.
+    AnyThread,
+    // 다른 콜백이 하나도 실행 중이지 않을 때 호출 스레드에서 단독 실행한다.
+    Exclusive
+};
+
+enum class PhaseExecution : std::uint8_t {
+    // 등록 순서를 tie-break로 쓰는 고정 위상 정렬 순서로 한 스레드에서 실행(결정적).
+    Serial = 0,
+    // 의존성이 풀린 콜백을 잡 시스템에서 동시에 실행한다.
+    Parallel
+};
+
+struct PhaseCallbackDesc {
+    // 같은 페이즈의 before/after에서 참조하는 이름. 비어 있으면 참조할 수 없다.
+    std::string name;
+    // 이 콜백보다 먼저 끝나야 하는 콜백 이름.
+    std::vector<std::string> after;
+    // 이 콜백이 끝난 뒤에 시작해야 하는 콜백 이름.
+    std::vector<std::string> before;
+    CallbackThreading threading = CallbackThreading::MainThread;
+};
+
+struct PhaseCallbackTiming {
+    const std::string* name = nullptr;
+    double milliseconds = 0.0;
+};
+
 class PhaseScheduler {
 public:
     using Callback = std::function<void(const FrameContext&)>;
+    using CallbackId = std::uint32_t;
+
+    static constexpr CallbackId kInvalidCallback = 0;
 
-    void registerPhaseCallback(FramePhase phase, Callback callback) {
-        callbacks_[static_cast<std::size_t>(phase)].push_back(std::move(callback));
+    // 이름/의존성 없이 등록된 콜백은 MainThread로 취급되어 등록 순서대로 실행된다.
+    CallbackId registerPhaseCallback(FramePhase phase, Callback callback) {
+        return registerPhaseCallback(phase, PhaseCallbackDesc{}, std::move(callback));
+    }
+
+    // 페이즈 실행 중 등록/해제는 지원하지 않는다.
+    CallbackId registerPhaseCallback(FramePhase phase, PhaseCallbackDesc desc, Callback callback) {
+        PhasePlan& plan = plans_[static_cast<std::size_t>(phase)];
+        Node node{};
+        node.id = nextCallbackId_++;
+        node.profileName = std::string(phaseName(phase)) + "/"
+            + (desc.name.empty() ? "callback#" + std::to_string(node.id) : desc.name);
+        node.traceName = diagnostics::TraceRecorder::instance().intern(node.profileName);
+        node.desc = std::move(desc);
+        node.callback = std::move(callback);
+        plan.nodes.push_back(std::move(node));
+        plan.dirty = true;
+        return plan.nodes.back().id;
+    }
+
+    bool unregisterPhaseCallback(CallbackId id) {
+        for (auto& plan : plans_) {
+            auto it = std::find_if(plan.nodes.begin(), plan.nodes.end(), [id](const Node& node) {
+                return node.id == id;
+            });
+            if (it == plan.nodes.end()) continue;
+            plan.nodes.erase(it);
+            plan.dirty = true;
+            return true;
+        }
+        return false;
     }
 
     void clear() {
-        for (auto& list : callbacks_) {
-            list.clear();
+        for (auto& plan : plans_) {
+            plan = PhasePlan{};
         }
     }
 
+    // pool이 nullptr이면 Parallel 모드여도 Serial로 실행한다.
+    void setJobSystem(job::ThreadPool* pool) {
+        pool_ = pool;
+    }
+
+    void setExecution(PhaseExecution execution) {
+        execution_ = execution;
+    }
+
+    PhaseExecution execution() const {
+        return execution_;
+    }
+
+    // 0 이하이면 예산 검사를 하지 않는다.
+    void setPhaseBudget(FramePhase phase, double milliseconds) {
+        plans_[static_cast<std::size_t>(phase)].budgetMs = milliseconds;
+    }
+
     void run(FramePhase phase, const FrameContext& context) {
-        auto& list = callbacks_[static_cast<std::size_t>(phase)];
-        for (auto& cb : list) {
-            if (cb) cb(context);
+        PhasePlan& plan = plans_[static_cast<std::size_t>(phase)];
+        if (plan.nodes.empty()) {
+            plan.lastPhaseMs = 0.0;
+            return;
+        }
+        if (plan.dirty) rebuild(plan);
+
+        const auto begin = Clock::now();
+        if (execution_ == PhaseExecution::Parallel && pool_ && pool_->workerCount() > 0 && plan.nodes.size() > 1) {
+            runParallel(plan, context);
+        } else {
+            for (const std::uint32_t index : plan.order) {
+                invoke(plan, index, context);
+            }
+        }
+        plan.lastPhaseMs = std::chrono::duration<double, std::milli>(Clock::now() - begin).count();
+
+        if (plan.budgetMs > 0.0 && plan.lastPhaseMs > plan.budgetMs) {
+            ++plan.budgetOverruns;
+        }
+    }
+
+    // 직전 run의 콜백별 소요 시간(ms). 직렬 실행 순서로 정렬되어 있다.
+    std::vector<PhaseCallbackTiming> lastTimings(FramePhase phase) const {
+        const PhasePlan& plan = plans_[static_cast<std::size_t>(phase)];
+        std::vector<PhaseCallbackTiming> out;
+        if (plan.dirty) return out;
+        out.reserve(plan.order.size());
+        for (const std::uint32_t index : plan.order) {
+            out.push_back({&plan.nodes[index].profileName, plan.timingsMs[index]});
+        }
+        return out;
+    }
+
+    double lastPhaseMilliseconds(FramePhase phase) const {
+        return plans_[static_cast<std::size_t>(phase)].lastPhaseMs;
+    }
+
+    std::uint64_t budgetOverruns(FramePhase phase) const {
+        return plans_[static_cast<std::size_t>(phase)].budgetOverruns;
+    }
+
+    // 순환 의존이 있으면 해당 페이즈는 의존성을 무시하고 등록 순서대로 직렬 실행된다.
+    bool hasDependencyCycle(FramePhase phase) {
+        PhasePlan& plan = plans_[static_cast<std::size_t>(phase)];
+        if (plan.dirty) rebuild(plan);
+        return plan.hasCycle;
+    }
+
+    static const char* phaseName(FramePhase phase) {
+        switch (phase) {
+            case FramePhase::PreUpdate: return "PreUpdate";
+            case FramePhase::Update: return "Update";
+            case FramePhase::PostUpdate: return "PostUpdate";
+            case FramePhase::PreRender: return "PreRender";
+            case FramePhase::Render: return "Render";
+            case FramePhase::PostRender: return "PostRender";
+            case FramePhase::Count: break;
         }
+        return "Unknown";
     }
 
 private:
-    std::array<std::vector<Callback>, static_cast<std::size_t>(FramePhase::Count)> callbacks_{};
+    using Clock = std::chrono::steady_clock;
+
+    struct Node {
+        CallbackId id = kInvalidCallback;
+        PhaseCallbackDesc desc{};
+        std::string profileName;
+        diagnostics::TraceName traceName = "callback";
+        Callback callback;
+    };
+
+    // runParallel 스크래치와 워커 완료 통지. 페이즈마다 따로 두어 파이프라인 모드에서 렌더
+    // 스레드의 렌더 페이즈와 시뮬레이션 스레드의 업데이트 페이즈가 동시에 실행돼도 섞이지 않는다.
+    // 프레임마다 재사용해 할당을 피한다.
+    struct ParallelState {
+        std::vector<std::uint32_t> remaining;
+        std::vector<std::uint32_t> ready;
+        std::vector<std::uint32_t> mainQueue;
+        std::vector<std::uint32_t> exclusiveQueue;
+        std::vector<std::uint32_t> finished;
+        std::mutex mutex;
+        std::condition_variable cv;
+    };
+
+    struct PhasePlan {
+        std::vector<Node> nodes;
+        std::vector<std::uint32_t> order;
+        std::vector<std::vector<std::uint32_t>> successors;
+        std::vector<std::uint32_t> predecessorCount;
+        std::vector<double> timingsMs;
+        bool dirty = true;
+        bool hasCycle = false;
+        double budgetMs = 0.0;
+        double lastPhaseMs = 0.0;
+        std::uint64_t budgetOverruns = 0;
+        std::unique_ptr<ParallelState> parallel;
+    };
+
+    static void invoke(PhasePlan& plan, std::uint32_t index, const FrameContext& context) {
+        Node& node = plan.nodes[index];
+        const auto begin = Clock::now();
+        {
+            diagnostics::ScopedProfile scope(node.traceName, "phase");
+            if (node.callback) node.callback(context);
+        }
+        plan.timingsMs[index] = std::chrono::duration<double, std::milli>(Clock::now() - begin).count();
+    }
+
+    static void rebuild(PhasePlan& plan) {
+        const std::size_t count = plan.nodes.size();
+        plan.successors.assign(count, {});
+        plan.predecessorCount.assign(count, 0);
+        plan.timingsMs.assign(count, 0.0);
+        plan.order.clear();
+        plan.order.reserve(count);
+
+        auto findByName = [&](const std::string& name) -> std::size_t {
+            if (name.empty()) return count;
+            for (std::size_t i = 0; i < count; ++i) {
+                if (plan.nodes[i].desc.name == name) return i;
+            }
+            return count;
+        };
+        auto addEdge = [&](std::size_t from, std::size_t to) {
+            if (from == to || from >= count || to >= count) return;
+            auto& list = plan.successors[from];
+            if (std::find(list.begin(), list.end(), static_cast<std::uint32_t>(to)) != list.end()) return;
+            list.push_back(static_cast<std::uint32_t>(to));
+            ++plan.predecessorCount[to];
+        };
+
+        // 알 수 없는 이름은 무시한다(선택적 시스템이 빠진 구성 허용).
+        for (std::size_t i = 0; i < count; ++i) {
+            for (const auto& name : plan.nodes[i].desc.after) addEdge(findByName(name), i);
+            for (const auto& name : plan.nodes[i].desc.before) addEdge(i, findByName(name));
+        }
+
+        // Kahn 위상 정렬. 준비된 노드 중 등록 순서가 가장 빠른 것을 먼저 꺼내 결정성을 보장한다.
+        std::vector<std::uint32_t> remaining = plan.predecessorCount;
+        std::vector<bool> emitted(count, false);
+        while (plan.order.size() < count) {
+            std::size_t next = count;
+            for (std::size_t i = 0; i < count; ++i) {
+                if (!emitted[i] && remaining[i] == 0) {
+                    next = i;
+                    break;
+                }
+            }
+            if (next == count) break;
+            emitted[next] = true;
+            plan.order.push_back(static_cast<std::uint32_t>(next));
+            for (const std::uint32_t succ : plan.successors[next]) --remaining[succ];
+        }
+
+        plan.hasCycle = plan.order.size() < count;
+        if (plan.hasCycle) {
+            // 순환이 있으면 페이즈 전체를 등록 순서 체인으로 되돌려 직렬 실행한다.
+            plan.order.clear();
+            for (std::size_t i = 0; i < count; ++i) {
+                plan.order.push_back(static_cast<std::uint32_t>(i));
+                plan.successors[i].clear();
+                if (i + 1 < count) plan.successors[i].push_back(static_cast<std::uint32_t>(i + 1));
+                plan.predecessorCount[i] = (i == 0) ? 0 : 1;
+            }
+        }
+
+        plan.dirty = false;
+    }
+
+    // 의존성 카운트는 호출 스레드가 관리하고, 워커는 끝난 노드 인덱스만 돌려준다.
+    void runParallel(PhasePlan& plan, const FrameContext& context) {
+        if (!plan.parallel) plan.parallel = std::make_unique<ParallelState>();
+        ParallelState& state = *plan.parallel;
+        const std::size_t count = plan.nodes.size();
+        state.remaining.assign(plan.predecessorCount.begin(), plan.predecessorCount.end());
+        state.ready.clear();
+        state.mainQueue.clear();
+        state.exclusiveQueue.clear();
+        for (const std::uint32_t index : plan.order) {
+            if (state.remaining[index] == 0) state.ready.push_back(index);
+        }
+
+        std::size_t completedCount = 0;
+        std::size_t inFlight = 0;
+
+        auto complete = [&](std::uint32_t index) {
+            ++completedCount;
+            for (const std::uint32_t succ : plan.successors[index]) {
+                if (--state.remaining[succ] == 0) state.ready.push_back(succ);
+            }
+        };
+
+        while (completedCount < count) {
+            {
+                std::lock_guard<std::mutex> lock(state.mutex);
+                for (const std::uint32_t index : state.finished) {
+                    --inFlight;
+                    complete(index);
+                }
+                state.finished.clear();
+            }
+
+            // 준비된 AnyThread 노드는 워커로 보낸다. 다른 일이 전혀 없으면 호출 스레드가 직접 실행한다.
+            for (const std::uint32_t index : state.ready) {
+                switch (plan.nodes[index].desc.threading) {
+                    case CallbackThreading::MainThread:
+                        state.mainQueue.push_back(index);
+                        break;
+                    case CallbackThreading::Exclusive:
+                        state.exclusiveQueue.push_back(index);
+                        break;
+                    case CallbackThreading::AnyThread: {
+                        const bool alone = state.ready.size() == 1 && inFlight == 0 && state.mainQueue.empty();
+                        if (alone) {
+                            state.mainQueue.push_back(index);
+                            break;
+                        }
+                        ++inFlight;
+                        pool_->submit([&state, &plan, &context, index] {
+                            invoke(plan, index, context);
+                            // 잠금 안에서 깨워야 run()이 먼저 반환해 state가 사라지는(clear) 경합이 없다.
+                            std::lock_guard<std::mutex> lock(state.mutex);
+                            state.finished.push_back(index);
+                            state.cv.notify_one();
+                        });
+                        break;
+                    }
+                }
+            }
+            state.ready.clear();
+
+            if (!state.mainQueue.empty()) {
+                const std::uint32_t index = state.mainQueue.front();
+                state.mainQueue.erase(state.mainQueue.begin());
+                invoke(plan, index, context);
+                complete(index);
+                continue;
+            }
+
+            if (!state.exclusiveQueue.empty() && inFlight == 0) {
+                const std::uint32_t index = state.exclusiveQueue.front();
+                state.exclusiveQueue.erase(state.exclusiveQueue.begin());
+                invoke(plan, index, context);
+                complete(index);
+                continue;
+            }
+
+            if (inFlight == 0) break;
+
+            std::unique_lock<std::mutex> lock(state.mutex);
+            state.cv.wait(lock, [&state] { return !state.finished.empty(); });
+        }
+    }
+
+    std::array<PhasePlan, static_cast<std::size_t>(FramePhase::Count)> plans_{};
+    CallbackId nextCallbackId_ = 1;
+    PhaseExecution execution_ = PhaseExecution::Serial;
+    job::ThreadPool* pool_ = nullptr;
 };
 
 // TODO [Core-Execution-002]:
 // 책임: 페이즈별 콜백 실행 순서 제어
 // 요구사항:
 //  - phase callback 등록/해제
-//  - 페이즈별 결정적 실행 순서
-//  - 런타임 도중 등록 확장 포인트
+//  - 페이즈별 결정적 실행 순서(Serial)
+//  - before/after 의존성과 스레드 안전성 특성 선언
+//  - 독립 콜백 잡 시스템 병렬 실행(Parallel)
+//  - 콜백별 소요 시간 프로파일러 기록/페이즈 예산 검사
 // 의존성:
 //  - Execution/FrameContext
+//  - Job/ThreadPool
+//  - Diagnostics/ProfilerHooks
 // 구현 단계: Phase A
 // 성능 고려사항:
-//  - 콜백 디스패치 오버헤드 최소화
-//  - 불필요한 동적 할당 감소
+//  - 의존 그래프는 등록 변경 시에만 재구성
+//  - 실행 스크래치 재사용으로 프레임당 할당 최소화(페이즈별, 서로 다른 스레드에서 동시 실행 가능)
 // 테스트 전략:
 //  - 실행 순서 고정 테스트
 //  - 빈 페이즈 처리 테스트
+//  - 의존성 준수/순환 감지 테스트
+//  - Parallel/Serial 결과 동등성 테스트
 
 } // namespace rex::core::execution
-
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace rex::core::execution {
+
+// 시뮬레이션이 쓰는 back 버퍼와 렌더가 읽는 front 버퍼로 나뉜 이중 버퍼.
+// back()은 시뮬레이션 스레드 전용이고, publish()는 렌더 스레드가 front를
+// 읽고 있지 않을 때(EngineLoop의 onPublishSnapshot 시점)에만 호출해야 한다.
+template <typename TSnapshot>
+class RenderSnapshotBuffer {
+public:
+    TSnapshot& back() {
+        return buffers_[backIndex_];
+    }
+
+    const TSnapshot& back() const {
+        return buffers_[backIndex_];
+    }
+
+    TSnapshot& front() {
+        return buffers_[backIndex_ ^ 1u];
+    }
+
+    const TSnapshot& front() const {
+        return buffers_[backIndex_ ^ 1u];
+    }
+
+    void publish() {
+        backIndex_ ^= 1u;
+        ++version_;
+    }
+
+    // publish 횟수. 렌더 쪽에서 새 스냅샷 여부를 판단할 때 쓴다.
+    std::uint64_t version() const {
+        return version_;
+    }
+
+private:
+    std::array<TSnapshot, 2> buffers_{};
+    std::uint32_t backIndex_ = 0;
+    std::uint64_t version_ = 0;
+};
+
+// TODO [Core-Execution-004]:
+// 책임: 시뮬레이션/렌더 파이프라이닝용 렌더 스냅샷 이중 버퍼 제공
+// 요구사항:
+//  - back(쓰기)/front(읽기) 분리
+//  - 프레임 경계 publish
+//  - 스냅샷 버전 관측
+// 의존성:
+//  - 없음
+// 구현 단계: Phase D
+// 성능 고려사항:
+//  - publish는 인덱스 교체만 수행(복사 0)
+//  - 버퍼 재사용으로 프레임당 할당 최소화
+// 테스트 전략:
+//  - publish 후 front/back 교체 테스트
+//  - 버전 증가 테스트
+
+} // namespace rex::core::execution
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "FrameContext.h"
+
+namespace rex::core::execution {
+
+// 한 번에 한 프레임만 받아 처리하는 전용 렌더 스레드.
+// submit은 이전 프레임이 끝날 때까지 기다리므로 in-flight 프레임은 최대 1개다.
+class RenderThread {
+public:
+    using FrameCallback = std::function<void(const FrameContext&)>;
+    using ThreadCallback = std::function<void()>;
+
+    RenderThread() = default;
+
+    ~RenderThread() {
+        stop();
+    }
+
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+
+    // onBegin/onEnd는 렌더 스레드 위에서 호출된다(GL 컨텍스트 바인딩/해제 등).
+    bool start(FrameCallback onFrame, ThreadCallback onBegin = {}, ThreadCallback onEnd = {}) {
+        if (thread_.joinable() || !onFrame) return false;
+
+        onFrame_ = std::move(onFrame);
+        onBegin_ = std::move(onBegin);
+        onEnd_ = std::move(onEnd);
+        hasWork_ = false;
+        stopRequested_ = false;
+        thread_ = std::thread([this] { threadMain(); });
+        return true;
+    }
+
+    // 남은 프레임을 마저 처리한 뒤 스레드를 종료한다.
+    void stop() {
+        if (!thread_.joinable()) return;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopRequested_ = true;
+        }
+        workCv_.notify_one();
+        thread_.join();
+    }
+
+    void submit(const FrameContext& context) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        idleCv_.wait(lock, [this] { return !hasWork_; });
+        pending_ = context;
+        hasWork_ = true;
+        lock.unlock();
+        workCv_.notify_one();
+    }
+
+    void waitIdle() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        idleCv_.wait(lock, [this] { return !hasWork_; });
+    }
+
+    bool running() const {
+        return thread_.joinable();
+    }
+
+    std::uint64_t framesRendered() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return framesRendered_;
+    }
+
+private:
+    void threadMain() {
+        if (onBegin_) onBegin_();
+
+        while (true) {
+            FrameContext context{};
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                workCv_.wait(lock, [this] { return hasWork_ || stopRequested_; });
+                if (!hasWork_) break;
+                context = pending_;
+            }
+
+            onFrame_(context);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                hasWork_ = false;
+                ++framesRendered_;
+            }
+            idleCv_.notify_all();
+        }
+
+        if (onEnd_) onEnd_();
+    }
+
+    FrameCallback onFrame_;
+    ThreadCallback onBegin_;
+    ThreadCallback onEnd_;
+
+    std::thread thread_;
+    mutable std::mutex mutex_;
+    std::condition_variable workCv_;
+    std::condition_variable idleCv_;
+    FrameContext pending_{};
+    bool hasWork_ = false;
+    bool stopRequested_ = false;
+    std::uint64_t framesRendered_ = 0;
+};
+
+// TODO [Core-Execution-005]:
+// 책임: 시뮬레이션과 겹쳐 실행되는 전용 렌더 스레드 제공
+// 요구사항:
+//  - 프레임 단위 submit/waitIdle
+//  - 스레드 진입/종료 훅(GL 컨텍스트 소유권 이전)
+//  - 종료 시 대기 중인 프레임 처리
+// 의존성:
+//  - Execution/FrameContext
+// 구현 단계: Phase D
+// 성능 고려사항:
+//  - in-flight 프레임 1개로 입력 지연 상한 고정
+//  - 프레임당 동적 할당 0
+// 테스트 전략:
+//  - submit/waitIdle 순서 테스트
+//  - stop 시 잔여 프레임 처리 테스트
+
+} // namespace rex::core::execution
@@ -13,6 +13,8 @@
 #include <utility>
 #include <vector>
 
+#include "../Diagnostics/ProfilerHooks.h"
+
 namespace rex::core::job {
 
 class ThreadPool {
@@ -73,6 +75,7 @@ public:
 
 private:
     void workerLoop() {
+        REX_TRACE_THREAD_NAME("Worker");
         while (true) {
             std::function<void()> task;
             {
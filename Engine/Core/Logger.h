@@ -1,36 +1,78 @@
 #pragma once
-#include <string>
-#include <iostream>
 #include <format>
-#include <chrono>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+#include "Diagnostics/LogBackend.h"
+
+// 이 레벨 미만의 로그 호출은 컴파일 단계에서 제거된다(0=Trace ... 4=Fatal).
+#ifndef REX_LOG_MIN_LEVEL
+#if defined(NDEBUG) || defined(REX_SHIPPING)
+#define REX_LOG_MIN_LEVEL 1
+#else
+#define REX_LOG_MIN_LEVEL 0
+#endif
+#endif
 
 namespace rex {
 
-enum class LogLevel {
-    Trace, Info, Warn, Error, Fatal
-};
+using LogLevel = core::diagnostics::LogLevel;
 
 class Logger {
 public:
+    static constexpr LogLevel kMinLevel = static_cast<LogLevel>(REX_LOG_MIN_LEVEL);
+
+    // 컴파일 타임 최소 레벨과 런타임 레벨을 모두 통과하면 true.
+    static bool enabled(LogLevel level) {
+        return level >= kMinLevel && core::diagnostics::LogBackend::instance().enabled(level);
+    }
+
     template<typename... Args>
-    static void log(LogLevel level, std::string_view fmt, Args&&... args) {
-        auto now = std::chrono::system_clock::now();
-        std::string level_str = "";
-        switch(level) {
-            case LogLevel::Trace: level_str = "\033[90m[TRACE]\033[0m"; break;
-            case LogLevel::Info:  level_str = "\033[32m[INFO ]\033[0m"; break;
-            case LogLevel::Warn:  level_str = "\033[33m[WARN ]\033[0m"; break;
-            case LogLevel::Error: level_str = "\033[31m[ERROR]\033[0m"; break;
-            case LogLevel::Fatal: level_str = "\033[41m[FATAL]\033[0m"; break;
+    static void log(LogLevel level, std::format_string<Args...> fmt, Args&&... args) {
+        if (level < kMinLevel) return;
+        auto& backend = core::diagnostics::LogBackend::instance();
+        if (!backend.enabled(level)) return;
+        backend.submit(level, fmt.get(), std::forward<Args>(args)...);
+        if (level == LogLevel::Fatal) backend.flush();
+    }
+
+    template<LogLevel Level, typename... Args>
+    static void logAt(std::format_string<Args...> fmt, Args&&... args) {
+        if constexpr (Level >= kMinLevel) {
+            log(Level, fmt, std::forward<Args>(args)...);
         }
-        
-        std::cout << std::format("{} {}\n", level_str, std::vformat(fmt, std::make_format_args(args...)));
     }
 
-    template<typename... Args> static void trace(std::string_view f, Args&&... a) { log(LogLevel::Trace, f, std::forward<Args>(a)...); }
-    template<typename... Args> static void info(std::string_view f, Args&&... a)  { log(LogLevel::Info, f, std::forward<Args>(a)...); }
-    template<typename... Args> static void warn(std::string_view f, Args&&... a)  { log(LogLevel::Warn, f, std::forward<Args>(a)...); }
-    template<typename... Args> static void error(std::string_view f, Args&&... a) { log(LogLevel::Error, f, std::forward<Args>(a)...); }
+    template<typename... Args> static void trace(std::format_string<Args...> f, Args&&... a) { logAt<LogLevel::Trace>(f, std::forward<Args>(a)...); }
+    template<typename... Args> static void info(std::format_string<Args...> f, Args&&... a)  { logAt<LogLevel::Info>(f, std::forward<Args>(a)...); }
+    template<typename... Args> static void warn(std::format_string<Args...> f, Args&&... a)  { logAt<LogLevel::Warn>(f, std::forward<Args>(a)...); }
+    template<typename... Args> static void error(std::format_string<Args...> f, Args&&... a) { logAt<LogLevel::Error>(f, std::forward<Args>(a)...); }
+    // 큐를 비운 뒤 반환한다(직후 abort해도 메시지가 남는다).
+    template<typename... Args> static void fatal(std::format_string<Args...> f, Args&&... a) { logAt<LogLevel::Fatal>(f, std::forward<Args>(a)...); }
+
+    // 런타임 최소 레벨. 컴파일 타임 REX_LOG_MIN_LEVEL 아래로는 내릴 수 없다.
+    static void setLevel(LogLevel level) { core::diagnostics::LogBackend::instance().setLevel(level); }
+    // false면 호출 스레드에서 바로 포맷/출력한다.
+    static void setAsynchronous(bool asynchronous) { core::diagnostics::LogBackend::instance().setAsynchronous(asynchronous); }
+    static void addSink(std::shared_ptr<core::diagnostics::ILogSink> sink) { core::diagnostics::LogBackend::instance().addSink(std::move(sink)); }
+    static void clearSinks() { core::diagnostics::LogBackend::instance().clearSinks(); }
+    static void flush() { core::diagnostics::LogBackend::instance().flush(); }
 };
 
 }
+
+// Logger::trace는 인자를 평가한 뒤에 걸러진다. 핫 패스에서는 이 매크로를 써서 레벨이 꺼져 있으면
+// 인자 계산까지 건너뛴다. REX_LOG_MIN_LEVEL > 0이면 호출 자체가 사라진다(인자는 사용된 것으로 남아
+// 미사용 경고가 나지 않는다).
+#if REX_LOG_MIN_LEVEL <= 0
+#define REX_LOG_TRACE(...) \
+    do { \
+        if (::rex::Logger::enabled(::rex::LogLevel::Trace)) ::rex::Logger::trace(__VA_ARGS__); \
+    } while (0)
+#else
+#define REX_LOG_TRACE(...) \
+    do { \
+        if (false) ::rex::Logger::trace(__VA_ARGS__); \
+    } while (0)
+#endif
@@ -26,6 +26,10 @@ public:
         backing_->deallocate(ptr, size);
     }
 
+    bool owns(const void* ptr) const override {
+        return backing_ && backing_->owns(ptr);
+    }
+
     void reset() override {
         if (!backing_) return;
         for (auto it = allocations_.rbegin(); it != allocations_.rend(); ++it) {
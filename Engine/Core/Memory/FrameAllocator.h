@@ -26,10 +26,30 @@ public:
         linear_.reset();
     }
 
+    bool owns(const void* ptr) const override {
+        return linear_.owns(ptr);
+    }
+
+    std::size_t marker() const {
+        return linear_.marker();
+    }
+
+    void rewind(std::size_t marker) {
+        linear_.rewind(marker);
+    }
+
     std::size_t usedBytes() const {
         return linear_.usedBytes();
     }
 
+    std::size_t capacityBytes() const {
+        return linear_.capacityBytes();
+    }
+
+    std::size_t highWaterBytes() const {
+        return linear_.highWaterBytes();
+    }
+
 private:
     LinearAllocator linear_;
 };
@@ -10,6 +10,12 @@ public:
     virtual void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t)) = 0;
     virtual void deallocate(void* ptr, std::size_t size = 0) = 0;
     virtual void reset() {}
+
+    // 포인터가 이 할당기에서 나왔는지 판별한다. 판별 수단이 없는 할당기는 true를 돌려준다.
+    virtual bool owns(const void* ptr) const {
+        (void)ptr;
+        return true;
+    }
 };
 
 // TODO [Core-Memory-001]:
@@ -33,6 +33,7 @@ public:
         }
 
         offset_ = alignedOffset + size;
+        highWater_ = std::max(highWater_, offset_);
         return reinterpret_cast<void*>(aligned);
     }
 
@@ -44,6 +45,21 @@ public:
 
     void reset() override {
         offset_ = 0;
+        highWater_ = 0;
+    }
+
+    bool owns(const void* ptr) const override {
+        const auto* p = static_cast<const std::byte*>(ptr);
+        return !buffer_.empty() && p >= buffer_.data() && p < buffer_.data() + buffer_.size();
+    }
+
+    // 스코프 단위 임시 할당을 위해 현재 오프셋을 기록/복원한다.
+    std::size_t marker() const {
+        return offset_;
+    }
+
+    void rewind(std::size_t marker) {
+        offset_ = std::min(marker, offset_);
     }
 
     std::size_t usedBytes() const {
@@ -54,9 +70,15 @@ public:
         return buffer_.size();
     }
 
+    // 마지막 reset 이후 최대 사용량. rewind로 되감은 구간도 포함한다.
+    std::size_t highWaterBytes() const {
+        return highWater_;
+    }
+
 private:
     std::vector<std::byte> buffer_;
     std::size_t offset_ = 0;
+    std::size_t highWater_ = 0;
 };
 
 // TODO [Core-Memory-002]:
@@ -64,6 +86,7 @@ private:
 // 요구사항:
 //  - bump-pointer allocate
 //  - 프레임 단위 reset
+//  - reset 구간 최대 사용량(high-water) 관측
 //  - 개별 deallocate 미지원 정책 명시
 // 의존성:
 //  - Memory/IAllocator
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+
+#include "FrameAllocator.h"
+#include "IAllocator.h"
+
+namespace rex::core::memory {
+
+// IAllocator를 std::pmr 컨테이너에서 쓰기 위한 어댑터.
+// 할당기가 실패하면 upstream으로 넘기고, 그 횟수를 기록한다.
+class AllocatorResource final : public std::pmr::memory_resource {
+public:
+    explicit AllocatorResource(IAllocator* allocator,
+                               std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+        : allocator_(allocator)
+        , upstream_(upstream ? upstream : std::pmr::null_memory_resource()) {}
+
+    AllocatorResource(const AllocatorResource&) = delete;
+    AllocatorResource& operator=(const AllocatorResource&) = delete;
+
+    IAllocator* allocator() const {
+        return allocator_;
+    }
+
+    std::pmr::memory_resource* upstream() const {
+        return upstream_;
+    }
+
+    std::size_t upstreamAllocations() const {
+        return upstreamAllocations_;
+    }
+
+    void resetStats() {
+        upstreamAllocations_ = 0;
+    }
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        if (allocator_) {
+            if (void* ptr = allocator_->allocate(bytes == 0 ? 1 : bytes, alignment)) {
+                return ptr;
+            }
+        }
+        ++upstreamAllocations_;
+        return upstream_->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override {
+        if (!ptr) return;
+        if (allocator_ && allocator_->owns(ptr)) {
+            allocator_->deallocate(ptr, bytes);
+            return;
+        }
+        upstream_->deallocate(ptr, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    IAllocator* allocator_ = nullptr;
+    std::pmr::memory_resource* upstream_ = nullptr;
+    std::size_t upstreamAllocations_ = 0;
+};
+
+// 프레임 경계에서 되감기는 pmr 메모리. 소유자는 beginFrame 전에
+// 이 리소스를 쓰는 컨테이너를 모두 비워(할당 해제) 두어야 한다.
+class FrameMemoryResource {
+public:
+    explicit FrameMemoryResource(std::size_t capacityBytes = 1024 * 1024)
+        : allocator_(capacityBytes)
+        , resource_(&allocator_) {}
+
+    FrameMemoryResource(const FrameMemoryResource&) = delete;
+    FrameMemoryResource& operator=(const FrameMemoryResource&) = delete;
+
+    void beginFrame() {
+        allocator_.beginFrame();
+        resource_.resetStats();
+    }
+
+    std::pmr::memory_resource* resource() {
+        return &resource_;
+    }
+
+    FrameAllocator& allocator() {
+        return allocator_;
+    }
+
+    std::size_t usedBytes() const {
+        return allocator_.usedBytes();
+    }
+
+    std::size_t capacityBytes() const {
+        return allocator_.capacityBytes();
+    }
+
+    // beginFrame 이후 최대 사용량. FrameMemoryScope로 되감긴 임시 할당도 포함한다.
+    std::size_t highWaterBytes() const {
+        return allocator_.highWaterBytes();
+    }
+
+    // 0이 아니면 이번 프레임에 용량이 모자라 전역 힙으로 넘어간 것이다.
+    std::size_t overflowAllocations() const {
+        return resource_.upstreamAllocations();
+    }
+
+private:
+    FrameAllocator allocator_;
+    AllocatorResource resource_;
+};
+
+// 스코프 종료 시 프레임 메모리를 진입 시점으로 되감는다.
+// 스코프 안의 컨테이너보다 먼저 선언해야 나중에 소멸한다.
+class FrameMemoryScope {
+public:
+    explicit FrameMemoryScope(FrameMemoryResource& memory)
+        : allocator_(memory.allocator())
+        , marker_(allocator_.marker()) {}
+
+    ~FrameMemoryScope() {
+        allocator_.rewind(marker_);
+    }
+
+    FrameMemoryScope(const FrameMemoryScope&) = delete;
+    FrameMemoryScope& operator=(const FrameMemoryScope&) = delete;
+
+private:
+    FrameAllocator& allocator_;
+    std::size_t marker_ = 0;
+};
+
+// TODO [Core-Memory-006]:
+// 책임: IAllocator 기반 std::pmr::memory_resource 어댑터 제공
+// 요구사항:
+//  - pmr 컨테이너를 frame/arena 메모리로 구동
+//  - 용량 초과 시 upstream fallback
+//  - fallback 횟수/최대 사용량 관측 API
+// 의존성:
+//  - Memory/IAllocator
+//  - Memory/FrameAllocator
+// 구현 단계: Phase B
+// 성능 고려사항:
+//  - steady-state 프레임 힙 할당 0
+//  - 컨테이너 성장 시 프레임 메모리 낭비 제어
+// 테스트 전략:
+//  - 할당 카운터 기반 zero-allocation 프레임 테스트
+//  - fallback 포인터 해제 경로 테스트
+
+} // namespace rex::core::memory
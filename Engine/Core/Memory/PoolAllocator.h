@@ -33,6 +33,11 @@ public:
         freeList_.push_back(static_cast<std::byte*>(ptr));
     }
 
+    bool owns(const void* ptr) const override {
+        const auto* p = static_cast<const std::byte*>(ptr);
+        return !buffer_.empty() && p >= buffer_.data() && p < buffer_.data() + buffer_.size();
+    }
+
     void reset() override {
         freeList_.clear();
         for (std::size_t i = 0; i < blockCount_; ++i) {
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "IAllocator.h"
+
+namespace rex::core::memory {
+
+// 큰 가상 주소 범위를 예약만 해 두고, bump pointer가 전진할 때 페이지를 커밋하는 선형 할당기.
+// decommitWatermarkBytes가 0이 아니면 reset 시 워터마크 위의 물리 메모리를 반환한다.
+class VirtualLinearAllocator final : public IAllocator {
+public:
+    explicit VirtualLinearAllocator(std::size_t reserveBytes = std::size_t{1} << 30,
+                                    std::size_t decommitWatermarkBytes = 0,
+                                    std::size_t commitGranularityBytes = 64 * 1024)
+        : pageSize_(queryPageSize()) {
+        reserveBytes_ = roundUp(reserveBytes, pageSize_);
+        commitGranularity_ = roundUp(std::max(commitGranularityBytes, pageSize_), pageSize_);
+        decommitWatermark_ = roundUp(decommitWatermarkBytes, pageSize_);
+        base_ = static_cast<std::byte*>(reserveRange(reserveBytes_));
+        if (!base_) reserveBytes_ = 0;
+    }
+
+    ~VirtualLinearAllocator() override {
+        if (base_) releaseRange(base_, reserveBytes_);
+    }
+
+    VirtualLinearAllocator(const VirtualLinearAllocator&) = delete;
+    VirtualLinearAllocator& operator=(const VirtualLinearAllocator&) = delete;
+
+    void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t)) override {
+        if (size == 0 || !base_) return nullptr;
+
+        const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(base_);
+        const std::size_t mask = alignment - 1;
+        const std::uintptr_t aligned = (base + offset_ + mask) & ~static_cast<std::uintptr_t>(mask);
+        const std::size_t alignedOffset = static_cast<std::size_t>(aligned - base);
+        if (alignedOffset > reserveBytes_ || size > reserveBytes_ - alignedOffset) {
+            return nullptr;
+        }
+
+        const std::size_t end = alignedOffset + size;
+        if (end > committed_ && !commitUpTo(end)) {
+            return nullptr;
+        }
+
+        offset_ = end;
+        peak_ = std::max(peak_, offset_);
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    void deallocate(void* ptr, std::size_t size = 0) override {
+        (void)ptr;
+        (void)size;
+        // 선형 할당기는 개별 free를 지원하지 않는다.
+    }
+
+    void reset() override {
+        offset_ = 0;
+        if (decommitWatermark_ != 0 && committed_ > decommitWatermark_) {
+            decommitRange(base_ + decommitWatermark_, committed_ - decommitWatermark_);
+            committed_ = decommitWatermark_;
+        }
+    }
+
+    bool owns(const void* ptr) const override {
+        const auto* p = static_cast<const std::byte*>(ptr);
+        return base_ && p >= base_ && p < base_ + reserveBytes_;
+    }
+
+    std::size_t marker() const {
+        return offset_;
+    }
+
+    void rewind(std::size_t marker) {
+        offset_ = std::min(marker, offset_);
+    }
+
+    std::size_t usedBytes() const {
+        return offset_;
+    }
+
+    std::size_t committedBytes() const {
+        return committed_;
+    }
+
+    std::size_t reservedBytes() const {
+        return reserveBytes_;
+    }
+
+    std::size_t peakBytes() const {
+        return peak_;
+    }
+
+private:
+    static std::size_t roundUp(std::size_t value, std::size_t multiple) {
+        return ((value + multiple - 1) / multiple) * multiple;
+    }
+
+    bool commitUpTo(std::size_t endOffset) {
+        const std::size_t target = std::min(roundUp(endOffset, commitGranularity_), reserveBytes_);
+        if (!commitRange(base_ + committed_, target - committed_)) {
+            return false;
+        }
+        committed_ = target;
+        return true;
+    }
+
+#if defined(_WIN32)
+    static std::size_t queryPageSize() {
+        SYSTEM_INFO info{};
+        GetSystemInfo(&info);
+        return static_cast<std::size_t>(info.dwPageSize);
+    }
+
+    static void* reserveRange(std::size_t bytes) {
+        return VirtualAlloc(nullptr, bytes, MEM_RESERVE, PAGE_NOACCESS);
+    }
+
+    static bool commitRange(std::byte* ptr, std::size_t bytes) {
+        return VirtualAlloc(ptr, bytes, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+    }
+
+    static void decommitRange(std::byte* ptr, std::size_t bytes) {
+        VirtualFree(ptr, bytes, MEM_DECOMMIT);
+    }
+
+    static void releaseRange(std::byte* ptr, std::size_t bytes) {
+        (void)bytes;
+        VirtualFree(ptr, 0, MEM_RELEASE);
+    }
+#else
+    static std::size_t queryPageSize() {
+        const long size = sysconf(_SC_PAGESIZE);
+        return size > 0 ? static_cast<std::size_t>(size) : 4096;
+    }
+
+    static void* reserveRange(std::size_t bytes) {
+        void* ptr = mmap(nullptr, bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        return ptr == MAP_FAILED ? nullptr : ptr;
+    }
+
+    static bool commitRange(std::byte* ptr, std::size_t bytes) {
+        return mprotect(ptr, bytes, PROT_READ | PROT_WRITE) == 0;
+    }
+
+    static void decommitRange(std::byte* ptr, std::size_t bytes) {
+        // 물리 페이지를 먼저 돌려주고, 다시 커밋될 때까지 접근을 막는다.
+        madvise(ptr, bytes, MADV_DONTNEED);
+        mprotect(ptr, bytes, PROT_NONE);
+    }
+
+    static void releaseRange(std::byte* ptr, std::size_t bytes) {
+        munmap(ptr, bytes);
+    }
+#endif
+
+    std::size_t pageSize_ = 4096;
+    std::size_t reserveBytes_ = 0;
+    std::size_t commitGranularity_ = 0;
+    std::size_t decommitWatermark_ = 0;
+    std::byte* base_ = nullptr;
+    std::size_t committed_ = 0;
+    std::size_t offset_ = 0;
+    std::size_t peak_ = 0;
+};
+
+// TODO [Core-Memory-007]:
+// 책임: 가상 메모리 예약 기반 온디맨드 커밋 선형 할당기 제공
+// 요구사항:
+//  - mmap(PROT_NONE) 예약 후 mprotect로 점진 커밋
+//  - reset 시 워터마크 초과분 decommit(madvise)
+//  - 커밋/예약/피크 사용량 관측 API
+// 의존성:
+//  - Memory/IAllocator
+// 구현 단계: Phase B
+// 성능 고려사항:
+//  - 커밋 syscall 빈도를 granularity로 제한
+//  - 스파이크 이후 물리 메모리 점유 해제
+// 테스트 전략:
+//  - 예약 범위 초과 실패 테스트
+//  - 워터마크 decommit 후 재커밋 테스트
+
+} // namespace rex::core::memory
@@ -0,0 +1,669 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define REX_HAS_PREAD 1
+#else
+#include <fstream>
+#define REX_HAS_PREAD 0
+#endif
+
+#if defined(__linux__)
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#define REX_HAS_IO_URING 1
+#else
+#define REX_HAS_IO_URING 0
+#endif
+
+#include "../Diagnostics/Logger.h"
+#include "../Job/ThreadPool.h"
+
+namespace rex::core::platform {
+
+// 비동기 읽기용 읽기 전용 파일 핸들. 요청이 끝날 때까지 살아 있어야 한다.
+class IoFile {
+public:
+    IoFile() = default;
+
+    explicit IoFile(const std::filesystem::path& path) {
+        open(path);
+    }
+
+    ~IoFile() {
+        close();
+    }
+
+    IoFile(const IoFile&) = delete;
+    IoFile& operator=(const IoFile&) = delete;
+
+    IoFile(IoFile&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    IoFile& operator=(IoFile&& other) noexcept {
+        if (this != &other) {
+            close();
+            fd_ = std::exchange(other.fd_, -1);
+            size_ = std::exchange(other.size_, 0);
+            path_ = std::move(other.path_);
+        }
+        return *this;
+    }
+
+    bool open(const std::filesystem::path& path) {
+        close();
+#if REX_HAS_PREAD
+        fd_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd_ < 0) return false;
+        struct stat info{};
+        if (::fstat(fd_, &info) != 0) {
+            close();
+            return false;
+        }
+        size_ = static_cast<std::uint64_t>(info.st_size);
+#else
+        std::error_code ec;
+        size_ = std::filesystem::file_size(path, ec);
+        if (ec) return false;
+        fd_ = 0;
+#endif
+        path_ = path;
+        return true;
+    }
+
+    void close() {
+#if REX_HAS_PREAD
+        if (fd_ >= 0) ::close(fd_);
+#endif
+        fd_ = -1;
+        size_ = 0;
+        path_.clear();
+    }
+
+    bool valid() const {
+        return fd_ >= 0;
+    }
+
+    std::uint64_t size() const {
+        return size_;
+    }
+
+    int handle() const {
+        return fd_;
+    }
+
+    const std::filesystem::path& path() const {
+        return path_;
+    }
+
+private:
+    int fd_ = -1;
+    std::uint64_t size_ = 0;
+    std::filesystem::path path_;
+};
+
+// 높은 우선순위가 항상 먼저 제출된다(엄격 우선순위). 스트리밍 중 화면에 필요한 데이터는 High,
+// 미리 읽기는 Low.
+enum class IoPriority : std::uint8_t {
+    High = 0,
+    Normal,
+    Low
+};
+
+constexpr std::size_t kIoPriorityCount = 3;
+
+struct IoResult {
+    // 읽은 바이트 수. 파일 끝을 만나면 요청보다 작다.
+    std::size_t bytes = 0;
+    // errno 값, 0이면 성공.
+    int error = 0;
+
+    bool ok() const {
+        return error == 0;
+    }
+};
+
+using IoCallback = std::function<void(const IoResult&)>;
+
+struct AsyncIoConfig {
+    // 동시에 커널에 걸려 있는 읽기 수(io_uring 큐 깊이). Low는 이 중 절반까지만 쓴다.
+    std::uint32_t queueDepth = 64;
+    // io_uring을 쓸 수 없을 때 pread를 돌리는 작업 스레드 수.
+    std::size_t fallbackThreads = 4;
+    bool forceFallback = false;
+    // 설정하면 완료 콜백을 이 풀에서 실행한다. 없으면 I/O 스레드에서 바로 실행하므로
+    // 콜백은 짧아야 한다.
+    job::ThreadPool* callbackPool = nullptr;
+};
+
+struct AsyncIoStats {
+    std::uint64_t submitted = 0;
+    std::uint64_t completed = 0;
+    std::uint64_t bytes = 0;
+    // io_uring_enter 호출 수. submitted보다 작으면 그만큼 묶어서 제출한 것이다.
+    std::uint64_t submitCalls = 0;
+    std::uint32_t maxInFlight = 0;
+};
+
+// 호출자 버퍼로 읽는 비동기 파일 I/O. Linux에서는 io_uring(readv, 한 번의 io_uring_enter로
+// 묶음 제출 + 완료 대기)을 I/O 스레드 하나가 돌리고, 쓸 수 없으면 pread 작업 스레드로 대체한다.
+// 버퍼와 IoFile은 완료될 때까지 유효해야 한다. 소멸자는 진행 중인 읽기가 끝나기를 기다리고
+// 아직 제출되지 않은 요청은 ECANCELED로 완료한다.
+class AsyncIo {
+public:
+    explicit AsyncIo(AsyncIoConfig config = {})
+        : config_(config) {
+        config_.queueDepth = std::max<std::uint32_t>(config_.queueDepth, 2);
+#if REX_HAS_IO_URING
+        if (!config_.forceFallback && ring_.setup(config_.queueDepth + 1)) {
+            workers_.emplace_back([this]() {
+                ringLoop();
+            });
+            return;
+        }
+#endif
+        const std::size_t count = std::max<std::size_t>(config_.fallbackThreads, 1);
+        for (std::size_t i = 0; i < count; ++i) {
+            workers_.emplace_back([this]() {
+                workerLoop();
+            });
+        }
+    }
+
+    ~AsyncIo() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopRequested_ = true;
+        }
+        wake();
+        cv_.notify_all();
+        for (auto& worker : workers_) {
+            if (worker.joinable()) worker.join();
+        }
+    }
+
+    AsyncIo(const AsyncIo&) = delete;
+    AsyncIo& operator=(const AsyncIo&) = delete;
+
+    // "io_uring" 또는 "threads".
+    std::string_view backend() const {
+#if REX_HAS_IO_URING
+        if (ring_.valid()) return "io_uring";
+#endif
+        return "threads";
+    }
+
+    // file[offset, offset + buffer.size())를 buffer로 읽는다. 잡에서 get()으로 기다리거나
+    // 다른 future들과 함께 모아 기다릴 수 있다.
+    std::future<IoResult> read(const IoFile& file,
+                               std::uint64_t offset,
+                               std::span<std::byte> buffer,
+                               IoPriority priority = IoPriority::Normal) {
+        auto request = makeRequest(file, offset, buffer, priority);
+        request->wantsFuture = true;
+        std::future<IoResult> future = request->promise.get_future();
+        enqueue(std::move(request));
+        return future;
+    }
+
+    // 완료 시 callback을 부른다(callbackPool이 있으면 그 풀에서).
+    void read(const IoFile& file,
+              std::uint64_t offset,
+              std::span<std::byte> buffer,
+              IoPriority priority,
+              IoCallback callback) {
+        auto request = makeRequest(file, offset, buffer, priority);
+        request->callback = std::move(callback);
+        enqueue(std::move(request));
+    }
+
+    AsyncIoStats stats() const {
+        AsyncIoStats stats;
+        stats.submitted = submitted_.load(std::memory_order_relaxed);
+        stats.completed = completed_.load(std::memory_order_relaxed);
+        stats.bytes = bytes_.load(std::memory_order_relaxed);
+        stats.submitCalls = submitCalls_.load(std::memory_order_relaxed);
+        stats.maxInFlight = maxInFlight_.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+private:
+    struct Request {
+        int fd = -1;
+        std::uint64_t offset = 0;
+        std::byte* data = nullptr;
+        std::size_t length = 0;
+        std::size_t done = 0;
+        IoPriority priority = IoPriority::Normal;
+        IoCallback callback;
+        std::promise<IoResult> promise;
+        bool wantsFuture = false;
+#if REX_HAS_IO_URING
+        iovec vector{};
+#endif
+#if !REX_HAS_PREAD
+        std::filesystem::path path;
+#endif
+    };
+
+    // 한 번의 읽기 길이 상한. 긴 요청은 짧은 읽기와 같은 경로로 이어 읽는다.
+    static constexpr std::size_t kMaxChunk = std::size_t{1} << 30;
+
+    static std::unique_ptr<Request> makeRequest(const IoFile& file,
+                                                std::uint64_t offset,
+                                                std::span<std::byte> buffer,
+                                                IoPriority priority) {
+        auto request = std::make_unique<Request>();
+        request->fd = file.handle();
+        request->offset = offset;
+        request->data = buffer.data();
+        request->length = buffer.size();
+        request->priority = priority;
+#if !REX_HAS_PREAD
+        request->path = file.path();
+#endif
+        return request;
+    }
+
+    void enqueue(std::unique_ptr<Request> request) {
+        submitted_.fetch_add(1, std::memory_order_relaxed);
+        if (request->fd < 0 || request->length == 0) {
+            const int error = request->fd < 0 ? EBADF : 0;
+            finish(std::move(request), error);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!stopRequested_) {
+                queues_[static_cast<std::size_t>(request->priority)].push_back(std::move(request));
+            }
+        }
+        // 콜백이 다시 read()를 불러도 되도록 완료는 항상 잠금 밖에서.
+        if (request) {
+            finish(std::move(request), ECANCELED);
+            return;
+        }
+        wake();
+        cv_.notify_one();
+    }
+
+    // mutex_ 보유 상태에서 호출. lowAllowed가 false면 Low 큐는 건너뛴다.
+    std::unique_ptr<Request> popLocked(bool lowAllowed) {
+        for (std::size_t p = 0; p < kIoPriorityCount; ++p) {
+            if (!lowAllowed && p == static_cast<std::size_t>(IoPriority::Low)) break;
+            if (queues_[p].empty()) continue;
+            std::unique_ptr<Request> request = std::move(queues_[p].front());
+            queues_[p].pop_front();
+            return request;
+        }
+        return nullptr;
+    }
+
+    bool queuesEmptyLocked() const {
+        return std::all_of(queues_.begin(), queues_.end(), [](const auto& q) { return q.empty(); });
+    }
+
+    void takeQueuedLocked(std::vector<std::unique_ptr<Request>>& out) {
+        for (auto& queue : queues_) {
+            for (auto& request : queue) out.push_back(std::move(request));
+            queue.clear();
+        }
+    }
+
+    void cancel(std::vector<std::unique_ptr<Request>>& requests) {
+        for (auto& request : requests) finish(std::move(request), ECANCELED);
+        requests.clear();
+    }
+
+    void finish(std::unique_ptr<Request> request, int error) {
+        const IoResult result{request->done, error};
+        completed_.fetch_add(1, std::memory_order_relaxed);
+        bytes_.fetch_add(request->done, std::memory_order_relaxed);
+        if (request->wantsFuture) request->promise.set_value(result);
+        if (!request->callback) return;
+        if (config_.callbackPool) {
+            config_.callbackPool->submit([callback = std::move(request->callback), result]() { callback(result); });
+        } else {
+            request->callback(result);
+        }
+    }
+
+    // res바이트를 읽은 뒤: 끝났거나 파일 끝이면 true.
+    static bool advance(Request& request, std::size_t bytes) {
+        request.done += bytes;
+        return bytes == 0 || request.done >= request.length;
+    }
+
+    // --- 작업 스레드 대체 경로 ---------------------------------------------
+
+    void workerLoop() {
+        REX_TRACE_THREAD_NAME("AsyncIo");
+        while (true) {
+            std::unique_ptr<Request> request;
+            std::vector<std::unique_ptr<Request>> cancelled;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this]() {
+                    return stopRequested_ || !queuesEmptyLocked();
+                });
+                if (stopRequested_) takeQueuedLocked(cancelled);
+                if (!stopRequested_) request = popLocked(true);
+            }
+            if (!request) {
+                cancel(cancelled);
+                return;
+            }
+            inFlight_.fetch_add(1, std::memory_order_relaxed);
+            noteInFlight(inFlight_.load(std::memory_order_relaxed));
+            const int error = readBlocking(*request);
+            inFlight_.fetch_sub(1, std::memory_order_relaxed);
+            finish(std::move(request), error);
+        }
+    }
+
+    static int readBlocking(Request& request) {
+#if REX_HAS_PREAD
+        while (request.done < request.length) {
+            const std::size_t chunk = std::min(request.length - request.done, kMaxChunk);
+            const ssize_t n = ::pread(request.fd, request.data + request.done, chunk,
+                                      static_cast<off_t>(request.offset + request.done));
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                return errno;
+            }
+            if (advance(request, static_cast<std::size_t>(n))) break;
+        }
+        return 0;
+#else
+        std::ifstream file(request.path, std::ios::binary);
+        if (!file.is_open()) return EIO;
+        file.seekg(static_cast<std::streamoff>(request.offset));
+        file.read(reinterpret_cast<char*>(request.data), static_cast<std::streamsize>(request.length));
+        request.done = static_cast<std::size_t>(std::max<std::streamsize>(file.gcount(), 0));
+        return file.bad() ? EIO : 0;
+#endif
+    }
+
+    void noteInFlight(std::uint32_t count) {
+        std::uint32_t previous = maxInFlight_.load(std::memory_order_relaxed);
+        while (count > previous && !maxInFlight_.compare_exchange_weak(previous, count, std::memory_order_relaxed)) {
+        }
+    }
+
+    // --- io_uring 경로 -------------------------------------------------------
+
+#if REX_HAS_IO_URING
+    // liburing 없이 시스템 콜로 직접 다루는 최소 링. SQ/CQ는 I/O 스레드만 건드린다.
+    class Ring {
+    public:
+        ~Ring() {
+            if (sqes_) ::munmap(sqes_, sqeBytes_);
+            if (cqMap_ && cqMap_ != sqMap_) ::munmap(cqMap_, cqBytes_);
+            if (sqMap_) ::munmap(sqMap_, sqBytes_);
+            if (fd_ >= 0) ::close(fd_);
+            if (wakeFd_ >= 0) ::close(wakeFd_);
+        }
+
+        bool setup(std::uint32_t entries) {
+            io_uring_params params{};
+            fd_ = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+            if (fd_ < 0) {
+                Logger::info("io_uring unavailable (errno {}); using worker threads", errno);
+                return false;
+            }
+            sqBytes_ = params.sq_off.array + params.sq_entries * sizeof(std::uint32_t);
+            cqBytes_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+            const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+            if (singleMap) sqBytes_ = cqBytes_ = std::max(sqBytes_, cqBytes_);
+            sqMap_ = map(sqBytes_, IORING_OFF_SQ_RING);
+            cqMap_ = singleMap ? sqMap_ : map(cqBytes_, IORING_OFF_CQ_RING);
+            sqeBytes_ = params.sq_entries * sizeof(io_uring_sqe);
+            sqes_ = static_cast<io_uring_sqe*>(map(sqeBytes_, IORING_OFF_SQES));
+            wakeFd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (!sqMap_ || !cqMap_ || !sqes_ || wakeFd_ < 0) {
+                Logger::warn("io_uring ring mapping failed; using worker threads");
+                return false;
+            }
+            auto* sq = static_cast<std::byte*>(sqMap_);
+            auto* cq = static_cast<std::byte*>(cqMap_);
+            sqTail_ = reinterpret_cast<std::uint32_t*>(sq + params.sq_off.tail);
+            pendingTail_ = *sqTail_;
+            sqMask_ = *reinterpret_cast<std::uint32_t*>(sq + params.sq_off.ring_mask);
+            sqArray_ = reinterpret_cast<std::uint32_t*>(sq + params.sq_off.array);
+            cqHead_ = reinterpret_cast<std::uint32_t*>(cq + params.cq_off.head);
+            cqTail_ = reinterpret_cast<std::uint32_t*>(cq + params.cq_off.tail);
+            cqMask_ = *reinterpret_cast<std::uint32_t*>(cq + params.cq_off.ring_mask);
+            cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+            valid_ = true;
+            return true;
+        }
+
+        bool valid() const {
+            return valid_;
+        }
+
+        int wakeFd() const {
+            return wakeFd_;
+        }
+
+        // 다음 SQE를 채워 큐에 올린다(제출은 enter에서).
+        io_uring_sqe& push() {
+            const std::uint32_t tail = pendingTail_;
+            const std::uint32_t index = tail & sqMask_;
+            io_uring_sqe& sqe = sqes_[index];
+            sqe = io_uring_sqe{};
+            sqArray_[index] = index;
+            pendingTail_ = tail + 1;
+            return sqe;
+        }
+
+        // 올린 SQE를 커널에 보이고 toSubmit개를 제출하면서 완료 하나 이상을 기다린다.
+        int enter(std::uint32_t toSubmit) {
+            std::atomic_ref<std::uint32_t>(*sqTail_).store(pendingTail_, std::memory_order_release);
+            const int result = static_cast<int>(
+                ::syscall(__NR_io_uring_enter, fd_, toSubmit, 1u, IORING_ENTER_GETEVENTS, nullptr, 0));
+            return result < 0 ? -errno : result;
+        }
+
+        template <typename Fn>
+        void reap(Fn&& fn) {
+            std::atomic_ref<std::uint32_t> headRef(*cqHead_);
+            std::uint32_t head = headRef.load(std::memory_order_relaxed);
+            const std::uint32_t tail = std::atomic_ref<std::uint32_t>(*cqTail_).load(std::memory_order_acquire);
+            for (; head != tail; ++head) {
+                const io_uring_cqe& cqe = cqes_[head & cqMask_];
+                fn(cqe.user_data, cqe.res);
+            }
+            headRef.store(head, std::memory_order_release);
+        }
+
+    private:
+        void* map(std::size_t bytes, std::uint64_t offset) const {
+            void* mapped = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, static_cast<off_t>(offset));
+            return mapped == MAP_FAILED ? nullptr : mapped;
+        }
+
+        int fd_ = -1;
+        int wakeFd_ = -1;
+        bool valid_ = false;
+        void* sqMap_ = nullptr;
+        void* cqMap_ = nullptr;
+        io_uring_sqe* sqes_ = nullptr;
+        std::size_t sqBytes_ = 0;
+        std::size_t cqBytes_ = 0;
+        std::size_t sqeBytes_ = 0;
+        std::uint32_t* sqTail_ = nullptr;
+        std::uint32_t sqMask_ = 0;
+        std::uint32_t* sqArray_ = nullptr;
+        std::uint32_t pendingTail_ = 0;
+        std::uint32_t* cqHead_ = nullptr;
+        std::uint32_t* cqTail_ = nullptr;
+        std::uint32_t cqMask_ = 0;
+        io_uring_cqe* cqes_ = nullptr;
+    };
+
+    static constexpr std::uint64_t kWakeTag = 0;
+
+    // 제출 스레드는 큐에 넣고 eventfd를 깨운다. I/O 스레드는 eventfd에 poll을 하나 걸어 두므로
+    // 읽기 완료와 새 요청 도착을 같은 io_uring_enter 대기에서 받는다.
+    void ringLoop() {
+        REX_TRACE_THREAD_NAME("AsyncIo");
+        std::uint32_t inFlight = 0;
+        std::uint32_t lowInFlight = 0;
+        std::uint32_t unsubmitted = 0;
+        bool wakeArmed = false;
+        bool stopping = false;
+        std::vector<std::unique_ptr<Request>> retry;
+        std::vector<std::unique_ptr<Request>> cancelled;
+
+        while (true) {
+            if (!wakeArmed && !stopping) {
+                io_uring_sqe& sqe = ring_.push();
+                sqe.opcode = IORING_OP_POLL_ADD;
+                sqe.fd = ring_.wakeFd();
+                sqe.poll32_events = POLLIN;
+                sqe.user_data = kWakeTag;
+                ++unsubmitted;
+                wakeArmed = true;
+            }
+
+            wakePending_.store(false, std::memory_order_release);
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                // 짧은 읽기의 나머지를 먼저, 그다음 우선순위 순. Low는 큐 깊이의 절반까지만.
+                // 정지를 처음 본 회차에도 재시도분이 함께 취소되도록 정지 검사보다 먼저 되돌린다.
+                for (auto& request : retry) queues_[static_cast<std::size_t>(request->priority)].push_front(std::move(request));
+                retry.clear();
+                if (stopRequested_ && !stopping) {
+                    stopping = true;
+                    takeQueuedLocked(cancelled);
+                }
+                while (!stopping && inFlight < config_.queueDepth) {
+                    std::unique_ptr<Request> request = popLocked(lowInFlight < config_.queueDepth / 2);
+                    if (!request) break;
+                    if (request->priority == IoPriority::Low) ++lowInFlight;
+                    prepareRead(*request.release());
+                    ++inFlight;
+                    ++unsubmitted;
+                }
+            }
+            cancel(cancelled);
+            noteInFlight(inFlight);
+            if (stopping && inFlight == 0) return;
+
+            const int submitted = ring_.enter(unsubmitted);
+            submitCalls_.fetch_add(1, std::memory_order_relaxed);
+            if (submitted >= 0) {
+                unsubmitted -= std::min<std::uint32_t>(unsubmitted, static_cast<std::uint32_t>(submitted));
+            } else if (submitted != -EINTR && submitted != -EBUSY && submitted != -EAGAIN) {
+                Logger::error("io_uring_enter failed (errno {})", -submitted);
+            }
+
+            ring_.reap([&](std::uint64_t tag, int result) {
+                if (tag == kWakeTag) {
+                    std::uint64_t value = 0;
+                    [[maybe_unused]] const ssize_t n = ::read(ring_.wakeFd(), &value, sizeof(value));
+                    wakeArmed = false;
+                    return;
+                }
+                std::unique_ptr<Request> request(reinterpret_cast<Request*>(tag));
+                --inFlight;
+                if (request->priority == IoPriority::Low) --lowInFlight;
+                if (result == -EINTR || result == -EAGAIN) {
+                    retry.push_back(std::move(request));
+                } else if (result < 0) {
+                    finish(std::move(request), -result);
+                } else if (advance(*request, static_cast<std::size_t>(result))) {
+                    finish(std::move(request), 0);
+                } else {
+                    retry.push_back(std::move(request));
+                }
+            });
+            if (stopping) cancel(retry);
+        }
+    }
+
+    void prepareRead(Request& request) {
+        request.vector.iov_base = request.data + request.done;
+        request.vector.iov_len = std::min(request.length - request.done, kMaxChunk);
+        io_uring_sqe& sqe = ring_.push();
+        sqe.opcode = IORING_OP_READV;
+        sqe.fd = request.fd;
+        sqe.off = request.offset + request.done;
+        sqe.addr = reinterpret_cast<std::uint64_t>(&request.vector);
+        sqe.len = 1;
+        sqe.user_data = reinterpret_cast<std::uint64_t>(&request);
+    }
+
+    Ring ring_;
+#endif
+
+    void wake() {
+#if REX_HAS_IO_URING
+        if (!ring_.valid() || wakePending_.exchange(true, std::memory_order_acq_rel)) return;
+        const std::uint64_t one = 1;
+        [[maybe_unused]] const ssize_t n = ::write(ring_.wakeFd(), &one, sizeof(one));
+#endif
+    }
+
+    AsyncIoConfig config_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::array<std::deque<std::unique_ptr<Request>>, kIoPriorityCount> queues_;
+    bool stopRequested_ = false;
+    std::atomic<bool> wakePending_{false};
+    std::atomic<std::uint32_t> inFlight_{0};
+    std::atomic<std::uint64_t> submitted_{0};
+    std::atomic<std::uint64_t> completed_{0};
+    std::atomic<std::uint64_t> bytes_{0};
+    std::atomic<std::uint64_t> submitCalls_{0};
+    std::atomic<std::uint32_t> maxInFlight_{0};
+    std::vector<std::thread> workers_;
+};
+
+// TODO [Core-Platform-008]:
+// 책임: 호출자 버퍼로 읽는 비동기 파일 I/O 서비스
+// 요구사항:
+//  - io_uring 묶음 제출(지원 시), pread 작업 스레드 대체 경로
+//  - future 또는 완료 콜백(잡 스레드풀로 전달 가능)
+//  - 스트리밍용 우선순위(High/Normal/Low, Low는 큐 깊이 절반 제한)
+//  - 짧은 읽기 이어 읽기, 종료 시 미제출 요청 취소
+// 의존성:
+//  - Core/Job/ThreadPool, Core/Diagnostics/Logger
+// 구현 단계: Phase D
+// 성능 고려사항:
+//  - 요청당 할당 1회(Request), 제출은 큐 깊이만큼 묶어 시스템 콜 1회
+//  - 깨우기 eventfd 쓰기는 대기 중일 때 한 번만
+//  - 쓰기/열기 비동기화, 등록 버퍼(fixed buffers) 확장 여지
+// 테스트 전략:
+//  - 백엔드별 내용 일치/파일 끝/오프셋 테스트
+//  - 우선순위 순서 테스트
+//  - 진행 중 소멸(취소/대기) 테스트
+
+} // namespace rex::core::platform
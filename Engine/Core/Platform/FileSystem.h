@@ -1,9 +1,10 @@
 #pragma once
 
+#include <cstddef>
 #include <filesystem>
 #include <fstream>
 #include <optional>
-#include <sstream>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -15,12 +16,17 @@ public:
         return std::filesystem::exists(path);
     }
 
+    // 크기만큼 잡은 문자열로 한 번에 읽는다(스트림 버퍼를 거친 이중 복사 없음). 바이너리 모드라
+    // 줄바꿈은 변환하지 않는다.
     static std::optional<std::string> readText(const std::filesystem::path& path) {
-        std::ifstream file(path);
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
         if (!file.is_open()) return std::nullopt;
-        std::ostringstream ss;
-        ss << file.rdbuf();
-        return ss.str();
+        const std::streamoff size = file.tellg();
+        if (size < 0) return std::nullopt;
+        std::string text(static_cast<std::size_t>(size), '\0');
+        file.seekg(0);
+        if (!text.empty() && !file.read(text.data(), size)) return std::nullopt;
+        return text;
     }
 
     static bool writeText(const std::filesystem::path& path, const std::string& content) {
@@ -29,14 +35,34 @@ public:
         file << content;
         return true;
     }
+
+    // 파일 전체를 한 번의 read로 읽는다.
+    static std::optional<std::vector<std::byte>> readBinary(const std::filesystem::path& path) {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) return std::nullopt;
+        const std::streamoff size = file.tellg();
+        if (size < 0) return std::nullopt;
+        std::vector<std::byte> bytes(static_cast<std::size_t>(size));
+        file.seekg(0);
+        if (!bytes.empty() && !file.read(reinterpret_cast<char*>(bytes.data()), size)) return std::nullopt;
+        return bytes;
+    }
+
+    static bool writeBinary(const std::filesystem::path& path, std::span<const std::byte> bytes) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) return false;
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        return static_cast<bool>(file);
+    }
 };
 
 // TODO [Core-Platform-002]:
 // 책임: 파일 시스템 공통 API 제공
 // 요구사항:
 //  - 존재 확인/텍스트 읽기/텍스트 쓰기
+//  - 바이너리 전체 읽기/쓰기(단일 read/write)
 //  - 플랫폼 독립 경로 타입 사용
-//  - 비동기 IO 확장 포인트
+//  - 비동기 IO는 Core/Platform/AsyncIo
 // 의존성:
 //  - 없음
 // 구현 단계: Phase D
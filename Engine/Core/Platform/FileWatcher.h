@@ -0,0 +1,211 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+#include "../Diagnostics/Logger.h"
+
+namespace rex::core::platform {
+
+enum class FileChangeKind : std::uint8_t {
+    Modified = 0,
+    Created,
+    Removed
+};
+
+struct FileChange {
+    std::filesystem::path path;
+    FileChangeKind kind = FileChangeKind::Modified;
+};
+
+struct FileWatcherConfig {
+    // 마지막 이벤트 이후 이 시간 동안 조용해야 변경을 보고한다.
+    // 에디터/익스포터의 "임시 파일 쓰기 → rename" 폭주를 한 번으로 묶는다.
+    std::chrono::milliseconds debounce{150};
+    bool recursive = true;
+};
+
+// inotify 기반 디렉터리 감시. poll()은 논블로킹이며 메인 루프에서 프레임마다 부른다.
+// Linux 외 플랫폼에서는 감시가 비활성(valid() == false)이고 poll()은 항상 비어 있다.
+class FileWatcher {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit FileWatcher(FileWatcherConfig config = {})
+        : config_(config) {
+#if defined(__linux__)
+        fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (fd_ < 0) Logger::warn("inotify_init1 failed (errno {})", errno);
+#endif
+    }
+
+    ~FileWatcher() {
+#if defined(__linux__)
+        if (fd_ >= 0) ::close(fd_);
+#endif
+    }
+
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    bool valid() const {
+        return fd_ >= 0;
+    }
+
+    // directory와(recursive면) 하위 디렉터리를 감시한다. 이후 생긴 하위 디렉터리도 자동으로 추가된다.
+    bool watch(const std::filesystem::path& directory) {
+        if (!valid()) return false;
+        std::error_code ec;
+        if (!std::filesystem::is_directory(directory, ec)) {
+            Logger::warn("FileWatcher: not a directory: {}", directory.string());
+            return false;
+        }
+        if (!addWatch(directory)) return false;
+        if (!config_.recursive) return true;
+        for (std::filesystem::recursive_directory_iterator it(directory, ec), end; !ec && it != end; it.increment(ec)) {
+            if (it->is_directory(ec)) addWatch(it->path());
+        }
+        return true;
+    }
+
+    // 커널 이벤트를 모두 읽고, debounce 시간이 지난 변경만 돌려준다. 같은 경로는 한 번만 보고된다.
+    std::vector<FileChange> poll(Clock::time_point now = Clock::now()) {
+        readEvents(now);
+
+        std::vector<FileChange> ready;
+        for (auto it = pending_.begin(); it != pending_.end();) {
+            if (now - it->second.lastEvent >= config_.debounce) {
+                ready.push_back({it->first, it->second.kind});
+                it = pending_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        std::sort(ready.begin(), ready.end(), [](const FileChange& a, const FileChange& b) { return a.path < b.path; });
+        return ready;
+    }
+
+    std::size_t pendingCount() const {
+        return pending_.size();
+    }
+
+    std::size_t watchCount() const {
+        return directories_.size();
+    }
+
+private:
+    struct Pending {
+        FileChangeKind kind = FileChangeKind::Modified;
+        Clock::time_point lastEvent{};
+    };
+
+    bool addWatch(const std::filesystem::path& directory) {
+#if defined(__linux__)
+        const std::uint32_t mask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_CREATE | IN_DELETE | IN_ONLYDIR;
+        const int wd = inotify_add_watch(fd_, directory.c_str(), mask);
+        if (wd < 0) {
+            Logger::warn("inotify_add_watch failed for {} (errno {})", directory.string(), errno);
+            return false;
+        }
+        directories_[wd] = directory;
+        return true;
+#else
+        (void)directory;
+        return false;
+#endif
+    }
+
+    void record(const std::filesystem::path& path, FileChangeKind kind, Clock::time_point now) {
+        auto [it, inserted] = pending_.try_emplace(path.string());
+        Pending& pending = it->second;
+        if (inserted || kind == FileChangeKind::Removed) {
+            pending.kind = kind;
+        } else if (pending.kind == FileChangeKind::Removed) {
+            // 삭제 뒤 재생성(임시 파일 rename 저장)은 수정으로 본다.
+            pending.kind = FileChangeKind::Modified;
+        }
+        // 그 외에는 첫 종류(Created/Modified)를 유지한다.
+        pending.lastEvent = now;
+    }
+
+    void readEvents(Clock::time_point now) {
+#if defined(__linux__)
+        if (fd_ < 0) return;
+        alignas(inotify_event) char buffer[16 * 1024];
+        while (true) {
+            const ssize_t length = ::read(fd_, buffer, sizeof(buffer));
+            if (length <= 0) break;
+            for (ssize_t offset = 0; offset < length;) {
+                const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+                offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+                if (event->mask & IN_IGNORED) {
+                    directories_.erase(event->wd);
+                    continue;
+                }
+                if (event->mask & IN_Q_OVERFLOW) {
+                    Logger::warn("FileWatcher: inotify queue overflow, some changes were lost");
+                    continue;
+                }
+                const auto dir = directories_.find(event->wd);
+                if (dir == directories_.end() || event->len == 0) continue;
+                std::filesystem::path path = dir->second / event->name;
+
+                if (event->mask & IN_ISDIR) {
+                    if (config_.recursive && (event->mask & (IN_CREATE | IN_MOVED_TO))) watch(path);
+                    continue;
+                }
+                if (event->mask & (IN_DELETE | IN_MOVED_FROM)) {
+                    record(path, FileChangeKind::Removed, now);
+                } else if (event->mask & IN_MOVED_TO) {
+                    record(path, FileChangeKind::Created, now);
+                } else if (event->mask & IN_CLOSE_WRITE) {
+                    record(path, FileChangeKind::Modified, now);
+                }
+                // IN_CREATE 단독은 내용이 아직 없다. 뒤따르는 IN_CLOSE_WRITE를 기다린다.
+            }
+        }
+#else
+        (void)now;
+#endif
+    }
+
+    FileWatcherConfig config_{};
+    int fd_ = -1;
+    std::unordered_map<int, std::filesystem::path> directories_;
+    std::unordered_map<std::string, Pending> pending_;
+};
+
+// TODO [Core-Platform-004]:
+// 책임: 파일 변경 감시(핫 리로드 입력)
+// 요구사항:
+//  - inotify 기반 디렉터리(재귀) 감시
+//  - 변경 폭주 debounce 및 경로 단위 병합
+//  - 논블로킹 poll
+// 의존성:
+//  - Diagnostics/Logger
+// 구현 단계: Phase D
+// 성능 고려사항:
+//  - poll은 read 몇 번으로 끝나야 함(이벤트 없으면 syscall 1회)
+//  - 대형 트리는 watch 수 한도(max_user_watches) 주의
+// 테스트 전략:
+//  - 연속 쓰기 debounce 병합 테스트
+//  - 새 하위 디렉터리 자동 감시 테스트
+//  - rename 저장 패턴 Modified 판정 테스트
+
+} // namespace rex::core::platform
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define REX_HAS_MMAP 1
+#else
+#include <fstream>
+#define REX_HAS_MMAP 0
+#endif
+
+namespace rex::core::platform {
+
+// 읽기 전용 파일 매핑. 매핑 시작 주소는 페이지 정렬이므로 파일 내부 오프셋이 정렬되어 있으면
+// bytes() 안의 구조체를 복사 없이 그대로 참조할 수 있다.
+// mmap이 없는 플랫폼에서는 파일 전체를 한 번에 읽은 버퍼로 대신한다.
+class MappedFile {
+public:
+    MappedFile() = default;
+
+    explicit MappedFile(const std::filesystem::path& path) {
+        open(path);
+    }
+
+    ~MappedFile() {
+        close();
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            close();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            valid_ = std::exchange(other.valid_, false);
+            fallback_ = std::move(other.fallback_);
+        }
+        return *this;
+    }
+
+    bool open(const std::filesystem::path& path) {
+        close();
+#if REX_HAS_MMAP
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return false;
+        struct stat info{};
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            return false;
+        }
+        size_ = static_cast<std::size_t>(info.st_size);
+        if (size_ > 0) {
+            void* mapped = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapped == MAP_FAILED) {
+                ::close(fd);
+                size_ = 0;
+                return false;
+            }
+            data_ = static_cast<const std::byte*>(mapped);
+        }
+        // 매핑은 fd 없이 유지된다.
+        ::close(fd);
+#else
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) return false;
+        const std::streamoff size = file.tellg();
+        if (size < 0) return false;
+        fallback_.resize(static_cast<std::size_t>(size));
+        file.seekg(0);
+        if (!fallback_.empty() && !file.read(reinterpret_cast<char*>(fallback_.data()), size)) return false;
+        data_ = fallback_.data();
+        size_ = fallback_.size();
+#endif
+        valid_ = true;
+        return true;
+    }
+
+    void close() {
+#if REX_HAS_MMAP
+        if (data_ && fallback_.empty()) ::munmap(const_cast<std::byte*>(data_), size_);
+#endif
+        fallback_.clear();
+        data_ = nullptr;
+        size_ = 0;
+        valid_ = false;
+    }
+
+    // 빈 파일도 열기에 성공하면 true다(bytes()는 비어 있다).
+    bool valid() const {
+        return valid_;
+    }
+
+    std::span<const std::byte> bytes() const {
+        return {data_, size_};
+    }
+
+    std::size_t size() const {
+        return size_;
+    }
+
+    // 곧 전부 읽을 구간이라고 커널에 알린다. 로더 스레드에서 호출하면 업로드 스레드의
+    // 첫 접근이 페이지 폴트 대신 이미 읽힌 페이지를 만난다.
+    void prefetch() const {
+#if REX_HAS_MMAP
+        if (data_ && fallback_.empty()) ::madvise(const_cast<std::byte*>(data_), size_, MADV_WILLNEED);
+#endif
+    }
+
+    // bytes() 안의 range만 미리 읽는다(아카이브 안의 항목 하나 등). 페이지 경계로 넓혀 전달한다.
+    void prefetch(std::span<const std::byte> range) const {
+#if REX_HAS_MMAP
+        if (!data_ || !fallback_.empty() || range.empty()) return;
+        const auto page = static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+        const auto begin = reinterpret_cast<std::uintptr_t>(range.data()) & ~(page - 1);
+        const auto end = reinterpret_cast<std::uintptr_t>(range.data() + range.size());
+        ::madvise(reinterpret_cast<void*>(begin), end - begin, MADV_WILLNEED);
+#else
+        (void)range;
+#endif
+    }
+
+private:
+    const std::byte* data_ = nullptr;
+    std::size_t size_ = 0;
+    bool valid_ = false;
+    std::vector<std::byte> fallback_;
+};
+
+// TODO [Core-Platform-005]:
+// 책임: 읽기 전용 파일 매핑 제공(제로 카피 에셋 로드)
+// 요구사항:
+//  - mmap 기반 읽기 전용 매핑, RAII 해제
+//  - 이동 가능, 복사 불가
+//  - mmap 미지원 플랫폼은 전체 읽기 버퍼로 대체
+//  - 프리페치 힌트(madvise, 전체 또는 부분 구간)
+// 의존성:
+//  - 없음
+// 구현 단계: Phase D
+// 성능 고려사항:
+//  - 열기 비용은 syscall 몇 번, 실제 읽기는 첫 접근 시 페이지 단위
+//  - 큰 파일은 prefetch로 페이지 폴트를 로더 스레드로 옮김
+//  - Windows는 CreateFileMapping 경로 확장 필요
+// 테스트 전략:
+//  - 내용 일치/빈 파일/없는 파일 테스트
+//  - 이동 후 원본 무효화 테스트
+
+} // namespace rex::core::platform
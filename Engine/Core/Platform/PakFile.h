@@ -0,0 +1,361 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "FileSystem.h"
+#include "MappedFile.h"
+#include "../Serialization/BinaryStream.h"
+#include "../Serialization/BlockCompression.h"
+#include "../Serialization/ContentHash.h"
+
+namespace rex::core::platform {
+
+// .rexpak 아카이브 레이아웃:
+//   PakHeader | 파일 데이터(각각 kPakAlignment 정렬) | PakEntry[entryCount] | 경로 문자열
+// 목차는 (경로 해시, 경로) 순으로 정렬되어 있어 결정적이고 이분 탐색도 가능하다.
+// 압축 항목의 데이터는 블록별 저장 크기 표(u32 × blockCount) 뒤에 블록들이 이어진다.
+// 저장 크기가 원본 블록 크기와 같으면 그 블록은 압축하지 않은 원본이다.
+constexpr std::uint32_t kPakMagic = 0x4B415052u; // "RPAK"
+constexpr std::uint32_t kPakVersion = 1;
+// 파일 데이터 시작 정렬. 페이지 단위라 매핑한 항목을 그대로 GPU 업로드나 구조체 참조에 쓸 수 있다.
+constexpr std::size_t kPakAlignment = 4096;
+constexpr std::uint32_t kPakBlockSize = 64 * 1024;
+constexpr std::string_view kPakExtension = ".rexpak";
+
+struct PakHeader {
+    std::uint32_t magic = kPakMagic;
+    std::uint32_t version = kPakVersion;
+    std::uint32_t entryCount = 0;
+    std::uint32_t blockSize = kPakBlockSize;
+    std::uint64_t tocOffset = 0;
+    std::uint64_t namesOffset = 0;
+    std::uint64_t namesSize = 0;
+    std::uint64_t reserved = 0;
+};
+static_assert(sizeof(PakHeader) == 48);
+
+enum PakEntryFlags : std::uint32_t {
+    kPakEntryCompressed = 1u << 0
+};
+
+struct PakEntry {
+    std::uint64_t pathHash = 0;
+    std::uint64_t offset = 0;
+    // 원본 크기와 아카이브 안의 크기(압축 항목은 블록 표 포함).
+    std::uint64_t size = 0;
+    std::uint64_t storedSize = 0;
+    std::uint32_t nameOffset = 0;
+    std::uint32_t nameLength = 0;
+    std::uint32_t flags = 0;
+    std::uint32_t blockCount = 0;
+};
+static_assert(sizeof(PakEntry) == 48);
+
+// 가상 경로 정규화: 구분자는 '/', 앞의 "/"·"./"와 빈/"." 구간은 제거한다.
+// ".."는 해석하지 않고 그대로 둔다(마운트 밖으로 나가는 경로는 찾지 못한다).
+inline std::string normalizeVirtualPath(std::string_view path) {
+    std::string out;
+    out.reserve(path.size());
+    std::size_t begin = 0;
+    while (begin <= path.size()) {
+        std::size_t end = begin;
+        while (end < path.size() && path[end] != '/' && path[end] != '\\') ++end;
+        const std::string_view part = path.substr(begin, end - begin);
+        if (!part.empty() && part != ".") {
+            if (!out.empty()) out += '/';
+            out += part;
+        }
+        begin = end + 1;
+    }
+    return out;
+}
+
+inline std::uint64_t hashVirtualPath(std::string_view normalizedPath) {
+    return serialization::hash64(normalizedPath, 0x5241504Bull);
+}
+
+enum class PakCompression : std::uint8_t {
+    // 7/8 이하로 줄어들 때만 압축한다.
+    Auto = 0,
+    // 항상 원본 그대로 저장(매핑 뷰로 읽힌다).
+    None
+};
+
+// 메모리에서 아카이브를 조립한다. add()가 곧바로 압축하므로 원본 버퍼는 유지할 필요가 없다.
+class PakWriter {
+public:
+    // 같은 경로를 다시 추가하면 교체한다.
+    void add(std::string_view path, std::span<const std::byte> bytes, PakCompression compression = PakCompression::Auto) {
+        Pending pending;
+        pending.path = normalizeVirtualPath(path);
+        pending.size = bytes.size();
+        if (compression == PakCompression::Auto && compressBlocks(bytes, pending.stored, pending.blockCount)) {
+            pending.compressed = true;
+        } else {
+            pending.stored.assign(bytes.begin(), bytes.end());
+            pending.blockCount = 0;
+        }
+        const auto it = std::find_if(pending_.begin(), pending_.end(), [&](const Pending& p) { return p.path == pending.path; });
+        if (it != pending_.end()) {
+            *it = std::move(pending);
+        } else {
+            pending_.push_back(std::move(pending));
+        }
+    }
+
+    bool addFile(std::string_view path, const std::filesystem::path& source, PakCompression compression = PakCompression::Auto) {
+        MappedFile file(source);
+        if (!file.valid()) return false;
+        add(path, file.bytes(), compression);
+        return true;
+    }
+
+    std::size_t size() const {
+        return pending_.size();
+    }
+
+    std::vector<std::byte> build() const {
+        std::vector<const Pending*> order;
+        order.reserve(pending_.size());
+        for (const Pending& p : pending_) order.push_back(&p);
+        std::sort(order.begin(), order.end(), [](const Pending* a, const Pending* b) {
+            const std::uint64_t ha = hashVirtualPath(a->path);
+            const std::uint64_t hb = hashVirtualPath(b->path);
+            return ha != hb ? ha < hb : a->path < b->path;
+        });
+
+        serialization::BinaryWriter writer;
+        std::size_t total = sizeof(PakHeader);
+        for (const Pending& p : pending_) total += p.stored.size() + kPakAlignment + sizeof(PakEntry) + p.path.size();
+        writer.reserve(total);
+        writer.write(PakHeader{});
+
+        std::vector<PakEntry> entries;
+        std::string names;
+        entries.reserve(order.size());
+        for (const Pending* p : order) {
+            writer.align(kPakAlignment);
+            PakEntry entry;
+            entry.pathHash = hashVirtualPath(p->path);
+            entry.offset = writer.size();
+            entry.size = p->size;
+            entry.storedSize = p->stored.size();
+            entry.nameOffset = static_cast<std::uint32_t>(names.size());
+            entry.nameLength = static_cast<std::uint32_t>(p->path.size());
+            entry.flags = p->compressed ? kPakEntryCompressed : 0u;
+            entry.blockCount = p->blockCount;
+            writer.writeBytes(p->stored.data(), p->stored.size());
+            entries.push_back(entry);
+            names += p->path;
+        }
+
+        writer.align(alignof(PakEntry));
+        PakHeader header;
+        header.entryCount = static_cast<std::uint32_t>(entries.size());
+        header.tocOffset = writer.size();
+        writer.writeBytes(entries.data(), entries.size() * sizeof(PakEntry));
+        header.namesOffset = writer.size();
+        header.namesSize = names.size();
+        writer.writeBytes(names.data(), names.size());
+        writer.patch(0, header);
+        return writer.take();
+    }
+
+    bool save(const std::filesystem::path& path) const {
+        const std::vector<std::byte> bytes = build();
+        return FileSystem::writeBinary(path, bytes);
+    }
+
+private:
+    struct Pending {
+        std::string path;
+        std::uint64_t size = 0;
+        std::vector<std::byte> stored;
+        std::uint32_t blockCount = 0;
+        bool compressed = false;
+    };
+
+    // 블록 표 + 블록. 전체가 원본의 7/8을 넘으면 false(원본 저장이 더 낫다).
+    static bool compressBlocks(std::span<const std::byte> bytes, std::vector<std::byte>& out, std::uint32_t& blockCount) {
+        if (bytes.empty()) return false;
+        blockCount = static_cast<std::uint32_t>((bytes.size() + kPakBlockSize - 1) / kPakBlockSize);
+        const std::size_t tableBytes = std::size_t{blockCount} * sizeof(std::uint32_t);
+        out.assign(tableBytes + blockCount * serialization::lzCompressBound(kPakBlockSize), std::byte{0});
+        std::size_t cursor = tableBytes;
+        for (std::uint32_t b = 0; b < blockCount; ++b) {
+            const std::span<const std::byte> block = bytes.subspan(std::size_t{b} * kPakBlockSize,
+                                                                   std::min<std::size_t>(kPakBlockSize, bytes.size() - std::size_t{b} * kPakBlockSize));
+            std::size_t stored = serialization::lzCompress(block, std::span<std::byte>(out).subspan(cursor));
+            if (stored >= block.size()) {
+                std::memcpy(out.data() + cursor, block.data(), block.size());
+                stored = block.size();
+            }
+            const std::uint32_t stored32 = static_cast<std::uint32_t>(stored);
+            std::memcpy(out.data() + std::size_t{b} * sizeof(std::uint32_t), &stored32, sizeof(stored32));
+            cursor += stored;
+        }
+        out.resize(cursor);
+        return cursor <= bytes.size() - bytes.size() / 8;
+    }
+
+    std::vector<Pending> pending_;
+};
+
+// 매핑된 .rexpak. 열 때 목차를 검증하고 경로 해시로 개방 주소 해시 인덱스를 만든다.
+// 조회는 할당 없이 해시 한 번 + 프로브 몇 번이다. 이동 불가(외부에서 shared_ptr로 공유한다).
+class PakArchive {
+public:
+    PakArchive() = default;
+    PakArchive(const PakArchive&) = delete;
+    PakArchive& operator=(const PakArchive&) = delete;
+
+    bool open(const std::filesystem::path& path) {
+        close();
+        if (!file_.open(path)) return false;
+        const std::span<const std::byte> bytes = file_.bytes();
+        serialization::BinaryReader reader(bytes);
+        PakHeader header;
+        if (!reader.read(header) || header.magic != kPakMagic || header.version != kPakVersion ||
+            header.blockSize != kPakBlockSize || header.tocOffset % alignof(PakEntry) != 0 ||
+            header.tocOffset > bytes.size() ||
+            std::uint64_t{header.entryCount} * sizeof(PakEntry) > bytes.size() - header.tocOffset ||
+            header.namesOffset > bytes.size() || header.namesSize > bytes.size() - header.namesOffset) {
+            close();
+            return false;
+        }
+        entries_ = {reinterpret_cast<const PakEntry*>(bytes.data() + header.tocOffset), header.entryCount};
+        names_ = {reinterpret_cast<const char*>(bytes.data() + header.namesOffset), static_cast<std::size_t>(header.namesSize)};
+        for (const PakEntry& entry : entries_) {
+            const bool blocksValid = (entry.flags & kPakEntryCompressed) == 0 ||
+                                     (entry.blockCount == (entry.size + kPakBlockSize - 1) / kPakBlockSize &&
+                                      std::uint64_t{entry.blockCount} * sizeof(std::uint32_t) <= entry.storedSize);
+            if (entry.offset > bytes.size() || entry.storedSize > bytes.size() - entry.offset ||
+                std::uint64_t{entry.nameOffset} + entry.nameLength > names_.size() || !blocksValid ||
+                ((entry.flags & kPakEntryCompressed) == 0 && entry.storedSize != entry.size)) {
+                close();
+                return false;
+            }
+        }
+
+        slots_.assign(std::bit_ceil(std::max<std::size_t>(entries_.size() * 2, 2)), kEmptySlot);
+        const std::size_t mask = slots_.size() - 1;
+        for (std::size_t i = 0; i < entries_.size(); ++i) {
+            std::size_t slot = entries_[i].pathHash & mask;
+            while (slots_[slot] != kEmptySlot) slot = (slot + 1) & mask;
+            slots_[slot] = static_cast<std::uint32_t>(i);
+        }
+        return true;
+    }
+
+    void close() {
+        file_.close();
+        entries_ = {};
+        names_ = {};
+        slots_.clear();
+    }
+
+    bool valid() const {
+        return file_.valid() && !slots_.empty();
+    }
+
+    // 정규화된 경로로 찾는다. 없으면 nullptr.
+    const PakEntry* find(std::string_view normalizedPath) const {
+        if (slots_.empty()) return nullptr;
+        const std::uint64_t hash = hashVirtualPath(normalizedPath);
+        const std::size_t mask = slots_.size() - 1;
+        for (std::size_t slot = hash & mask; slots_[slot] != kEmptySlot; slot = (slot + 1) & mask) {
+            const PakEntry& entry = entries_[slots_[slot]];
+            if (entry.pathHash == hash && name(entry) == normalizedPath) return &entry;
+        }
+        return nullptr;
+    }
+
+    std::span<const PakEntry> entries() const {
+        return entries_;
+    }
+
+    std::string_view name(const PakEntry& entry) const {
+        return names_.substr(entry.nameOffset, entry.nameLength);
+    }
+
+    bool compressed(const PakEntry& entry) const {
+        return (entry.flags & kPakEntryCompressed) != 0;
+    }
+
+    // 압축하지 않은 항목의 매핑 안 구간(복사 없음). 압축 항목은 빈 span.
+    std::span<const std::byte> view(const PakEntry& entry) const {
+        if (compressed(entry)) return {};
+        return file_.bytes().subspan(entry.offset, entry.size);
+    }
+
+    // 원본을 out(entry.size 바이트)에 복원한다. 손상된 블록이면 false.
+    bool extract(const PakEntry& entry, std::span<std::byte> out) const {
+        if (out.size() != entry.size) return false;
+        const std::span<const std::byte> stored = file_.bytes().subspan(entry.offset, entry.storedSize);
+        if (!compressed(entry)) {
+            if (!stored.empty()) std::memcpy(out.data(), stored.data(), stored.size());
+            return true;
+        }
+        std::size_t cursor = std::size_t{entry.blockCount} * sizeof(std::uint32_t);
+        for (std::uint32_t b = 0; b < entry.blockCount; ++b) {
+            std::uint32_t storedBlock = 0;
+            std::memcpy(&storedBlock, stored.data() + std::size_t{b} * sizeof(std::uint32_t), sizeof(storedBlock));
+            const std::size_t rawOffset = std::size_t{b} * kPakBlockSize;
+            const std::span<std::byte> block = out.subspan(rawOffset, std::min<std::size_t>(kPakBlockSize, out.size() - rawOffset));
+            if (storedBlock > stored.size() - cursor) return false;
+            const std::span<const std::byte> source = stored.subspan(cursor, storedBlock);
+            if (storedBlock == block.size()) {
+                std::memcpy(block.data(), source.data(), source.size());
+            } else if (!serialization::lzDecompress(source, block)) {
+                return false;
+            }
+            cursor += storedBlock;
+        }
+        return true;
+    }
+
+    // 항목 구간만 미리 읽도록 커널에 알린다.
+    void prefetch(const PakEntry& entry) const {
+        file_.prefetch(file_.bytes().subspan(entry.offset, entry.storedSize));
+    }
+
+private:
+    static constexpr std::uint32_t kEmptySlot = 0xFFFFFFFFu;
+
+    MappedFile file_;
+    std::span<const PakEntry> entries_;
+    std::string_view names_;
+    std::vector<std::uint32_t> slots_;
+};
+
+// TODO [Core-Platform-006]:
+// 책임: 팩 아카이브(.rexpak) 작성/매핑 읽기
+// 요구사항:
+//  - 정렬된 목차(경로 해시, 경로), 4KB 정렬 데이터
+//  - 파일별 64KB 블록 LZ 압축, 줄지 않으면 원본 저장
+//  - 비압축 항목은 매핑 안 구간을 그대로 반환(제로 카피)
+//  - 열 때 목차/범위 검증, 해시 인덱스 구성
+// 의존성:
+//  - Core/Platform/MappedFile, Core/Serialization(BinaryStream, BlockCompression, ContentHash)
+// 구현 단계: Phase D
+// 성능 고려사항:
+//  - 열기 비용은 매핑 1회 + 목차 순회 1회, 조회는 할당 없음
+//  - 블록 단위 해제로 부분 읽기 확장 여지
+//  - 정렬 패딩으로 인한 크기 증가(항목당 최대 4KB)
+// 테스트 전략:
+//  - 작성→열기→읽기 라운드트립(압축/비압축/빈 파일)
+//  - 잘린 아카이브/범위 밖 목차 거부 테스트
+//  - 해시 충돌 경로 조회 테스트
+
+} // namespace rex::core::platform
@@ -0,0 +1,255 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "MappedFile.h"
+#include "PakFile.h"
+#include "../Diagnostics/Logger.h"
+
+namespace rex::core::platform {
+
+// VFS에서 연 파일 하나. 느슨한 파일과 비압축 팩 항목은 매핑을 그대로 가리키고(mapped()),
+// 압축 항목만 소유 버퍼로 풀린다. 팩 항목은 아카이브를 함께 붙잡으므로 언마운트 후에도 유효하다.
+class VfsFile {
+public:
+    VfsFile() = default;
+
+    bool valid() const {
+        return valid_;
+    }
+
+    std::span<const std::byte> bytes() const {
+        return bytes_;
+    }
+
+    std::string_view text() const {
+        return {reinterpret_cast<const char*>(bytes_.data()), bytes_.size()};
+    }
+
+    std::size_t size() const {
+        return bytes_.size();
+    }
+
+    // bytes()가 복사·해제 없이 매핑 안을 가리키면 true.
+    bool mapped() const {
+        return valid_ && buffer_.empty() && !bytes_.empty();
+    }
+
+    // 곧 전부 읽을 구간이라고 커널에 알린다(로더 스레드용).
+    void prefetch() const {
+        if (pak_) {
+            pak_->prefetch(*entry_);
+        } else {
+            mapping_.prefetch();
+        }
+    }
+
+private:
+    friend class VirtualFileSystem;
+
+    // 벡터와 매핑은 이동해도 데이터 주소가 그대로라 bytes_는 기본 이동 후에도 유효하다.
+    std::shared_ptr<const PakArchive> pak_;
+    const PakEntry* entry_ = nullptr;
+    MappedFile mapping_;
+    std::vector<std::byte> buffer_;
+    std::span<const std::byte> bytes_;
+    bool valid_ = false;
+};
+
+struct VfsStats {
+    std::size_t mounts = 0;
+    std::size_t pakEntries = 0;
+};
+
+// 디렉터리와 .rexpak를 가상 경로 공간에 마운트한다. 나중에 마운트한 쪽이 우선하며, 어느
+// 마운트에도 없는 경로는 실제 파일 시스템 경로로 열어 마운트 없이 쓰던 코드가 그대로 동작한다.
+// 마운트 변경은 드물고 조회는 로더 스레드에서 동시에 일어나므로 shared_mutex로 보호한다.
+class VirtualFileSystem {
+public:
+    // 프로세스 공용 인스턴스. 로더들은 이것을 쓴다.
+    static VirtualFileSystem& instance() {
+        static VirtualFileSystem vfs;
+        return vfs;
+    }
+
+    // source가 디렉터리면 느슨한 파일 마운트, 아니면 팩으로 연다. mountPoint는 가상 경로 접두사.
+    bool mount(const std::filesystem::path& source, std::string_view mountPoint = {}) {
+        Mount mount;
+        mount.source = source;
+        mount.point = normalizeVirtualPath(mountPoint);
+        if (!mount.point.empty()) mount.point += '/';
+
+        std::error_code ec;
+        if (std::filesystem::is_directory(source, ec)) {
+            mount.directory = source;
+        } else {
+            auto pak = std::make_shared<PakArchive>();
+            if (!pak->open(source)) {
+                Logger::error("VFS: failed to mount {}", source.string());
+                return false;
+            }
+            mount.pak = std::move(pak);
+        }
+
+        std::unique_lock lock(mutex_);
+        Logger::info("VFS: mounted {} at /{} ({})", source.string(), mount.point,
+                     mount.pak ? std::to_string(mount.pak->entries().size()) + " files" : std::string("directory"));
+        mounts_.push_back(std::move(mount));
+        return true;
+    }
+
+    bool unmount(const std::filesystem::path& source) {
+        std::unique_lock lock(mutex_);
+        const auto it = std::find_if(mounts_.rbegin(), mounts_.rend(), [&](const Mount& m) { return m.source == source; });
+        if (it == mounts_.rend()) return false;
+        mounts_.erase(std::next(it).base());
+        return true;
+    }
+
+    void unmountAll() {
+        std::unique_lock lock(mutex_);
+        mounts_.clear();
+    }
+
+    // 없는 파일은 valid() == false.
+    VfsFile open(std::string_view path) const {
+        const std::string normalized = normalizeVirtualPath(path);
+        {
+            std::shared_lock lock(mutex_);
+            for (auto it = mounts_.rbegin(); it != mounts_.rend(); ++it) {
+                if (!normalized.starts_with(it->point)) continue;
+                const std::string_view relative = std::string_view(normalized).substr(it->point.size());
+                if (it->pak) {
+                    if (const PakEntry* entry = it->pak->find(relative)) return openEntry(it->pak, *entry);
+                } else {
+                    VfsFile file = openLoose(it->directory / std::filesystem::path(relative));
+                    if (file.valid()) return file;
+                }
+            }
+        }
+        return openLoose(std::filesystem::path(path));
+    }
+
+    bool exists(std::string_view path) const {
+        const std::string normalized = normalizeVirtualPath(path);
+        std::error_code ec;
+        {
+            std::shared_lock lock(mutex_);
+            for (auto it = mounts_.rbegin(); it != mounts_.rend(); ++it) {
+                if (!normalized.starts_with(it->point)) continue;
+                const std::string_view relative = std::string_view(normalized).substr(it->point.size());
+                if (it->pak ? it->pak->find(relative) != nullptr
+                            : std::filesystem::is_regular_file(it->directory / std::filesystem::path(relative), ec)) {
+                    return true;
+                }
+            }
+        }
+        return std::filesystem::is_regular_file(std::filesystem::path(path), ec);
+    }
+
+    std::optional<std::string> readText(std::string_view path) const {
+        const VfsFile file = open(path);
+        if (!file.valid()) return std::nullopt;
+        return std::string(file.text());
+    }
+
+    VfsStats stats() const {
+        std::shared_lock lock(mutex_);
+        VfsStats stats;
+        stats.mounts = mounts_.size();
+        for (const Mount& mount : mounts_) stats.pakEntries += mount.pak ? mount.pak->entries().size() : 0;
+        return stats;
+    }
+
+    // 디렉터리 아래 모든 파일을 상대 경로로 담은 팩을 만든다. keepMapped 확장자(예: ".rexmesh")는
+    // 압축하지 않아 매핑 뷰로 읽힌다. 담은 파일 수를 돌려주며 실패하면 nullopt.
+    static std::optional<std::size_t> packDirectory(const std::filesystem::path& directory,
+                                                    const std::filesystem::path& output,
+                                                    std::span<const std::string_view> keepMapped = {}) {
+        std::error_code ec;
+        PakWriter writer;
+        for (std::filesystem::recursive_directory_iterator it(directory, ec), end; !ec && it != end; it.increment(ec)) {
+            if (!it->is_regular_file(ec)) continue;
+            const std::string extension = it->path().extension().string();
+            const bool keep = std::find(keepMapped.begin(), keepMapped.end(), extension) != keepMapped.end();
+            const std::string relative = std::filesystem::relative(it->path(), directory, ec).generic_string();
+            if (ec || !writer.addFile(relative, it->path(), keep ? PakCompression::None : PakCompression::Auto)) {
+                Logger::error("VFS: failed to pack {}", it->path().string());
+                return std::nullopt;
+            }
+        }
+        if (ec || !writer.save(output)) return std::nullopt;
+        return writer.size();
+    }
+
+private:
+    struct Mount {
+        std::filesystem::path source;
+        // 정규화된 접두사("" 또는 "a/b/").
+        std::string point;
+        std::filesystem::path directory;
+        std::shared_ptr<const PakArchive> pak;
+    };
+
+    static VfsFile openLoose(const std::filesystem::path& path) {
+        VfsFile file;
+        if (!file.mapping_.open(path)) return file;
+        file.bytes_ = file.mapping_.bytes();
+        file.valid_ = true;
+        return file;
+    }
+
+    static VfsFile openEntry(const std::shared_ptr<const PakArchive>& pak, const PakEntry& entry) {
+        VfsFile file;
+        if (pak->compressed(entry)) {
+            file.buffer_.resize(static_cast<std::size_t>(entry.size));
+            if (!pak->extract(entry, file.buffer_)) {
+                Logger::error("VFS: corrupt pak entry {}", pak->name(entry));
+                return VfsFile{};
+            }
+            file.bytes_ = file.buffer_;
+        } else {
+            file.bytes_ = pak->view(entry);
+        }
+        file.pak_ = pak;
+        file.entry_ = &entry;
+        file.valid_ = true;
+        return file;
+    }
+
+    mutable std::shared_mutex mutex_;
+    std::vector<Mount> mounts_;
+};
+
+// TODO [Core-Platform-007]:
+// 책임: 가상 파일 시스템(디렉터리/팩 마운트, 단일 조회 경로)
+// 요구사항:
+//  - 디렉터리와 .rexpak 마운트, 마운트 지점 접두사, 나중 마운트 우선
+//  - 마운트에 없으면 실제 경로로 폴백
+//  - 비압축 항목/느슨한 파일은 매핑 뷰(제로 카피), 압축 항목은 해제 버퍼
+//  - 디렉터리 → 팩 빌드 도구
+// 의존성:
+//  - Core/Platform/MappedFile, Core/Platform/PakFile, Core/Diagnostics/Logger
+// 구현 단계: Phase D
+// 성능 고려사항:
+//  - 팩 조회는 해시 인덱스(할당은 경로 정규화 1회)
+//  - 시작 시 수천 번의 open 대신 팩 매핑 1회
+//  - 조회는 shared_lock으로 로더 스레드 동시 접근
+// 테스트 전략:
+//  - 마운트 우선순위/언마운트 테스트
+//  - 팩/디렉터리 동일 내용 읽기 비교 테스트
+//  - 폴백 경로 테스트
+
+} // namespace rex::core::platform
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "PropertyMetadata.h"
+#include "TypeRegistry.h"
+
+namespace rex::core::reflection {
+
+// 컴파일 타임 필드 기술자. 멤버 포인터로 접근하므로 순회에 해시/가상 호출이 없다.
+template <typename Owner, typename Member>
+struct FieldDescriptor {
+    using owner_type = Owner;
+    using value_type = Member;
+
+    const char* name;
+    const char* typeName;
+    Member Owner::*pointer;
+    std::size_t offset;
+
+    static constexpr std::size_t size = sizeof(Member);
+
+    constexpr Member& get(Owner& owner) const { return owner.*pointer; }
+    constexpr const Member& get(const Owner& owner) const { return owner.*pointer; }
+};
+
+// 필드 목록 특수화 지점. REX_REFLECT_FIELDS가 정의한다.
+template <typename T>
+struct FieldList;
+
+template <typename T>
+concept HasFieldList = requires {
+    { FieldList<T>::name } -> std::convertible_to<const char*>;
+    FieldList<T>::fields;
+};
+
+template <HasFieldList T>
+constexpr std::size_t fieldCount() {
+    return std::tuple_size_v<std::remove_cvref_t<decltype(FieldList<T>::fields)>>;
+}
+
+// fn(descriptor)를 선언 순서대로 호출한다. descriptor 타입마다 인스턴스화되므로 fn은 제네릭 람다로 쓴다.
+template <HasFieldList T, typename Fn>
+constexpr void forEachField(Fn&& fn) {
+    std::apply([&](const auto&... field) { (fn(field), ...); }, FieldList<T>::fields);
+}
+
+// fn(descriptor, value&)를 선언 순서대로 호출한다. object가 const이면 value도 const.
+template <typename T, typename Fn>
+    requires HasFieldList<std::remove_const_t<T>>
+constexpr void forEachField(T& object, Fn&& fn) {
+    forEachField<std::remove_const_t<T>>([&](const auto& field) { fn(field, field.get(object)); });
+}
+
+// 값이 다른 필드의 비트 마스크(선언 순서, 최대 64필드). 비교 연산자가 없는 필드는 바이트 비교한다.
+// 다중 선택 편집의 "혼합 값" 표시와 변경분 직렬화에 쓴다.
+template <HasFieldList T>
+std::uint64_t changedFieldMask(const T& a, const T& b) {
+    static_assert(fieldCount<T>() <= 64, "changedFieldMask supports at most 64 fields");
+    std::uint64_t mask = 0;
+    std::size_t index = 0;
+    forEachField<T>([&](const auto& field) {
+        using Value = typename std::remove_cvref_t<decltype(field)>::value_type;
+        bool equal = false;
+        if constexpr (std::equality_comparable<Value>) {
+            equal = field.get(a) == field.get(b);
+        } else {
+            static_assert(std::is_trivially_copyable_v<Value>, "field needs operator== or trivial copy");
+            equal = std::memcmp(&field.get(a), &field.get(b), sizeof(Value)) == 0;
+        }
+        if (!equal) mask |= std::uint64_t{1} << index;
+        ++index;
+    });
+    return mask;
+}
+
+template <HasFieldList T>
+TypeMetadata makeTypeMetadata() {
+    TypeMetadata metadata{};
+    metadata.name = FieldList<T>::name;
+    metadata.size = sizeof(T);
+    metadata.properties.reserve(fieldCount<T>());
+    forEachField<T>([&](const auto& field) {
+        metadata.properties.push_back({field.name, field.typeName, field.offset, field.size});
+    });
+    return metadata;
+}
+
+// 필드 목록을 런타임 TypeRegistry에도 등록해 이름/메타 기반 도구가 같은 정의를 쓰게 한다.
+template <HasFieldList T>
+const TypeMetadata& registerFields() {
+    return TypeRegistry::instance().registerType<T>(makeTypeMetadata<T>());
+}
+
+} // namespace rex::core::reflection
+
+// 사용법(rex::core::reflection을 감싸는 네임스페이스 또는 전역에서):
+//   REX_REFLECT_FIELDS(Transform, "Transform",
+//       REX_FIELD(Transform, position, Vec3),
+//       REX_FIELD(Transform, rotation, Vec3))
+#define REX_REFLECT_FIELDS(TYPE, TYPE_NAME_LITERAL, ...)                               \
+    template <>                                                                        \
+    struct rex::core::reflection::FieldList<TYPE> {                                    \
+        static constexpr const char* name = TYPE_NAME_LITERAL;                         \
+        static constexpr auto fields = std::make_tuple(__VA_ARGS__);                   \
+    };
+
+#define REX_FIELD(TYPE, FIELD_NAME, FIELD_TYPE)                                        \
+    ::rex::core::reflection::FieldDescriptor<TYPE, FIELD_TYPE> {                       \
+        #FIELD_NAME, #FIELD_TYPE, &TYPE::FIELD_NAME, offsetof(TYPE, FIELD_NAME)        \
+    }
+
+// TODO [Core-Reflection-004]:
+// 책임: 컴파일 타임 필드 목록 리플렉션
+// 요구사항:
+//  - 필드 1회 선언(이름/타입명/멤버 포인터/오프셋)
+//  - constexpr forEachField(타입/객체)
+//  - 런타임 TypeMetadata 등록
+//  - 필드 단위 변경 마스크
+// 의존성:
+//  - Reflection/PropertyMetadata
+//  - Reflection/TypeRegistry
+// 구현 단계: Phase D
+// 성능 고려사항:
+//  - 순회는 fold 전개, 해시/문자열 비교/가상 호출 0
+//  - 필드 수에 비례하는 인스턴스화로 컴파일 시간 증가
+// 테스트 전략:
+//  - 필드 순서/오프셋과 런타임 메타 일치 테스트
+//  - changedFieldMask 비트 위치 테스트
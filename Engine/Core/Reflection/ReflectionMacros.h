@@ -1,7 +1,13 @@
 #pragma once
 
+#include <cstddef>
+#include <type_traits>
+
 #include "TypeRegistry.h"
 
+// 사용법: REX_REFLECT_TYPE으로 등록 함수를 정의하고, 등록 코드에서 그 함수를 호출한 뒤
+// REX_REFLECT_PROPERTY로 필드를 추가한다. 오프셋은 offsetof를 쓰므로 표준 레이아웃 타입만 받는다.
+
 #define REX_REFLECT_TYPE(TYPE, TYPE_NAME_LITERAL)                                    \
     static void RexRegisterType_##TYPE() {                                           \
         ::rex::core::reflection::TypeMetadata metadata{};                            \
@@ -12,15 +18,20 @@
 
 #define REX_REFLECT_PROPERTY(TYPE, PROP_NAME, PROP_TYPE)                             \
     do {                                                                              \
-        (void)sizeof(TYPE::PROP_NAME);                                                \
-        (void)sizeof(PROP_TYPE);                                                      \
+        static_assert(std::is_standard_layout_v<TYPE>,                                \
+                      #TYPE " must be standard-layout for offset reflection");        \
+        static_assert(std::is_same_v<decltype(TYPE::PROP_NAME), PROP_TYPE>,           \
+                      #TYPE "::" #PROP_NAME " is not declared as " #PROP_TYPE);       \
+        ::rex::core::reflection::TypeRegistry::instance().addProperty<TYPE>(          \
+            {#PROP_NAME, #PROP_TYPE, offsetof(TYPE, PROP_NAME), sizeof(PROP_TYPE)});  \
     } while (0)
 
 // TODO [Core-Reflection-003]:
 // 책임: 타입/프로퍼티 등록 매크로 제공
 // 요구사항:
 //  - 선언부 부담 최소화
-//  - 컴파일 타임 검증 훅
+//  - 컴파일 타임 검증 훅(선언 타입 일치, 표준 레이아웃)
+//  - 프로퍼티 이름/타입명/오프셋/크기 기록
 //  - 코드 생성 툴 연계 확장 포인트
 // 의존성:
 //  - Reflection/TypeRegistry
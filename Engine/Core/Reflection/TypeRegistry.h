@@ -4,6 +4,8 @@
 #include <string>
 #include <typeindex>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "PropertyMetadata.h"
 
@@ -16,10 +18,30 @@ public:
         return inst;
     }
 
+    // 같은 타입을 다시 등록하면 프로퍼티 목록까지 새 메타로 교체된다.
     template <typename T>
-    void registerType(TypeMetadata metadata) {
-        byIndex_[std::type_index(typeid(T))] = metadata;
-        byName_[metadata.name] = std::move(metadata);
+    TypeMetadata& registerType(TypeMetadata metadata) {
+        TypeMetadata& stored = byIndex_[std::type_index(typeid(T))];
+        if (!stored.name.empty() && stored.name != metadata.name) byName_.erase(stored.name);
+        stored = std::move(metadata);
+        byName_[stored.name] = &stored;
+        return stored;
+    }
+
+    // 등록된 타입에 프로퍼티를 추가한다. 같은 이름이 있으면 교체한다. 미등록 타입이면 false.
+    template <typename T>
+    bool addProperty(PropertyMetadata property) {
+        auto it = byIndex_.find(std::type_index(typeid(T)));
+        if (it == byIndex_.end()) return false;
+        std::vector<PropertyMetadata>& properties = it->second.properties;
+        for (PropertyMetadata& existing : properties) {
+            if (existing.name == property.name) {
+                existing = std::move(property);
+                return true;
+            }
+        }
+        properties.push_back(std::move(property));
+        return true;
     }
 
     template <typename T>
@@ -32,12 +54,13 @@ public:
     const TypeMetadata* findByName(const std::string& name) const {
         auto it = byName_.find(name);
         if (it == byName_.end()) return nullptr;
-        return &it->second;
+        return it->second;
     }
 
 private:
+    // 메타는 byIndex_ 노드에 한 번만 저장한다. unordered_map 노드 주소는 rehash에도 유지된다.
     std::unordered_map<std::type_index, TypeMetadata> byIndex_;
-    std::unordered_map<std::string, TypeMetadata> byName_;
+    std::unordered_map<std::string, const TypeMetadata*> byName_;
 };
 
 // TODO [Core-Reflection-002]:
@@ -45,6 +68,7 @@ private:
 // 요구사항:
 //  - 타입 등록/조회 API
 //  - type_index 및 name 기반 조회
+//  - 등록 후 프로퍼티 추가(REX_REFLECT_PROPERTY)
 //  - 모듈 경계에서 메타 병합 가능
 // 의존성:
 //  - Reflection/PropertyMetadata
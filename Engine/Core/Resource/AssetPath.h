@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include "../Serialization/ContentHash.h"
+
+namespace rex::core::resource {
+
+// 에셋 경로에서 만든 안정 ID. 핸들(index+generation)은 실행마다 달라지므로 저장 파일에는 이 값을 쓴다.
+// 0은 "에셋 없음"으로 예약한다.
+using AssetId = std::uint64_t;
+
+inline AssetId assetIdOf(std::string_view path) {
+    if (path.empty()) return 0;
+    const AssetId id = serialization::hash64(path, 0x52455841535345ull);
+    return id != 0 ? id : 1;
+}
+
+// AssetId -> 경로 역참조 표. 씬 파일에 함께 저장되어 로드 후 경로로 다시 acquire할 수 있게 한다.
+class AssetPathTable {
+public:
+    AssetId add(std::string_view path) {
+        const AssetId id = assetIdOf(path);
+        if (id != 0) paths_.try_emplace(id, path);
+        return id;
+    }
+
+    // 파일에서 읽은 항목을 그대로 넣는다. 이미 있는 ID는 덮어쓰지 않는다.
+    void insert(AssetId id, std::string path) {
+        if (id != 0) paths_.try_emplace(id, std::move(path));
+    }
+
+    const std::string* find(AssetId id) const {
+        const auto it = paths_.find(id);
+        return it != paths_.end() ? &it->second : nullptr;
+    }
+
+    const std::unordered_map<AssetId, std::string>& entries() const {
+        return paths_;
+    }
+
+    std::size_t size() const {
+        return paths_.size();
+    }
+
+    void clear() {
+        paths_.clear();
+    }
+
+private:
+    std::unordered_map<AssetId, std::string> paths_;
+};
+
+// TODO [Core-Resource-004]:
+// 책임: 저장 가능한 에셋 참조(경로 기반 ID)와 역참조 표
+// 요구사항:
+//  - 경로 -> 64비트 ID(실행 간 동일)
+//  - ID -> 경로 조회
+//  - 0 = 참조 없음
+// 의존성:
+//  - Serialization/ContentHash
+// 구현 단계: Phase D
+// 성능 고려사항:
+//  - ID 계산은 경로 해시 1회
+//  - 컴포넌트에는 ID(8바이트)만 저장
+// 테스트 전략:
+//  - 동일 경로 동일 ID 테스트
+//  - 표 저장/복원 라운드트립 테스트
+
+} // namespace rex::core::resource
@@ -0,0 +1,381 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../Diagnostics/Logger.h"
+#include "../Diagnostics/ProfilerHooks.h"
+#include "../Event/AsyncEventQueue.h"
+#include "../Job/ThreadPool.h"
+#include "HandlePool.h"
+
+namespace rex::core::resource {
+
+enum class ResourceState : std::uint8_t {
+    Invalid = 0,
+    Loading,  // 워커에서 읽기/파싱 중
+    Uploading, // CPU 데이터 준비 완료, GL 스레드 업로드 대기
+    Resident,
+    Failed
+};
+
+struct ResourceManagerConfig {
+    // GL 스레드가 processUploads 한 번에 올리는 최대 바이트. 한 항목이 이보다 커도 프레임당 1개는 올린다.
+    std::size_t uploadBudgetBytes = 8u * 1024u * 1024u;
+    // 상주 바이트가 이를 넘으면 참조 0인 리소스를 LRU 순으로 해제한다.
+    std::size_t memoryBudgetBytes = 256u * 1024u * 1024u;
+};
+
+struct ResourceManagerStats {
+    std::size_t resident = 0;
+    std::size_t residentBytes = 0;
+    std::size_t loading = 0;
+    std::size_t pendingUploads = 0;
+    std::size_t unreferenced = 0;
+    std::size_t uploadedBytesLastFrame = 0;
+    std::uint64_t evictions = 0;
+    std::uint64_t failures = 0;
+};
+
+// 경로 단위로 중복 제거되는 비동기 리소스 캐시.
+//  - load(path): 워커 스레드에서 파일을 읽어 CPU 페이로드를 만든다(GL 호출 금지).
+//  - upload(payload): GL 스레드에서 GPU 리소스를 만든다.
+//  - bytes(payload): 업로드/상주 메모리 계산용 크기.
+// acquire/release/get은 어느 스레드에서 불러도 되지만, processUploads와 소멸자는
+// GL 컨텍스트를 가진 스레드에서만 부른다(리소스 생성/파괴가 그곳에서 일어난다).
+template <typename TTag, typename TPayload, typename TResource>
+class ResourceManager {
+public:
+    using Handle = StrongHandle<TTag>;
+    using LoadFn = std::function<std::optional<TPayload>(const std::string& path)>;
+    using UploadFn = std::function<std::unique_ptr<TResource>(TPayload& payload)>;
+    using BytesFn = std::function<std::size_t(const TPayload& payload)>;
+
+    ResourceManager(job::ThreadPool& jobs, LoadFn load, UploadFn upload, BytesFn bytes,
+                    ResourceManagerConfig config = {}, event::AsyncEventQueue* events = nullptr)
+        : jobs_(jobs),
+          load_(std::move(load)),
+          upload_(std::move(upload)),
+          bytes_(std::move(bytes)),
+          config_(config),
+          events_(events),
+          inbox_(std::make_shared<Inbox>()) {}
+
+    ResourceManager(const ResourceManager&) = delete;
+    ResourceManager& operator=(const ResourceManager&) = delete;
+
+    // 진행 중인 워커 작업은 inbox를 공유하므로 결과는 버려질 뿐 안전하다.
+    ~ResourceManager() = default;
+
+    // 참조를 하나 늘린다. 처음 보는 경로면 백그라운드 로드를 시작한다.
+    Handle acquire(const std::string& path) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = byPath_.find(path);
+        if (it != byPath_.end() && pool_.isValid(it->second)) {
+            retainLocked(entries_[it->second.id.index]);
+            return it->second;
+        }
+
+        const Handle handle = pool_.allocate();
+        if (handle.id.index >= entries_.size()) entries_.resize(handle.id.index + 1);
+        Entry& entry = entries_[handle.id.index];
+        entry = Entry{};
+        entry.handle = handle;
+        entry.path = path;
+        entry.state = ResourceState::Loading;
+        entry.refCount = 1;
+        entry.lruPos = lru_.end();
+        byPath_[path] = handle;
+        ++loading_;
+        startLoad(handle, path);
+        return handle;
+    }
+
+    void retain(Handle handle) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (pool_.isValid(handle)) retainLocked(entries_[handle.id.index]);
+    }
+
+    // 참조가 0이 되면 즉시 파괴하지 않고 LRU에 넣는다. 예산을 넘을 때만 processUploads에서 해제된다.
+    void release(Handle handle) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!pool_.isValid(handle)) return;
+        Entry& entry = entries_[handle.id.index];
+        if (entry.refCount == 0) return;
+        if (--entry.refCount > 0) return;
+        if (entry.state == ResourceState::Failed) {
+            // 실패한 항목은 붙잡아 둘 이유가 없다. 다음 acquire가 다시 시도한다.
+            freeLocked(entry);
+            return;
+        }
+        entry.lruPos = lru_.insert(lru_.end(), handle.id.index);
+    }
+
+    // 이미 acquire된 경로의 페이로드를 교체한다(핫 리로드). 다음 processUploads에서 업로드되어 같은 핸들 뒤의
+    // 리소스가 바뀌고, 그 전까지는 기존 리소스가 그대로 쓰인다. 그 경로를 쥔 항목이 없으면 false.
+    bool replace(const std::string& path, TPayload payload) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto it = byPath_.find(path);
+        if (it == byPath_.end() || !pool_.isValid(it->second)) return false;
+        Entry& entry = entries_[it->second.id.index];
+        if (entry.state == ResourceState::Failed) entry.state = ResourceState::Uploading;
+        uploads_.push_back({it->second, std::move(payload)});
+        return true;
+    }
+
+    // 상주 전이면 nullptr. 포인터는 참조를 쥐고 있는 동안 유효하다(replace로 교체되면 다음 프레임부터 바뀐다).
+    TResource* get(Handle handle) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!pool_.isValid(handle)) return nullptr;
+        return entries_[handle.id.index].resource.get();
+    }
+
+    ResourceState state(Handle handle) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!pool_.isValid(handle)) return ResourceState::Invalid;
+        return entries_[handle.id.index].state;
+    }
+
+    // GL 스레드에서 프레임마다 호출: 완료된 로드를 받아 예산 안에서 업로드하고, 메모리 예산 초과분을 해제한다.
+    // 업로드된 리소스 수를 돌려준다.
+    std::size_t processUploads() {
+        REX_TRACE_SCOPE("ResourceUploads");
+        drainInbox();
+
+        std::size_t uploaded = 0;
+        std::size_t uploadedBytes = 0;
+        while (uploadedBytes < config_.uploadBudgetBytes) {
+            Pending pending;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (uploads_.empty()) break;
+                pending = std::move(uploads_.front());
+                uploads_.pop_front();
+            }
+
+            const std::size_t bytes = bytes_(*pending.payload);
+            std::unique_ptr<TResource> resource = upload_(*pending.payload);
+            uploadedBytes += bytes;
+
+            std::string loadedPath;
+            std::unique_ptr<TResource> replaced;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!pool_.isValid(pending.handle)) continue;
+                Entry& entry = entries_[pending.handle.id.index];
+                if (!resource) {
+                    // 교체 업로드가 실패하면 기존 리소스를 유지한다.
+                    if (!entry.resource) fail(entry, "upload");
+                    continue;
+                }
+                // 교체된 리소스는 반복이 끝날 때 락 밖에서 파괴된다.
+                replaced = std::move(entry.resource);
+                if (replaced) residentBytes_ -= entry.bytes;
+                entry.resource = std::move(resource);
+                entry.bytes = bytes;
+                entry.state = ResourceState::Resident;
+                residentBytes_ += bytes;
+                ++uploaded;
+                loadedPath = entry.path;
+            }
+            // Block 정책 큐가 가득 차도 소비자(get/acquire 호출자)와 교착되지 않도록 락 밖에서 발행한다.
+            publish(event::EngineEventType::ResourceLoaded, std::move(loadedPath));
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            uploadedBytesLastFrame_ = uploadedBytes;
+        }
+        REX_TRACE_COUNTER("ResourceUploadKB", uploadedBytes / 1024);
+
+        evictOverBudget();
+        return uploaded;
+    }
+
+    ResourceManagerStats stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ResourceManagerStats out{};
+        out.residentBytes = residentBytes_;
+        out.loading = loading_;
+        out.pendingUploads = uploads_.size();
+        out.unreferenced = lru_.size();
+        out.uploadedBytesLastFrame = uploadedBytesLastFrame_;
+        out.evictions = evictions_;
+        out.failures = failures_;
+        for (const Entry& entry : entries_) {
+            if (entry.state == ResourceState::Resident) ++out.resident;
+        }
+        return out;
+    }
+
+    const ResourceManagerConfig& config() const {
+        return config_;
+    }
+
+private:
+    struct Entry {
+        Handle handle{};
+        std::string path;
+        std::unique_ptr<TResource> resource;
+        std::size_t bytes = 0;
+        std::uint32_t refCount = 0;
+        ResourceState state = ResourceState::Invalid;
+        std::list<std::uint32_t>::iterator lruPos{};
+    };
+
+    struct Pending {
+        Handle handle{};
+        std::optional<TPayload> payload;
+    };
+
+    // 워커 결과 수신함. 매니저보다 오래 살 수 있도록 작업과 shared_ptr로 공유한다.
+    struct Inbox {
+        std::mutex mutex;
+        std::vector<Pending> completed;
+    };
+
+    void startLoad(Handle handle, const std::string& path) {
+        std::shared_ptr<Inbox> inbox = inbox_;
+        jobs_.submit([inbox, load = load_, handle, path]() {
+            REX_TRACE_SCOPE("ResourceLoad");
+            Pending pending{handle, load(path)};
+            std::lock_guard<std::mutex> lock(inbox->mutex);
+            inbox->completed.push_back(std::move(pending));
+        });
+    }
+
+    void drainInbox() {
+        std::vector<Pending> completed;
+        {
+            std::lock_guard<std::mutex> lock(inbox_->mutex);
+            completed.swap(inbox_->completed);
+        }
+        if (completed.empty()) return;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (Pending& pending : completed) {
+            --loading_;
+            if (!pool_.isValid(pending.handle)) continue;
+            Entry& entry = entries_[pending.handle.id.index];
+            if (!pending.payload) {
+                fail(entry, "load");
+                continue;
+            }
+            entry.state = ResourceState::Uploading;
+            uploads_.push_back(std::move(pending));
+        }
+    }
+
+    void retainLocked(Entry& entry) {
+        if (entry.refCount++ == 0 && entry.lruPos != lru_.end()) {
+            lru_.erase(entry.lruPos);
+            entry.lruPos = lru_.end();
+        }
+    }
+
+    // 참조 0이고 LRU에서 빠진 항목을 비운다. 핸들 세대가 올라가 기존 핸들은 무효가 된다.
+    void freeLocked(Entry& entry) {
+        byPath_.erase(entry.path);
+        pool_.release(entry.handle);
+        entry = Entry{};
+        entry.lruPos = lru_.end();
+    }
+
+    void publish(event::EngineEventType type, std::string path) {
+        if (events_) events_->enqueue({type, std::move(path)});
+    }
+
+    // 로드 중에 참조가 모두 놓였으면(LRU에 들어가 있다) 바로 비워 다음 acquire가 다시 시도하게 한다.
+    // 참조가 남아 있으면 Failed로 두고 마지막 release에서 비운다.
+    void fail(Entry& entry, const char* stage) {
+        entry.state = ResourceState::Failed;
+        ++failures_;
+        Logger::error("Resource {} failed: {}", stage, entry.path);
+        if (entry.refCount > 0) return;
+        if (entry.lruPos != lru_.end()) lru_.erase(entry.lruPos);
+        freeLocked(entry);
+    }
+
+    // 상주 중이고 참조 0인 리소스만 오래된 순으로 해제한다.
+    void evictOverBudget() {
+        std::vector<std::unique_ptr<TResource>> victims;
+        std::vector<std::string> unloaded;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = lru_.begin();
+            while (residentBytes_ > config_.memoryBudgetBytes && it != lru_.end()) {
+                Entry& entry = entries_[*it];
+                if (entry.state != ResourceState::Resident) {
+                    ++it;
+                    continue;
+                }
+                it = lru_.erase(it);
+                residentBytes_ -= entry.bytes;
+                victims.push_back(std::move(entry.resource));
+                unloaded.push_back(entry.path);
+                freeLocked(entry);
+                ++evictions_;
+            }
+        }
+        // GL 리소스 파괴와 이벤트 발행은 락 밖에서.
+        victims.clear();
+        for (std::string& path : unloaded) {
+            publish(event::EngineEventType::ResourceUnloaded, std::move(path));
+        }
+    }
+
+    job::ThreadPool& jobs_;
+    LoadFn load_;
+    UploadFn upload_;
+    BytesFn bytes_;
+    ResourceManagerConfig config_{};
+    event::AsyncEventQueue* events_ = nullptr;
+    std::shared_ptr<Inbox> inbox_;
+
+    mutable std::mutex mutex_;
+    HandlePool<TTag> pool_;
+    std::vector<Entry> entries_;
+    std::unordered_map<std::string, Handle> byPath_;
+    std::deque<Pending> uploads_;
+    std::list<std::uint32_t> lru_;
+    std::size_t residentBytes_ = 0;
+    std::size_t loading_ = 0;
+    std::size_t uploadedBytesLastFrame_ = 0;
+    std::uint64_t evictions_ = 0;
+    std::uint64_t failures_ = 0;
+};
+
+// TODO [Core-Resource-003]:
+// 책임: 핸들 기반 비동기 리소스 로드/업로드/해제
+// 요구사항:
+//  - 경로 단위 중복 제거와 참조 카운트
+//  - 워커 스레드 로드, GL 스레드 업로드(프레임당 바이트 예산)
+//  - 메모리 예산 초과 시 참조 0 리소스 LRU 해제
+//  - ResourceLoaded/ResourceUnloaded 이벤트 발행
+//  - 같은 핸들 뒤 리소스 교체(핫 리로드)
+// 의존성:
+//  - Resource/HandlePool
+//  - Job/ThreadPool
+//  - Event/AsyncEventQueue
+// 구현 단계: Phase D
+// 성능 고려사항:
+//  - 파일 읽기/파싱은 프레임 스레드 밖에서
+//  - 업로드 예산으로 대형 에셋의 프레임 스파이크 분산
+//  - GL 리소스 생성/파괴는 락 밖에서
+// 테스트 전략:
+//  - 동일 경로 acquire 중복 제거 테스트
+//  - 업로드 예산 분할 테스트
+//  - 예산 초과 LRU 해제 및 stale 핸들 테스트
+//  - 로드 중 release 후 실패 시 항목 해제/재시도 테스트
+//  - replace 후 핸들 유지/상주 바이트 갱신 테스트
+
+} // namespace rex::core::resource
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rex::core::serialization {
+
+// 바이트 버퍼에 이어 쓰는 바이너리 작성기. 값은 호스트 바이트 순서로 memcpy된다
+// (파일 헤더의 endian 태그로 불일치를 검출한다).
+class BinaryWriter {
+public:
+    void reserve(std::size_t bytes) {
+        bytes_.reserve(bytes);
+    }
+
+    template <typename T>
+    void write(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "BinaryWriter::write requires a trivially copyable type");
+        writeBytes(&value, sizeof(T));
+    }
+
+    void writeBytes(const void* data, std::size_t size) {
+        if (size == 0) return;
+        const std::size_t offset = bytes_.size();
+        bytes_.resize(offset + size);
+        std::memcpy(bytes_.data() + offset, data, size);
+    }
+
+    // u32 길이 + 바이트. 종료 문자는 쓰지 않는다.
+    void writeString(std::string_view text) {
+        write(static_cast<std::uint32_t>(text.size()));
+        writeBytes(text.data(), text.size());
+    }
+
+    // 0으로 채워 다음 쓰기 위치를 alignment 배수로 맞춘다. 리더도 같은 지점에서 align해야 한다.
+    void align(std::size_t alignment) {
+        const std::size_t remainder = bytes_.size() % alignment;
+        if (remainder != 0) bytes_.resize(bytes_.size() + (alignment - remainder), std::byte{0});
+    }
+
+    // 0으로 채운 size 바이트를 덧붙이고 그 시작 주소를 돌려준다. 다음 쓰기 전까지만 유효하다.
+    std::byte* grow(std::size_t size) {
+        const std::size_t offset = bytes_.size();
+        bytes_.resize(offset + size, std::byte{0});
+        return bytes_.data() + offset;
+    }
+
+    // 이미 쓴 위치의 값을 덮어쓴다(헤더의 크기 필드 등).
+    template <typename T>
+    void patch(std::size_t offset, const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "BinaryWriter::patch requires a trivially copyable type");
+        std::memcpy(bytes_.data() + offset, &value, sizeof(T));
+    }
+
+    std::size_t size() const {
+        return bytes_.size();
+    }
+
+    std::span<const std::byte> bytes() const {
+        return bytes_;
+    }
+
+    std::vector<std::byte> take() {
+        return std::move(bytes_);
+    }
+
+private:
+    std::vector<std::byte> bytes_;
+};
+
+// 경계 검사를 하는 바이너리 리더. 한 번 실패하면 이후 읽기는 모두 실패하므로
+// 호출부는 묶음 단위로 ok()만 확인하면 된다.
+class BinaryReader {
+public:
+    explicit BinaryReader(std::span<const std::byte> bytes)
+        : bytes_(bytes) {}
+
+    template <typename T>
+    bool read(T& out) {
+        static_assert(std::is_trivially_copyable_v<T>, "BinaryReader::read requires a trivially copyable type");
+        const std::span<const std::byte> source = readBytes(sizeof(T));
+        if (source.empty()) return false;
+        std::memcpy(&out, source.data(), sizeof(T));
+        return true;
+    }
+
+    // 복사 없이 버퍼 안의 구간을 돌려준다. 실패하면 빈 span.
+    std::span<const std::byte> readBytes(std::size_t size) {
+        if (failed_ || size > bytes_.size() - offset_) {
+            failed_ = true;
+            return {};
+        }
+        const std::span<const std::byte> out = bytes_.subspan(offset_, size);
+        offset_ += size;
+        return out;
+    }
+
+    bool readString(std::string& out) {
+        std::uint32_t length = 0;
+        if (!read(length)) return false;
+        const std::span<const std::byte> text = readBytes(length);
+        if (failed_) return false;
+        out.assign(reinterpret_cast<const char*>(text.data()), text.size());
+        return true;
+    }
+
+    bool align(std::size_t alignment) {
+        const std::size_t remainder = offset_ % alignment;
+        if (remainder != 0) readBytes(alignment - remainder);
+        return !failed_;
+    }
+
+    bool skip(std::size_t size) {
+        readBytes(size);
+        return !failed_;
+    }
+
+    bool ok() const {
+        return !failed_;
+    }
+
+    std::size_t offset() const {
+        return offset_;
+    }
+
+    std::size_t remaining() const {
+        return bytes_.size() - offset_;
+    }
+
+private:
+    std::span<const std::byte> bytes_;
+    std::size_t offset_ = 0;
+    bool failed_ = false;
+};
+
+// TODO [Core-Serialization-001]:
+// 책임: 바이너리 직렬화용 바이트 작성기/리더 제공
+// 요구사항:
+//  - trivially copyable 값 memcpy 쓰기/읽기
+//  - 길이 접두 문자열, 정렬 패딩, 사후 patch
+//  - 경계 검사와 실패 전파(sticky fail)
+// 의존성:
+//  - 없음
+// 구현 단계: Phase D
+// 성능 고려사항:
+//  - 대량 구간은 grow/readBytes로 복사 1회 또는 0회
+//  - 사전 reserve로 재할당 최소화
+// 테스트 전략:
+//  - 라운드트립 테스트
+//  - 잘린 입력에서 실패 전파 테스트
+
+} // namespace rex::core::serialization
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+namespace rex::core::serialization {
+
+// 외부 의존성 없는 LZ77 계열 블록 압축(LZ4 블록과 같은 시퀀스 구조, 호환은 보장하지 않는다).
+// 시퀀스 = 토큰(상위 4비트 리터럴 길이, 하위 4비트 매치 길이 - 4) + 리터럴 + 2바이트 오프셋.
+// 길이가 15 이상이면 255 바이트를 이어 붙여 확장하고, 블록의 마지막 시퀀스는 리터럴만 가진다.
+// 오프셋이 16비트이므로 블록은 64KB 이하로 나누어 압축하는 것을 전제로 한다.
+namespace lz_detail {
+
+constexpr std::size_t kMinMatch = 4;
+constexpr std::size_t kHashBits = 12;
+// 마지막 매치는 블록 끝에서 이만큼 앞에서 끝나고, 이보다 뒤에서는 매치를 찾지 않는다.
+constexpr std::size_t kLastLiterals = 5;
+constexpr std::size_t kMatchSearchLimit = 12;
+constexpr std::size_t kMaxOffset = 65535;
+
+inline std::uint32_t read32(const std::byte* p) {
+    std::uint32_t v = 0;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline std::uint32_t hash(std::uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - kHashBits);
+}
+
+inline std::byte* writeLength(std::byte* out, std::size_t length) {
+    for (; length >= 255; length -= 255) *out++ = std::byte{255};
+    *out++ = static_cast<std::byte>(length);
+    return out;
+}
+
+inline std::byte* writeSequence(std::byte* out,
+                                const std::byte* literals,
+                                std::size_t literalLength,
+                                std::size_t offset,
+                                std::size_t matchLength) {
+    std::byte* const token = out++;
+    const std::size_t matchCode = matchLength >= kMinMatch ? matchLength - kMinMatch : 0;
+    *token = static_cast<std::byte>((std::min<std::size_t>(literalLength, 15) << 4) | std::min<std::size_t>(matchCode, 15));
+    if (literalLength >= 15) out = writeLength(out, literalLength - 15);
+    if (literalLength > 0) std::memcpy(out, literals, literalLength);
+    out += literalLength;
+    if (matchLength == 0) return out;
+    *out++ = static_cast<std::byte>(offset & 0xFF);
+    *out++ = static_cast<std::byte>(offset >> 8);
+    if (matchCode >= 15) out = writeLength(out, matchCode - 15);
+    return out;
+}
+
+} // namespace lz_detail
+
+// 압축 결과가 넘지 않는 크기(압축되지 않는 입력의 리터럴 길이 확장 포함).
+constexpr std::size_t lzCompressBound(std::size_t size) {
+    return size + size / 255 + 16;
+}
+
+// dst는 lzCompressBound(src.size()) 바이트 이상이어야 한다. 쓴 바이트 수를 돌려준다.
+// 해시 테이블은 스택의 16KB이며 할당이 없다. 연속으로 매치가 없으면 검색 간격을 넓혀
+// 압축되지 않는 데이터를 빨리 지나간다.
+inline std::size_t lzCompress(std::span<const std::byte> src, std::span<std::byte> dst) {
+    using namespace lz_detail;
+    if (dst.size() < lzCompressBound(src.size())) return 0;
+
+    const std::byte* const base = src.data();
+    const std::size_t size = src.size();
+    std::byte* out = dst.data();
+    std::size_t anchor = 0;
+
+    if (size > kMatchSearchLimit) {
+        std::array<std::uint32_t, std::size_t{1} << kHashBits> table{};
+        const std::size_t searchEnd = size - kMatchSearchLimit;
+        const std::size_t matchEnd = size - kLastLiterals;
+        std::size_t pos = 0;
+        std::size_t misses = 0;
+        while (pos < searchEnd) {
+            const std::uint32_t sequence = read32(base + pos);
+            const std::uint32_t slot = hash(sequence);
+            const std::size_t candidate = table[slot];
+            table[slot] = static_cast<std::uint32_t>(pos);
+            if (candidate >= pos || pos - candidate > kMaxOffset || read32(base + candidate) != sequence) {
+                pos += 1 + (misses++ >> 6);
+                continue;
+            }
+            misses = 0;
+
+            // 매치를 앞(리터럴 쪽)과 뒤로 늘린다.
+            std::size_t start = pos;
+            std::size_t from = candidate;
+            while (start > anchor && from > 0 && base[start - 1] == base[from - 1]) {
+                --start;
+                --from;
+            }
+            std::size_t length = pos - start + kMinMatch;
+            while (start + length < matchEnd && base[start + length] == base[from + length]) ++length;
+
+            out = writeSequence(out, base + anchor, start - anchor, start - from, length);
+            anchor = start + length;
+            pos = anchor;
+            // 매치 안쪽 위치 하나를 등록해 다음 반복 구간을 놓치지 않게 한다.
+            if (pos >= 2 && pos - 2 < searchEnd) table[hash(read32(base + pos - 2))] = static_cast<std::uint32_t>(pos - 2);
+        }
+    }
+    out = writeSequence(out, base + anchor, size - anchor, 0, 0);
+    return static_cast<std::size_t>(out - dst.data());
+}
+
+// dst.size() 바이트를 정확히 복원하면 true. 잘리거나 범위를 벗어나는 입력은 false이며
+// dst 밖을 쓰거나 src 밖을 읽지 않는다.
+inline bool lzDecompress(std::span<const std::byte> src, std::span<std::byte> dst) {
+    using namespace lz_detail;
+    const std::byte* in = src.data();
+    const std::byte* const inEnd = in + src.size();
+    std::byte* out = dst.data();
+    std::byte* const outEnd = out + dst.size();
+
+    const auto readLength = [&](std::size_t& length) {
+        for (;;) {
+            if (in >= inEnd) return false;
+            const std::size_t part = std::to_integer<std::size_t>(*in++);
+            length += part;
+            if (part != 255) return true;
+        }
+    };
+
+    while (in < inEnd) {
+        const std::size_t token = std::to_integer<std::size_t>(*in++);
+        std::size_t literalLength = token >> 4;
+        if (literalLength == 15 && !readLength(literalLength)) return false;
+        if (literalLength > static_cast<std::size_t>(inEnd - in) || literalLength > static_cast<std::size_t>(outEnd - out)) return false;
+        // 짧은 리터럴은 여유가 있으면 고정 16바이트 복사(넘친 부분은 다음 쓰기가 덮는다).
+        if (literalLength <= 16 && inEnd - in >= 16 && outEnd - out >= 16) {
+            std::memcpy(out, in, 16);
+        } else if (literalLength > 0) {
+            std::memcpy(out, in, literalLength);
+        }
+        in += literalLength;
+        out += literalLength;
+        // 오프셋이 없는 마지막 시퀀스.
+        if (in == inEnd) break;
+
+        if (inEnd - in < 2) return false;
+        const std::size_t offset = std::to_integer<std::size_t>(in[0]) | (std::to_integer<std::size_t>(in[1]) << 8);
+        in += 2;
+        std::size_t matchLength = token & 0x0F;
+        if (matchLength == 15 && !readLength(matchLength)) return false;
+        matchLength += kMinMatch;
+        if (offset == 0 || offset > static_cast<std::size_t>(out - dst.data()) ||
+            matchLength > static_cast<std::size_t>(outEnd - out)) {
+            return false;
+        }
+        const std::byte* match = out - offset;
+        std::byte* const matchEnd = out + matchLength;
+        if (offset >= 8 && outEnd - matchEnd >= 8) {
+            // 8바이트 단위 복사. 오프셋이 8 이상이면 겹쳐도 앞에서부터 읽는 값은 이미 쓰여 있다.
+            do {
+                std::memcpy(out, match, 8);
+                out += 8;
+                match += 8;
+            } while (out < matchEnd);
+            out = matchEnd;
+        } else if (offset >= matchLength) {
+            std::memcpy(out, match, matchLength);
+            out = matchEnd;
+        } else {
+            // 짧은 주기의 겹치는 복사(반복 패턴)는 앞에서부터 한 바이트씩.
+            while (out < matchEnd) *out++ = *match++;
+        }
+    }
+    return out == outEnd;
+}
+
+// TODO [Core-Serialization-005]:
+// 책임: 의존성 없는 빠른 블록 압축/해제(팩 아카이브, 캐시 페이로드)
+// 요구사항:
+//  - LZ77 계열 시퀀스 포맷, 64KB 이하 블록
+//  - 할당 없는 압축(스택 해시 테이블), 상한 크기 제공
+//  - 경계 검사하는 해제(손상 입력에서 false)
+// 의존성:
+//  - 없음
+// 구현 단계: Phase D
+// 성능 고려사항:
+//  - 해제는 memcpy 위주로 GB/s 수준
+//  - 매치 실패가 이어지면 검색 간격 확대(비압축 데이터 통과 비용 제한)
+//  - 압축률보다 속도 우선(해시 체인 없음)
+// 테스트 전략:
+//  - 빈/짧은/반복/무작위 입력 라운드트립 테스트
+//  - 잘린·변조 입력에서 실패 반환 테스트
+
+} // namespace rex::core::serialization
@@ -0,0 +1,203 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "../ECS/ComponentStorage.h"
+#include "../Reflection/PropertyMetadata.h"
+#include "BinaryStream.h"
+
+namespace rex::core::serialization {
+
+// 컬럼 블록 정렬. 레코드 구간이 항상 이 배수에서 시작한다.
+constexpr std::size_t kColumnAlignment = 16;
+
+// 저장 레이아웃의 [srcOffset, srcOffset+size)를 현재 레이아웃의 dstOffset으로 옮기는 구간.
+struct ColumnCopyRun {
+    std::uint32_t srcOffset = 0;
+    std::uint32_t dstOffset = 0;
+    std::uint32_t size = 0;
+};
+
+struct ColumnCopyPlan {
+    std::vector<ColumnCopyRun> runs;
+    // 저장 스키마와 이름/타입명/크기가 맞지 않아 기본값으로 남는 현재 필드 수.
+    std::uint32_t missingFields = 0;
+    // 현재 타입에 없어 버려지는 저장 필드 수.
+    std::uint32_t droppedFields = 0;
+};
+
+// 이름으로 필드를 짝짓고 타입명/크기가 같은 것만 복사한다. 양쪽에서 이어지는 필드는
+// 한 구간으로 합치므로, 레이아웃이 같고 필드가 빈틈없이 등록된 타입은 레코드당 memcpy 1회가 된다.
+inline ColumnCopyPlan buildCopyPlan(const reflection::TypeMetadata& saved, const reflection::TypeMetadata& current) {
+    ColumnCopyPlan plan{};
+    std::vector<bool> used(saved.properties.size(), false);
+    for (const reflection::PropertyMetadata& field : current.properties) {
+        bool matched = false;
+        for (std::size_t i = 0; i < saved.properties.size(); ++i) {
+            const reflection::PropertyMetadata& source = saved.properties[i];
+            if (used[i] || source.name != field.name) continue;
+            if (source.typeName != field.typeName || source.size != field.size) break;
+            if (source.offset + source.size > saved.size || field.offset + field.size > current.size) break;
+            used[i] = true;
+            matched = true;
+            plan.runs.push_back({static_cast<std::uint32_t>(source.offset),
+                                 static_cast<std::uint32_t>(field.offset),
+                                 static_cast<std::uint32_t>(field.size)});
+            break;
+        }
+        if (!matched) ++plan.missingFields;
+    }
+    plan.droppedFields = static_cast<std::uint32_t>(std::count(used.begin(), used.end(), false));
+
+    std::sort(plan.runs.begin(), plan.runs.end(), [](const ColumnCopyRun& a, const ColumnCopyRun& b) {
+        return a.dstOffset < b.dstOffset;
+    });
+    std::vector<ColumnCopyRun> merged;
+    merged.reserve(plan.runs.size());
+    for (const ColumnCopyRun& run : plan.runs) {
+        if (!merged.empty()) {
+            ColumnCopyRun& last = merged.back();
+            if (last.srcOffset + last.size == run.srcOffset && last.dstOffset + last.size == run.dstOffset) {
+                last.size += run.size;
+                continue;
+            }
+        }
+        merged.push_back(run);
+    }
+    plan.runs = std::move(merged);
+    return plan;
+}
+
+inline void applyCopyPlan(const ColumnCopyPlan& plan, const std::byte* source, void* destination) {
+    auto* out = static_cast<std::byte*>(destination);
+    for (const ColumnCopyRun& run : plan.runs) {
+        std::memcpy(out + run.dstOffset, source + run.srcOffset, run.size);
+    }
+}
+
+// 스키마: 타입명, 레코드 크기, 필드(이름/타입명/오프셋/크기) 목록.
+inline void writeSchema(BinaryWriter& out, const reflection::TypeMetadata& metadata) {
+    out.writeString(metadata.name);
+    out.write(static_cast<std::uint32_t>(metadata.size));
+    out.write(static_cast<std::uint32_t>(metadata.properties.size()));
+    for (const reflection::PropertyMetadata& property : metadata.properties) {
+        out.writeString(property.name);
+        out.writeString(property.typeName);
+        out.write(static_cast<std::uint32_t>(property.offset));
+        out.write(static_cast<std::uint32_t>(property.size));
+    }
+}
+
+inline bool readSchema(BinaryReader& in, reflection::TypeMetadata& out) {
+    std::uint32_t size = 0;
+    std::uint32_t propertyCount = 0;
+    if (!in.readString(out.name) || !in.read(size) || !in.read(propertyCount)) return false;
+    out.size = size;
+    out.properties.clear();
+    out.properties.reserve(std::min<std::size_t>(propertyCount, in.remaining() / 16));
+    for (std::uint32_t i = 0; i < propertyCount; ++i) {
+        reflection::PropertyMetadata property{};
+        std::uint32_t offset = 0;
+        std::uint32_t propertySize = 0;
+        if (!in.readString(property.name) || !in.readString(property.typeName) ||
+            !in.read(offset) || !in.read(propertySize)) {
+            return false;
+        }
+        property.offset = offset;
+        property.size = propertySize;
+        out.properties.push_back(std::move(property));
+    }
+    return in.ok();
+}
+
+// 컬럼 블록: 스키마, 개수, (정렬) 엔티티 ID 열, (정렬) 레코드 열.
+// 레코드는 등록된 필드만 복사하고 나머지(포인터, 패딩)는 0으로 남긴다.
+template <typename T>
+void writeColumn(BinaryWriter& out, const reflection::TypeMetadata& metadata, const ecs::TypedComponentPool<T>& pool) {
+    static_assert(std::is_trivially_copyable_v<T>, "column serialization requires trivially copyable components");
+    const ColumnCopyPlan plan = buildCopyPlan(metadata, metadata);
+    const auto count = static_cast<std::uint32_t>(pool.components.size());
+
+    writeSchema(out, metadata);
+    out.write(count);
+
+    out.align(kColumnAlignment);
+    auto* ids = reinterpret_cast<ecs::EntityId*>(out.grow(std::size_t{count} * sizeof(ecs::EntityId)));
+    std::size_t index = 0;
+    for (const auto& [id, component] : pool.components) {
+        (void)component;
+        std::memcpy(ids + index++, &id, sizeof(id));
+    }
+
+    out.align(kColumnAlignment);
+    std::byte* records = out.grow(std::size_t{count} * sizeof(T));
+    for (const auto& [id, component] : pool.components) {
+        (void)id;
+        applyCopyPlan(plan, reinterpret_cast<const std::byte*>(&component), records);
+        records += sizeof(T);
+    }
+}
+
+// 스키마 다음부터 컬럼을 읽어 pool에 넣는다. 저장 스키마가 현재와 다르면 필드 이름으로 재배치한다.
+template <typename T>
+bool readColumn(BinaryReader& in, const reflection::TypeMetadata& saved, const reflection::TypeMetadata& current,
+                ecs::TypedComponentPool<T>& pool, ColumnCopyPlan* planOut = nullptr) {
+    static_assert(std::is_trivially_copyable_v<T>, "column serialization requires trivially copyable components");
+    std::uint32_t count = 0;
+    if (!in.read(count) || !in.align(kColumnAlignment)) return false;
+    const std::span<const std::byte> ids = in.readBytes(std::size_t{count} * sizeof(ecs::EntityId));
+    if (!in.align(kColumnAlignment)) return false;
+    const std::span<const std::byte> records = in.readBytes(std::size_t{count} * saved.size);
+    if (!in.ok()) return false;
+
+    const ColumnCopyPlan plan = buildCopyPlan(saved, current);
+    pool.components.reserve(pool.components.size() + count);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        ecs::EntityId id = 0;
+        std::memcpy(&id, ids.data() + std::size_t{i} * sizeof(id), sizeof(id));
+        T value{};
+        applyCopyPlan(plan, records.data() + std::size_t{i} * saved.size, &value);
+        pool.emplaceOrAssign(id, value);
+    }
+    if (planOut) *planOut = plan;
+    return true;
+}
+
+// 등록되지 않은 타입의 컬럼을 건너뛴다.
+inline bool skipColumn(BinaryReader& in, const reflection::TypeMetadata& saved) {
+    std::uint32_t count = 0;
+    if (!in.read(count) || !in.align(kColumnAlignment)) return false;
+    in.skip(std::size_t{count} * sizeof(ecs::EntityId));
+    in.align(kColumnAlignment);
+    in.skip(std::size_t{count} * saved.size);
+    return in.ok();
+}
+
+// TODO [Core-Serialization-002]:
+// 책임: 리플렉션 메타 기반 컴포넌트 컬럼 직렬화
+// 요구사항:
+//  - 스키마 헤더(필드 이름/타입명/오프셋/크기) 기록
+//  - 엔티티 ID 열 + 레코드 열을 정렬된 블록으로 기록
+//  - 필드 이름 기반 버전 간 재배치(추가 필드는 기본값, 삭제 필드는 무시)
+//  - 미등록 타입 컬럼 건너뛰기
+// 의존성:
+//  - ECS/ComponentStorage
+//  - Reflection/PropertyMetadata
+//  - Serialization/BinaryStream
+// 구현 단계: Phase D
+// 성능 고려사항:
+//  - 인접 필드 구간 병합으로 레코드당 memcpy 최소화
+//  - 파싱 없이 블록 단위 읽기(복사 0회 span)
+//  - 포인터/패딩은 0으로 기록해 파일에 주소가 남지 않게 함
+// 테스트 전략:
+//  - 동일 스키마 라운드트립 테스트
+//  - 필드 추가/삭제/재배치 스키마 로드 테스트
+//  - 잘린 파일 실패 테스트
+
+} // namespace rex::core::serialization
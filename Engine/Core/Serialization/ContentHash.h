@@ -0,0 +1,133 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace rex::core::serialization {
+
+// XXH64 알고리즘. 내용 주소 지정(캐시 키, 무결성 검사)용이며 암호학적 해시가 아니다.
+inline std::uint64_t hash64(std::span<const std::byte> bytes, std::uint64_t seed = 0) {
+    constexpr std::uint64_t kPrime1 = 0x9E3779B185EBCA87ull;
+    constexpr std::uint64_t kPrime2 = 0xC2B2AE3D27D4EB4Full;
+    constexpr std::uint64_t kPrime3 = 0x165667B19E3779F9ull;
+    constexpr std::uint64_t kPrime4 = 0x85EBCA77C2B2AE63ull;
+    constexpr std::uint64_t kPrime5 = 0x27D4EB2F165667C5ull;
+
+    const auto read64 = [](const std::byte* p) {
+        std::uint64_t v = 0;
+        std::memcpy(&v, p, sizeof(v));
+        return v;
+    };
+    const auto read32 = [](const std::byte* p) {
+        std::uint32_t v = 0;
+        std::memcpy(&v, p, sizeof(v));
+        return v;
+    };
+    const auto round = [](std::uint64_t acc, std::uint64_t input) {
+        acc += input * kPrime2;
+        acc = std::rotl(acc, 31);
+        return acc * kPrime1;
+    };
+    const auto merge = [&](std::uint64_t acc, std::uint64_t value) {
+        acc ^= round(0, value);
+        return acc * kPrime1 + kPrime4;
+    };
+
+    const std::byte* p = bytes.data();
+    const std::byte* const end = p + bytes.size();
+    std::uint64_t h = 0;
+
+    if (bytes.size() >= 32) {
+        std::uint64_t v1 = seed + kPrime1 + kPrime2;
+        std::uint64_t v2 = seed + kPrime2;
+        std::uint64_t v3 = seed;
+        std::uint64_t v4 = seed - kPrime1;
+        const std::byte* const limit = end - 32;
+        do {
+            v1 = round(v1, read64(p));
+            v2 = round(v2, read64(p + 8));
+            v3 = round(v3, read64(p + 16));
+            v4 = round(v4, read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+        h = std::rotl(v1, 1) + std::rotl(v2, 7) + std::rotl(v3, 12) + std::rotl(v4, 18);
+        h = merge(h, v1);
+        h = merge(h, v2);
+        h = merge(h, v3);
+        h = merge(h, v4);
+    } else {
+        h = seed + kPrime5;
+    }
+
+    h += static_cast<std::uint64_t>(bytes.size());
+    for (; p + 8 <= end; p += 8) {
+        h ^= round(0, read64(p));
+        h = std::rotl(h, 27) * kPrime1 + kPrime4;
+    }
+    if (p + 4 <= end) {
+        h ^= static_cast<std::uint64_t>(read32(p)) * kPrime1;
+        h = std::rotl(h, 23) * kPrime2 + kPrime3;
+        p += 4;
+    }
+    for (; p < end; ++p) {
+        h ^= static_cast<std::uint64_t>(std::to_integer<std::uint8_t>(*p)) * kPrime5;
+        h = std::rotl(h, 11) * kPrime1;
+    }
+
+    h ^= h >> 33;
+    h *= kPrime2;
+    h ^= h >> 29;
+    h *= kPrime3;
+    h ^= h >> 32;
+    return h;
+}
+
+inline std::uint64_t hash64(std::string_view text, std::uint64_t seed = 0) {
+    return hash64(std::as_bytes(std::span<const char>(text.data(), text.size())), seed);
+}
+
+// 서로 다른 시드의 64비트 해시 두 개. 캐시 키처럼 충돌이 곧 오동작인 곳에 쓴다.
+struct ContentHash {
+    std::uint64_t high = 0;
+    std::uint64_t low = 0;
+
+    bool operator==(const ContentHash&) const = default;
+
+    // 32자리 소문자 16진수.
+    std::string toHex() const {
+        constexpr char kDigits[] = "0123456789abcdef";
+        std::string out(32, '0');
+        for (int i = 0; i < 16; ++i) {
+            out[15 - i] = kDigits[(high >> (i * 4)) & 0xF];
+            out[31 - i] = kDigits[(low >> (i * 4)) & 0xF];
+        }
+        return out;
+    }
+};
+
+inline ContentHash hash128(std::span<const std::byte> bytes) {
+    return {hash64(bytes, 0x52455844444331ull), hash64(bytes, 0x9E3779B97F4A7C15ull)};
+}
+
+// TODO [Core-Serialization-004]:
+// 책임: 내용 기반 해시 제공(캐시 키/무결성)
+// 요구사항:
+//  - 64비트 XXH64 호환 해시
+//  - 128비트 키와 16진수 표기
+// 의존성:
+//  - 없음
+// 구현 단계: Phase D
+// 성능 고려사항:
+//  - 32바이트 블록 4레인 처리(메모리 대역폭 수준)
+//  - 할당 없음
+// 테스트 전략:
+//  - XXH64 공개 테스트 벡터 일치 테스트
+//  - 길이 경계(0/3/4/8/31/32/33) 테스트
+
+} // namespace rex::core::serialization
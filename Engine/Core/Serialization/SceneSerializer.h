@@ -0,0 +1,273 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../Diagnostics/Logger.h"
+#include "../Platform/FileSystem.h"
+#include "../Reflection/FieldList.h"
+#include "../Reflection/TypeRegistry.h"
+#include "../Resource/AssetPath.h"
+#include "../Scene.h"
+#include "BinaryStream.h"
+#include "ColumnSerializer.h"
+
+namespace rex::core::serialization {
+
+constexpr std::array<char, 8> kSceneFileMagic{'R', 'E', 'X', 'S', 'C', 'E', 'N', 'E'};
+constexpr std::uint32_t kSceneFileVersion = 2;
+constexpr std::uint32_t kSceneEndianTag = 0x01020304u;
+
+// 파일 선두 고정 헤더. 이후: 엔티티 ID 열(정렬), 컬럼 블록 columnCount개, 에셋 경로 표(u32 개수 + (ID, 경로) 목록).
+struct SceneFileHeader {
+    std::array<char, 8> magic = kSceneFileMagic;
+    std::uint32_t version = kSceneFileVersion;
+    std::uint32_t endianTag = kSceneEndianTag;
+    std::uint32_t entityCount = 0;
+    std::uint32_t columnCount = 0;
+    // 헤더 뒤 바이트 수. 잘린 파일을 파싱 전에 거른다.
+    std::uint64_t payloadBytes = 0;
+};
+static_assert(std::is_trivially_copyable_v<SceneFileHeader>);
+
+struct SceneLoadReport {
+    std::uint32_t entities = 0;
+    std::uint32_t components = 0;
+    std::uint32_t columns = 0;
+    // 현재 등록되지 않은 타입이라 건너뛴 컬럼 수.
+    std::uint32_t skippedColumns = 0;
+    // 스키마가 달라 기본값으로 남은 필드/버려진 필드 수(컬럼 합계).
+    std::uint32_t missingFields = 0;
+    std::uint32_t droppedFields = 0;
+    // 파일에 실린 에셋 경로 표 항목 수.
+    std::uint32_t assetPaths = 0;
+};
+
+// 등록된 컴포넌트 타입을 리플렉션 메타 기반 컬럼 블록으로 저장/복원한다.
+// 파일 전체를 버퍼 하나로 만들고 한 번에 쓰며, 읽을 때도 한 번에 읽은 뒤 블록 단위로 복사한다.
+// 컴포넌트는 trivially copyable이어야 하고, 등록되지 않은 필드(런타임 포인터 등)는 기본값으로 복원된다.
+// 에셋 참조는 컴포넌트에 AssetId 필드로 두고, 경로 표를 함께 저장해 로드 후 경로로 다시 acquire한다.
+class SceneSerializer {
+public:
+    // T는 TypeRegistry에 프로퍼티와 함께 등록되어 있거나 REX_REFLECT_FIELDS로 필드 목록이 있어야 한다.
+    template <typename T>
+    bool registerComponent() {
+        static_assert(std::is_trivially_copyable_v<T>, "SceneSerializer requires trivially copyable components");
+        static_assert(std::is_default_constructible_v<T>, "SceneSerializer requires default-constructible components");
+        const reflection::TypeMetadata* metadata = reflection::TypeRegistry::instance().find<T>();
+        if constexpr (reflection::HasFieldList<T>) {
+            if (!metadata) metadata = &reflection::registerFields<T>();
+        }
+        if (!metadata || metadata->size != sizeof(T)) {
+            Logger::error("SceneSerializer: component type is not reflected");
+            return false;
+        }
+        for (const ColumnHandler& handler : handlers_) {
+            if (handler.metadata == metadata) return true;
+        }
+        handlers_.push_back({metadata, &saveColumn<T>, &loadColumn<T>});
+        return true;
+    }
+
+    // assets가 있으면 표 전체를 파일 끝에 싣는다(컴포넌트가 참조하는 AssetId의 경로).
+    std::vector<std::byte> save(const Scene& scene, const resource::AssetPathTable* assets = nullptr) const {
+        const ecs::World& world = scene.world();
+        BinaryWriter out;
+        out.reserve(sizeof(SceneFileHeader) + world.entities().size() * 64);
+
+        SceneFileHeader header{};
+        header.entityCount = static_cast<std::uint32_t>(world.entities().size());
+        out.write(header);
+
+        out.align(kColumnAlignment);
+        auto* ids = reinterpret_cast<ecs::EntityId*>(out.grow(world.entities().size() * sizeof(ecs::EntityId)));
+        for (const ecs::EntityId id : world.entities()) {
+            std::memcpy(ids++, &id, sizeof(id));
+        }
+
+        std::uint32_t columns = 0;
+        for (const ColumnHandler& handler : handlers_) {
+            if (handler.save(out, *handler.metadata, world)) ++columns;
+        }
+        writeAssetPaths(out, assets);
+
+        header.columnCount = columns;
+        header.payloadBytes = out.size() - sizeof(SceneFileHeader);
+        out.patch(0, header);
+        return out.take();
+    }
+
+    bool saveToFile(const Scene& scene, const std::filesystem::path& path,
+                    const resource::AssetPathTable* assets = nullptr) const {
+        const std::vector<std::byte> bytes = save(scene, assets);
+        if (!platform::FileSystem::writeBinary(path, bytes)) {
+            Logger::error("Failed to write scene: {}", path.string());
+            return false;
+        }
+        return true;
+    }
+
+    // 실패하면 scene은 비워진 상태일 수 있다. assets가 있으면 파일의 경로 표를 합쳐 넣는다.
+    bool load(std::span<const std::byte> bytes, Scene& scene, SceneLoadReport* report = nullptr,
+              resource::AssetPathTable* assets = nullptr) const {
+        BinaryReader in(bytes);
+        SceneFileHeader header{};
+        if (!in.read(header) || header.magic != kSceneFileMagic) {
+            Logger::error("Scene load: not a binary scene file");
+            return false;
+        }
+        if (header.endianTag != kSceneEndianTag || header.version != kSceneFileVersion) {
+            Logger::error("Scene load: unsupported version {} or byte order", header.version);
+            return false;
+        }
+        if (header.payloadBytes != in.remaining()) {
+            Logger::error("Scene load: expected {} payload bytes, found {}", header.payloadBytes, in.remaining());
+            return false;
+        }
+
+        scene.clear();
+        ecs::World& world = scene.world();
+        SceneLoadReport local{};
+        local.entities = header.entityCount;
+
+        in.align(kColumnAlignment);
+        const std::span<const std::byte> ids = in.readBytes(std::size_t{header.entityCount} * sizeof(ecs::EntityId));
+        if (!in.ok()) return false;
+        world.reserveEntities(header.entityCount);
+        for (std::uint32_t i = 0; i < header.entityCount; ++i) {
+            ecs::EntityId id = 0;
+            std::memcpy(&id, ids.data() + std::size_t{i} * sizeof(id), sizeof(id));
+            world.restoreEntity(id);
+        }
+
+        reflection::TypeMetadata saved{};
+        for (std::uint32_t column = 0; column < header.columnCount; ++column) {
+            in.align(kColumnAlignment);
+            if (!readSchema(in, saved)) break;
+            const ColumnHandler* handler = findHandler(saved.name);
+            if (!handler) {
+                Logger::warn("Scene load: skipping unknown component column '{}'", saved.name);
+                ++local.skippedColumns;
+                if (!skipColumn(in, saved)) break;
+                continue;
+            }
+            if (!handler->load(in, saved, *handler->metadata, world, local)) break;
+            ++local.columns;
+        }
+        if (in.ok()) readAssetPaths(in, assets, local);
+        if (!in.ok()) {
+            Logger::error("Scene load: truncated or corrupt column data");
+            return false;
+        }
+
+        if (report) *report = local;
+        return true;
+    }
+
+    bool loadFromFile(const std::filesystem::path& path, Scene& scene, SceneLoadReport* report = nullptr,
+                      resource::AssetPathTable* assets = nullptr) const {
+        const auto bytes = platform::FileSystem::readBinary(path);
+        if (!bytes) {
+            Logger::error("Failed to read scene: {}", path.string());
+            return false;
+        }
+        return load(*bytes, scene, report, assets);
+    }
+
+private:
+    using SaveFn = bool (*)(BinaryWriter&, const reflection::TypeMetadata&, const ecs::World&);
+    using LoadFn = bool (*)(BinaryReader&, const reflection::TypeMetadata& saved,
+                            const reflection::TypeMetadata& current, ecs::World&, SceneLoadReport&);
+
+    struct ColumnHandler {
+        const reflection::TypeMetadata* metadata = nullptr;
+        SaveFn save = nullptr;
+        LoadFn load = nullptr;
+    };
+
+    template <typename T>
+    static bool saveColumn(BinaryWriter& out, const reflection::TypeMetadata& metadata, const ecs::World& world) {
+        const ecs::TypedComponentPool<T>* pool = world.storage().template tryPool<T>();
+        if (!pool || pool->components.empty()) return false;
+        out.align(kColumnAlignment);
+        writeColumn(out, metadata, *pool);
+        return true;
+    }
+
+    template <typename T>
+    static bool loadColumn(BinaryReader& in, const reflection::TypeMetadata& saved,
+                           const reflection::TypeMetadata& current, ecs::World& world, SceneLoadReport& report) {
+        ColumnCopyPlan plan{};
+        ecs::TypedComponentPool<T>& pool = world.storage().template pool<T>();
+        const std::size_t before = pool.components.size();
+        if (!readColumn(in, saved, current, pool, &plan)) return false;
+        report.components += static_cast<std::uint32_t>(pool.components.size() - before);
+        report.missingFields += plan.missingFields;
+        report.droppedFields += plan.droppedFields;
+        return true;
+    }
+
+    static void writeAssetPaths(BinaryWriter& out, const resource::AssetPathTable* assets) {
+        const std::uint32_t count = assets ? static_cast<std::uint32_t>(assets->size()) : 0u;
+        out.write(count);
+        if (!assets) return;
+        for (const auto& [id, path] : assets->entries()) {
+            out.write(id);
+            out.writeString(path);
+        }
+    }
+
+    static void readAssetPaths(BinaryReader& in, resource::AssetPathTable* assets, SceneLoadReport& report) {
+        std::uint32_t count = 0;
+        if (!in.read(count)) return;
+        std::string path;
+        for (std::uint32_t i = 0; i < count; ++i) {
+            resource::AssetId id = 0;
+            if (!in.read(id) || !in.readString(path)) return;
+            if (assets) assets->insert(id, path);
+        }
+        report.assetPaths = count;
+    }
+
+    const ColumnHandler* findHandler(const std::string& typeName) const {
+        for (const ColumnHandler& handler : handlers_) {
+            if (handler.metadata->name == typeName) return &handler;
+        }
+        return nullptr;
+    }
+
+    std::vector<ColumnHandler> handlers_;
+};
+
+// TODO [Core-Serialization-003]:
+// 책임: 씬 바이너리 저장/로드
+// 요구사항:
+//  - 매직/버전/endian 태그/페이로드 크기 헤더
+//  - 엔티티 ID 열 + 등록 컴포넌트 컬럼 블록
+//  - 에셋 경로 표(AssetId -> 경로)
+//  - 스키마 차이 재배치 및 결과 리포트
+//  - 파일 단위 단일 read/write
+// 의존성:
+//  - Core/Scene
+//  - Reflection/TypeRegistry, FieldList
+//  - Serialization/ColumnSerializer
+//  - Platform/FileSystem
+//  - Resource/AssetPath
+// 구현 단계: Phase D
+// 성능 고려사항:
+//  - 저장 시 버퍼 1개, 파일 write 1회
+//  - 로드 비용은 파일 읽기 + 컬럼 memcpy + 풀 삽입
+//  - 에셋 참조는 AssetId 필드 + 파일당 경로 표 1개(엔티티마다 문자열을 쓰지 않음)
+// 테스트 전략:
+//  - 저장/로드 라운드트립 동등성 테스트
+//  - 미등록 컬럼 건너뛰기 테스트
+//  - 헤더 손상/잘림 거부 테스트
+
+} // namespace rex::core::serialization
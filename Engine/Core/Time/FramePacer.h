@@ -0,0 +1,146 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <immintrin.h>
+#define REX_FRAME_PACER_PAUSE() _mm_pause()
+#else
+#define REX_FRAME_PACER_PAUSE() std::this_thread::yield()
+#endif
+
+namespace rex::core::time {
+
+struct FramePacerConfig {
+    // 0이면 대기하지 않는다(vsync에 맡기거나 무제한).
+    double targetFps = 0.0;
+    // 마감 직전 이 구간은 sleep 대신 spin으로 기다린다.
+    double spinWindowMs = 1.0;
+    // oversleep 추정치가 줄어들 때의 EMA 가중치. 늘어날 때는 더 빠르게 따라간다.
+    double oversleepSmoothing = 0.05;
+};
+
+// 목표 프레임 레이트에 맞춰 프레임 마감까지 대기한다.
+// 마감 - (spin 구간 + 관측된 oversleep)까지 sleep한 뒤 나머지를 spin한다.
+class FramePacer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit FramePacer(FramePacerConfig config = {}) {
+        configure(config);
+    }
+
+    void configure(const FramePacerConfig& config) {
+        config_ = config;
+        period_ = config_.targetFps > 0.0
+            ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / config_.targetFps))
+            : Clock::duration::zero();
+        started_ = false;
+    }
+
+    void setTargetFps(double fps) {
+        FramePacerConfig config = config_;
+        config.targetFps = fps;
+        configure(config);
+    }
+
+    // 프레임 작업이 끝난 뒤 호출한다. 다음 프레임의 시작 시각을 반환한다.
+    Clock::time_point wait() {
+        const auto now = Clock::now();
+        if (period_ == Clock::duration::zero()) {
+            lastWaitMs_ = 0.0;
+            return now;
+        }
+
+        if (!started_) {
+            started_ = true;
+            deadline_ = now + period_;
+            lastWaitMs_ = 0.0;
+            return now;
+        }
+
+        if (now >= deadline_) {
+            ++missedDeadlines_;
+            // 한 주기 이상 밀렸으면 따라잡으려 연속 프레임을 몰아 내지 않고 기준을 다시 잡는다.
+            if (now - deadline_ > period_) deadline_ = now;
+        } else {
+            sleepAndSpin(now);
+        }
+
+        const auto frameStart = Clock::now();
+        lastWaitMs_ = toMs(frameStart - now);
+        deadline_ += period_;
+        return frameStart;
+    }
+
+    double targetFps() const {
+        return config_.targetFps;
+    }
+
+    double oversleepEstimateMs() const {
+        return oversleepMs_;
+    }
+
+    double lastWaitMs() const {
+        return lastWaitMs_;
+    }
+
+    std::uint64_t missedDeadlines() const {
+        return missedDeadlines_;
+    }
+
+private:
+    static double toMs(Clock::duration d) {
+        return std::chrono::duration<double, std::milli>(d).count();
+    }
+
+    static Clock::duration fromMs(double ms) {
+        return std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(ms));
+    }
+
+    void sleepAndSpin(Clock::time_point now) {
+        const auto wakeAt = deadline_ - fromMs(config_.spinWindowMs + oversleepMs_);
+        if (wakeAt > now) {
+            std::this_thread::sleep_until(wakeAt);
+            const double oversleep = std::max(0.0, toMs(Clock::now() - wakeAt));
+            const double alpha = oversleep > oversleepMs_ ? 0.5 : config_.oversleepSmoothing;
+            oversleepMs_ += (oversleep - oversleepMs_) * alpha;
+            // 한 주기를 넘는 추정은 의미가 없다(스케줄러 일시 정지 등 이상치).
+            oversleepMs_ = std::min(oversleepMs_, toMs(period_));
+        }
+
+        while (Clock::now() < deadline_) {
+            REX_FRAME_PACER_PAUSE();
+        }
+    }
+
+    FramePacerConfig config_{};
+    Clock::duration period_{};
+    Clock::time_point deadline_{};
+    bool started_ = false;
+    double oversleepMs_ = 0.0;
+    double lastWaitMs_ = 0.0;
+    std::uint64_t missedDeadlines_ = 0;
+};
+
+// TODO [Core-Time-003]:
+// 책임: 목표 프레임 레이트 기반 하이브리드 sleep/spin 프레임 페이싱
+// 요구사항:
+//  - 목표 FPS 설정(0이면 비활성)
+//  - coarse sleep 후 마지막 구간 spin
+//  - 측정된 oversleep에 적응
+//  - 마감 누락 시 재동기화
+// 의존성:
+//  - 없음
+// 구현 단계: Phase D
+// 성능 고려사항:
+//  - spin 구간을 짧게 유지해 CPU 점유 제한
+//  - 타이머 해상도가 낮은 플랫폼에서 oversleep 보정
+// 테스트 전략:
+//  - 목표 FPS 대비 평균/지터 측정 테스트
+//  - 마감 누락 후 재동기화 테스트
+
+} // namespace rex::core::time
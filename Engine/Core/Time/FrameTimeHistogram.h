@@ -0,0 +1,251 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+namespace rex::core::time {
+
+struct FrameTimePercentiles {
+    double p50 = 0.0;
+    double p95 = 0.0;
+    double p99 = 0.0;
+    double max = 0.0;
+    double mean = 0.0;
+    std::size_t samples = 0;
+};
+
+// 최근 windowSize개 샘플(ms)에 대한 고정 폭 버킷 히스토그램.
+// 추가/만료는 O(1), 백분위 조회는 버킷 수에 비례한다. 백분위는 버킷 상한으로 보고한다.
+class FrameTimeHistogram {
+public:
+    explicit FrameTimeHistogram(std::size_t windowSize = 1024,
+                                double bucketWidthMs = 0.05,
+                                double maxTrackedMs = 100.0)
+        : bucketWidthMs_(bucketWidthMs > 0.0 ? bucketWidthMs : 0.05)
+        , samples_(std::max<std::size_t>(windowSize, 1), 0.0f) {
+        const auto bucketCount = static_cast<std::size_t>(std::ceil(std::max(maxTrackedMs, bucketWidthMs_) / bucketWidthMs_));
+        // 마지막 버킷은 maxTrackedMs 이상을 모두 담는 overflow 버킷이다.
+        buckets_.assign(bucketCount + 1, 0);
+    }
+
+    void add(double milliseconds) {
+        const float sample = static_cast<float>(std::max(0.0, milliseconds));
+        if (count_ == samples_.size()) {
+            const float evicted = samples_[head_];
+            --buckets_[bucketIndex(evicted)];
+            sum_ -= evicted;
+        } else {
+            ++count_;
+        }
+
+        samples_[head_] = sample;
+        ++buckets_[bucketIndex(sample)];
+        sum_ += sample;
+        head_ = (head_ + 1) % samples_.size();
+    }
+
+    void clear() {
+        std::fill(buckets_.begin(), buckets_.end(), 0);
+        head_ = 0;
+        count_ = 0;
+        sum_ = 0.0;
+    }
+
+    // p는 [0, 1].
+    double percentile(double p) const {
+        if (count_ == 0) return 0.0;
+        const auto rank = rankFor(p);
+        std::size_t cumulative = 0;
+        for (std::size_t i = 0; i < buckets_.size(); ++i) {
+            cumulative += buckets_[i];
+            if (cumulative >= rank) return bucketUpperMs(i);
+        }
+        return maxSample();
+    }
+
+    FrameTimePercentiles summary() const {
+        FrameTimePercentiles out{};
+        out.samples = count_;
+        if (count_ == 0) return out;
+
+        const std::size_t r50 = rankFor(0.50);
+        const std::size_t r95 = rankFor(0.95);
+        const std::size_t r99 = rankFor(0.99);
+        std::size_t cumulative = 0;
+        bool has50 = false;
+        bool has95 = false;
+        for (std::size_t i = 0; i < buckets_.size(); ++i) {
+            cumulative += buckets_[i];
+            if (!has50 && cumulative >= r50) { out.p50 = bucketUpperMs(i); has50 = true; }
+            if (!has95 && cumulative >= r95) { out.p95 = bucketUpperMs(i); has95 = true; }
+            if (cumulative >= r99) { out.p99 = bucketUpperMs(i); break; }
+        }
+
+        out.max = maxSample();
+        out.mean = sum_ / static_cast<double>(count_);
+        // overflow 버킷의 상한은 의미가 없으므로 실제 최대값으로 자른다.
+        out.p50 = std::min(out.p50, out.max);
+        out.p95 = std::min(out.p95, out.max);
+        out.p99 = std::min(out.p99, out.max);
+        return out;
+    }
+
+    // 오래된 샘플부터 순서대로 방문한다(그래프 표시용).
+    template <typename Fn>
+    void forEachSample(Fn&& fn) const {
+        const std::size_t capacity = samples_.size();
+        const std::size_t start = (head_ + capacity - count_) % capacity;
+        for (std::size_t i = 0; i < count_; ++i) {
+            fn(static_cast<double>(samples_[(start + i) % capacity]));
+        }
+    }
+
+    const std::vector<std::uint32_t>& buckets() const {
+        return buckets_;
+    }
+
+    double bucketWidthMs() const {
+        return bucketWidthMs_;
+    }
+
+    std::size_t count() const {
+        return count_;
+    }
+
+    std::size_t windowSize() const {
+        return samples_.size();
+    }
+
+private:
+    std::size_t bucketIndex(float sample) const {
+        const auto index = static_cast<std::size_t>(static_cast<double>(sample) / bucketWidthMs_);
+        return std::min(index, buckets_.size() - 1);
+    }
+
+    double bucketUpperMs(std::size_t index) const {
+        if (index + 1 == buckets_.size()) return maxSample();
+        return static_cast<double>(index + 1) * bucketWidthMs_;
+    }
+
+    std::size_t rankFor(double p) const {
+        const double clamped = std::clamp(p, 0.0, 1.0);
+        const auto rank = static_cast<std::size_t>(std::ceil(clamped * static_cast<double>(count_)));
+        return std::max<std::size_t>(rank, 1);
+    }
+
+    double maxSample() const {
+        float out = 0.0f;
+        forEachSample([&](double sample) { out = std::max(out, static_cast<float>(sample)); });
+        return static_cast<double>(out);
+    }
+
+    double bucketWidthMs_ = 0.05;
+    std::vector<float> samples_;
+    std::vector<std::uint32_t> buckets_;
+    std::size_t head_ = 0;
+    std::size_t count_ = 0;
+    double sum_ = 0.0;
+};
+
+// 렌더 패스 하나의 CPU 기록 시간과 GPU 실행 시간. name은 정적 문자열이어야 한다.
+struct PassTiming {
+    const char* name = "";
+    double cpuMs = 0.0;
+    double gpuMs = 0.0;
+};
+
+// 패스별 CPU/GPU 롤링 히스토그램.
+struct PassTimingHistogram {
+    explicit PassTimingHistogram(const char* passName, std::size_t windowSize)
+        : name(passName)
+        , cpu(windowSize)
+        , gpu(windowSize) {}
+
+    const char* name = "";
+    FrameTimeHistogram cpu;
+    FrameTimeHistogram gpu;
+};
+
+// 프레임 간격, CPU 작업 시간, GPU 시간을 같은 창 크기로 추적한다.
+// GPU 시간은 타이머 쿼리 지연 때문에 프레임보다 늦게 들어올 수 있다.
+class FrameTimingStats {
+public:
+    explicit FrameTimingStats(std::size_t windowSize = 1024)
+        : windowSize_(windowSize)
+        , frame_(windowSize)
+        , cpu_(windowSize)
+        , gpu_(windowSize) {}
+
+    void recordFrame(double frameMs, double cpuMs) {
+        frame_.add(frameMs);
+        cpu_.add(cpuMs);
+    }
+
+    void recordGpu(double gpuMs) {
+        gpu_.add(gpuMs);
+    }
+
+    // 한 프레임의 패스 타이밍을 기록하고 GPU 합계를 recordGpu로 넘긴다.
+    void recordPasses(std::span<const PassTiming> passes) {
+        if (passes.empty()) return;
+        double gpuTotal = 0.0;
+        for (const PassTiming& pass : passes) {
+            PassTimingHistogram& histogram = passHistogram(pass.name);
+            histogram.cpu.add(pass.cpuMs);
+            histogram.gpu.add(pass.gpuMs);
+            gpuTotal += pass.gpuMs;
+        }
+        recordGpu(gpuTotal);
+    }
+
+    void clear() {
+        frame_.clear();
+        cpu_.clear();
+        gpu_.clear();
+        passes_.clear();
+    }
+
+    const FrameTimeHistogram& frame() const { return frame_; }
+    const FrameTimeHistogram& cpu() const { return cpu_; }
+    const FrameTimeHistogram& gpu() const { return gpu_; }
+    // 처음 기록된 순서(보통 렌더 그래프 실행 순서)를 유지한다.
+    const std::vector<PassTimingHistogram>& passes() const { return passes_; }
+
+private:
+    PassTimingHistogram& passHistogram(const char* name) {
+        for (auto& pass : passes_) {
+            if (pass.name == name || std::strcmp(pass.name, name) == 0) return pass;
+        }
+        return passes_.emplace_back(name, windowSize_);
+    }
+
+    std::size_t windowSize_ = 1024;
+    std::vector<PassTimingHistogram> passes_;
+    FrameTimeHistogram frame_;
+    FrameTimeHistogram cpu_;
+    FrameTimeHistogram gpu_;
+};
+
+// TODO [Core-Time-004]:
+// 책임: 프레임/CPU/GPU 시간 롤링 히스토그램 제공
+// 요구사항:
+//  - 고정 창 크기 롤링 샘플
+//  - p50/p95/p99/max/mean 조회
+//  - 에디터 그래프용 샘플 순회
+//  - 렌더 패스별 CPU/GPU 히스토그램
+// 의존성:
+//  - 없음
+// 구현 단계: Phase D
+// 성능 고려사항:
+//  - 샘플 추가/만료 O(1), 할당 0
+//  - 백분위 조회는 버킷 수 선형
+// 테스트 전략:
+//  - 알려진 분포 백분위 테스트
+//  - 창 만료 후 카운트 일관성 테스트
+
+} // namespace rex::core::time
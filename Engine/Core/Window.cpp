@@ -57,6 +57,18 @@ void Window::swapBuffers() {
     SDL_GL_SwapWindow(m_window);
 }
 
+bool Window::makeContextCurrent() {
+    if (SDL_GL_MakeCurrent(m_window, m_glContext) != 0) {
+        Logger::error("GL MakeCurrent Error: {}", SDL_GetError());
+        return false;
+    }
+    return true;
+}
+
+void Window::releaseContext() {
+    SDL_GL_MakeCurrent(m_window, nullptr);
+}
+
 void Window::setVSync(bool enabled) {
     SDL_GL_SetSwapInterval(enabled ? 1 : 0);
 }
@@ -21,6 +21,11 @@ public:
     void swapBuffers();
     
     void setVSync(bool enabled);
+
+    // The GL context is current on one thread at a time: release it here
+    // before making it current on a render thread.
+    bool makeContextCurrent();
+    void releaseContext();
     
     SDL_Window* getNativeWindow() const { return m_window; }
     int getWidth() const { return m_width; }
@@ -0,0 +1,228 @@
+#include "DerivedDataCache.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <system_error>
+#include <thread>
+
+#include "../../Core/Logger.h"
+#include "../../Core/Platform/FileSystem.h"
+#include "../../Core/Serialization/BinaryStream.h"
+
+namespace rex::editor::asset {
+
+namespace {
+
+constexpr std::array<char, 8> kEntryMagic{'R', 'E', 'X', 'D', 'D', 'C', '0', '1'};
+constexpr std::string_view kEntryExtension = ".ddc";
+
+// 항목 파일 헤더. 뒤에 payloadBytes 바이트가 이어진다.
+struct EntryHeader {
+    std::array<char, 8> magic = kEntryMagic;
+    std::uint64_t payloadBytes = 0;
+    std::uint64_t payloadHash = 0;
+};
+
+} // namespace
+
+DerivedDataCache::DerivedDataCache(std::filesystem::path root, std::uint64_t maxBytes)
+    : root_(std::move(root)), maxBytes_(maxBytes) {
+    std::error_code ec;
+    std::filesystem::create_directories(root_, ec);
+    if (ec) Logger::warn("DerivedDataCache: cannot create {} ({})", root_.string(), ec.message());
+    scanExisting();
+}
+
+DerivedDataCache::Key DerivedDataCache::makeKey(std::span<const std::byte> sourceBytes,
+                                                std::string_view importerId,
+                                                std::uint32_t importerVersion,
+                                                const Settings& settings) {
+    ::rex::core::serialization::BinaryWriter key;
+    const Key source = ::rex::core::serialization::hash128(sourceBytes);
+    key.write(source.high);
+    key.write(source.low);
+    key.writeString(importerId);
+    key.write(importerVersion);
+    key.write(static_cast<std::uint32_t>(settings.size()));
+    for (const auto& [name, value] : settings) {
+        key.writeString(name);
+        key.writeString(value);
+    }
+    return ::rex::core::serialization::hash128(key.bytes());
+}
+
+std::filesystem::path DerivedDataCache::pathFor(const Key& key) const {
+    const std::string name = key.toHex();
+    return root_ / name.substr(0, 2) / name.substr(2, 2) / (name + std::string(kEntryExtension));
+}
+
+std::optional<std::vector<std::byte>> DerivedDataCache::load(const Key& key) {
+    const std::filesystem::path path = pathFor(key);
+    const std::string name = key.toHex();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (entries_.find(name) == entries_.end()) {
+            ++stats_.misses;
+            return std::nullopt;
+        }
+    }
+
+    std::optional<std::vector<std::byte>> file = ::rex::core::platform::FileSystem::readBinary(path);
+    EntryHeader header{};
+    bool valid = file && file->size() >= sizeof(EntryHeader);
+    if (valid) {
+        std::memcpy(&header, file->data(), sizeof(header));
+        const std::span<const std::byte> payload(file->data() + sizeof(EntryHeader), file->size() - sizeof(EntryHeader));
+        valid = header.magic == kEntryMagic && header.payloadBytes == payload.size() &&
+                ::rex::core::serialization::hash64(payload) == header.payloadHash;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!valid) {
+        ++stats_.corrupt;
+        ++stats_.misses;
+        forgetLocked(name);
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+        Logger::warn("DerivedDataCache: dropped corrupt entry {}", name);
+        return std::nullopt;
+    }
+
+    ++stats_.hits;
+    touchLocked(name, file->size());
+    // 세션 간 LRU 순서를 위해 mtime을 갱신한다.
+    std::error_code ec;
+    std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+
+    file->erase(file->begin(), file->begin() + sizeof(EntryHeader));
+    return file;
+}
+
+bool DerivedDataCache::store(const Key& key, std::span<const std::byte> cooked) {
+    const std::filesystem::path path = pathFor(key);
+    const std::string name = key.toHex();
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+
+    EntryHeader header{};
+    header.payloadBytes = cooked.size();
+    header.payloadHash = ::rex::core::serialization::hash64(cooked);
+
+    std::uint64_t tempId = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tempId = ++tempCounter_;
+    }
+    // 같은 디렉터리의 임시 파일에 쓰고 rename: 읽는 쪽은 완성된 파일만 보게 된다.
+    std::filesystem::path temp = path;
+    temp += ".tmp" + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + "_" +
+            std::to_string(tempId);
+    {
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(cooked.data()), static_cast<std::streamsize>(cooked.size()));
+        if (!out) {
+            out.close();
+            std::filesystem::remove(temp, ec);
+            Logger::warn("DerivedDataCache: failed to write {}", temp.string());
+            return false;
+        }
+    }
+    std::filesystem::rename(temp, path, ec);
+    if (ec) {
+        std::filesystem::remove(temp, ec);
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++stats_.stores;
+    touchLocked(name, sizeof(EntryHeader) + cooked.size());
+    evictLocked();
+    return true;
+}
+
+bool DerivedDataCache::contains(const Key& key) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.find(key.toHex()) != entries_.end();
+}
+
+DerivedDataCacheStats DerivedDataCache::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    DerivedDataCacheStats out = stats_;
+    out.entries = entries_.size();
+    out.bytes = totalBytes_;
+    return out;
+}
+
+const std::filesystem::path& DerivedDataCache::root() const {
+    return root_;
+}
+
+void DerivedDataCache::scanExisting() {
+    struct Found {
+        std::string name;
+        std::uint64_t bytes = 0;
+        std::filesystem::file_time_type time{};
+    };
+    std::vector<Found> found;
+    std::error_code ec;
+    for (std::filesystem::recursive_directory_iterator it(root_, ec), end; !ec && it != end; it.increment(ec)) {
+        if (!it->is_regular_file(ec)) continue;
+        const std::filesystem::path& path = it->path();
+        if (path.extension() != kEntryExtension) {
+            // 중단된 쓰기의 임시 파일.
+            if (path.filename().string().find(".tmp") != std::string::npos) std::filesystem::remove(path, ec);
+            continue;
+        }
+        found.push_back({path.stem().string(), it->file_size(ec), it->last_write_time(ec)});
+    }
+    // mtime 오름차순으로 사용 순번을 매겨 이전 세션의 LRU 순서를 복원한다.
+    std::sort(found.begin(), found.end(), [](const Found& a, const Found& b) { return a.time < b.time; });
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const Found& entry : found) touchLocked(entry.name, entry.bytes);
+    evictLocked();
+    if (!found.empty()) {
+        Logger::info("DerivedDataCache: {} entries, {:.1f} MB in {}", entries_.size(),
+                     static_cast<double>(totalBytes_) / (1024.0 * 1024.0), root_.string());
+    }
+}
+
+void DerivedDataCache::touchLocked(const std::string& name, std::uint64_t bytes) {
+    Entry& entry = entries_[name];
+    totalBytes_ -= entry.bytes;
+    entry.bytes = bytes;
+    totalBytes_ += bytes;
+    entry.lastUse = ++useCounter_;
+}
+
+void DerivedDataCache::evictLocked() {
+    if (totalBytes_ <= maxBytes_) return;
+    std::vector<std::pair<std::uint64_t, std::string>> byAge;
+    byAge.reserve(entries_.size());
+    for (const auto& [name, entry] : entries_) byAge.emplace_back(entry.lastUse, name);
+    std::sort(byAge.begin(), byAge.end());
+
+    // 상한의 90%까지 줄여 저장마다 제거가 반복되지 않게 한다.
+    const std::uint64_t target = maxBytes_ - maxBytes_ / 10;
+    std::error_code ec;
+    for (const auto& [lastUse, name] : byAge) {
+        if (totalBytes_ <= target) break;
+        (void)lastUse;
+        std::filesystem::remove(root_ / name.substr(0, 2) / name.substr(2, 2) / (name + std::string(kEntryExtension)), ec);
+        forgetLocked(name);
+        ++stats_.evictions;
+    }
+}
+
+void DerivedDataCache::forgetLocked(const std::string& name) {
+    const auto it = entries_.find(name);
+    if (it == entries_.end()) return;
+    totalBytes_ -= it->second.bytes;
+    entries_.erase(it);
+}
+
+} // namespace rex::editor::asset
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "../../Core/Serialization/ContentHash.h"
+
+namespace rex::editor::asset {
+
+struct DerivedDataCacheStats {
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t stores = 0;
+    std::uint64_t evictions = 0;
+    // 손상(크기/체크섬 불일치)으로 버린 항목 수.
+    std::uint64_t corrupt = 0;
+    std::uint64_t entries = 0;
+    std::uint64_t bytes = 0;
+};
+
+// 원본 바이트 + importer ID/버전 + import 설정의 해시를 키로 하는 로컬 파생 데이터 캐시.
+// 항목은 root/ab/cd/<key>.ddc 로 샤딩되어 저장되고, 임시 파일에 쓴 뒤 rename해 원자적으로 게시된다.
+// 전체 크기가 maxBytes를 넘으면 가장 오래 쓰지 않은 항목부터 지운다(사용 시각은 파일 mtime으로 세션 간 유지).
+// 모든 API는 스레드 안전하다(백그라운드 reimport에서 호출됨).
+class DerivedDataCache {
+public:
+    using Key = ::rex::core::serialization::ContentHash;
+    using Settings = std::map<std::string, std::string>;
+
+    DerivedDataCache(std::filesystem::path root, std::uint64_t maxBytes);
+
+    static Key makeKey(std::span<const std::byte> sourceBytes,
+                       std::string_view importerId,
+                       std::uint32_t importerVersion,
+                       const Settings& settings);
+
+    std::optional<std::vector<std::byte>> load(const Key& key);
+    bool store(const Key& key, std::span<const std::byte> cooked);
+    bool contains(const Key& key) const;
+
+    DerivedDataCacheStats stats() const;
+    const std::filesystem::path& root() const;
+    std::filesystem::path pathFor(const Key& key) const;
+
+private:
+    struct Entry {
+        std::uint64_t bytes = 0;
+        std::uint64_t lastUse = 0;
+    };
+
+    void scanExisting();
+    void touchLocked(const std::string& name, std::uint64_t bytes);
+    void evictLocked();
+    void forgetLocked(const std::string& name);
+
+    std::filesystem::path root_;
+    std::uint64_t maxBytes_ = 0;
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+    std::uint64_t totalBytes_ = 0;
+    std::uint64_t useCounter_ = 0;
+    std::uint64_t tempCounter_ = 0;
+    DerivedDataCacheStats stats_{};
+};
+
+// TODO [Editor-Asset-006]:
+// 책임: import 결과(파생 데이터) 로컬 캐시
+// 요구사항:
+//  - 내용 주소 키(원본 해시 + importer ID/버전 + 설정)
+//  - 2단계 샤딩 디렉터리, 임시 파일 + rename 원자적 쓰기
+//  - 크기 상한 LRU 제거, 손상 항목 검출/삭제
+// 의존성:
+//  - Core/Serialization/ContentHash
+// 구현 단계: Phase B
+// 성능 고려사항:
+//  - 히트 비용 = 원본 해시 + 파일 1회 읽기
+//  - 시작 시 디렉터리 1회 스캔으로 인덱스 구성
+//  - 공유(네트워크) 캐시 계층 확장 포인트
+// 테스트 전략:
+//  - 저장/조회 라운드트립 테스트
+//  - 설정/버전 변경 시 미스 테스트
+//  - 상한 초과 LRU 제거 테스트
+//  - 잘린 파일 거부 테스트
+
+} // namespace rex::editor::asset
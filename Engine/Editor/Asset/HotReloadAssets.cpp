@@ -0,0 +1,88 @@
+#include "HotReloadAssets.h"
+
+#include <memory>
+#include <span>
+#include <system_error>
+#include <utility>
+
+#include "../../Core/Platform/FileSystem.h"
+#include "../../Graphics/MeshLibrary.h"
+#include "../../Graphics/MeshLod.h"
+#include "../../Graphics/MeshOptimizer.h"
+
+namespace rex::editor::asset {
+
+void registerHotReloadImporters(ImportPipeline& pipeline) {
+    pipeline.registerImporter(
+        "obj",
+        [](const ImportRequest& request) {
+            ImportResult result{};
+            if (auto mesh = ::rex::gfx::MeshLibrary::loadObj(request.sourcePath)) {
+                ::rex::gfx::buildLodChain(mesh->vertices, mesh->indices, mesh->submeshes, mesh->lods);
+                ::rex::gfx::optimizeMesh(mesh->vertices, mesh->indices, mesh->submeshes);
+                result.success = true;
+                result.cooked = ::rex::gfx::MeshLibrary::encode(*mesh);
+                result.artifact = std::make_shared<::rex::gfx::MeshData>(std::move(*mesh));
+            } else {
+                result.message = "OBJ parse failed";
+            }
+            return result;
+        },
+        4,
+        [](std::span<const std::byte> cooked) -> std::shared_ptr<void> {
+            auto mesh = ::rex::gfx::MeshLibrary::decode(cooked);
+            return mesh ? std::make_shared<::rex::gfx::MeshData>(std::move(*mesh)) : nullptr;
+        });
+    // 프로그램 노드의 sourcePath는 확장자 없는 경로다. 어느 스테이지가 바뀌어도 둘 다 다시 읽는다.
+    pipeline.registerImporter("shader", [](const ImportRequest& request) {
+        ImportResult result{};
+        auto vertex = ::rex::core::platform::FileSystem::readText(request.sourcePath + ".vert");
+        auto fragment = ::rex::core::platform::FileSystem::readText(request.sourcePath + ".frag");
+        if (vertex && fragment) {
+            result.success = true;
+            result.artifact = std::make_shared<ShaderSources>(ShaderSources{std::move(*vertex), std::move(*fragment)});
+        } else {
+            result.message = "missing .vert or .frag stage";
+        }
+        return result;
+    });
+}
+
+std::size_t trackWatchedAssets(const std::filesystem::path& root, ImportPipeline& pipeline, DependencyGraph& dependencies) {
+    std::size_t tracked = 0;
+    std::error_code ec;
+    for (std::filesystem::recursive_directory_iterator it(root, ec), end; !ec && it != end; it.increment(ec)) {
+        if (!it->is_regular_file(ec)) continue;
+        const std::filesystem::path& path = it->path();
+        const std::string ext = path.extension().string();
+        const std::string assetId = path.lexically_relative(root).generic_string();
+        const std::string sourcePath = ImportPipeline::normalizeSourcePath(path.string());
+
+        if (ext == ".obj") {
+            if (pipeline.track({sourcePath, assetId, "obj", {}})) ++tracked;
+            continue;
+        }
+        // 프로그램 하나를 .vert 쪽에서 한 번만 등록한다. .frag가 없으면 링크할 수 없으므로 건너뛴다.
+        if (ext != ".vert") continue;
+        std::filesystem::path fragment = path;
+        fragment.replace_extension(".frag");
+        if (!std::filesystem::is_regular_file(fragment, ec)) continue;
+
+        std::filesystem::path program = path;
+        program.replace_extension();
+        const std::string programId = std::filesystem::path(assetId).replace_extension().generic_string();
+        const std::string fragmentId = fragment.lexically_relative(root).generic_string();
+        // 스테이지는 importer 없이 통과시키고(결과 artifact 없음), 실제 읽기는 프로그램 노드가 한다.
+        if (!pipeline.track({sourcePath, assetId, {}, {}}) ||
+            !pipeline.track({ImportPipeline::normalizeSourcePath(fragment.string()), fragmentId, {}, {}}) ||
+            !pipeline.track({ImportPipeline::normalizeSourcePath(program.string()), programId, "shader", {}})) {
+            continue;
+        }
+        dependencies.addDependency(programId, assetId);
+        dependencies.addDependency(programId, fragmentId);
+        tracked += 3;
+    }
+    return tracked;
+}
+
+} // namespace rex::editor::asset
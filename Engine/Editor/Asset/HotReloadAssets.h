@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+
+#include "DependencyGraph.h"
+#include "ImportPipeline.h"
+
+namespace rex::editor::asset {
+
+// 셰이더 프로그램의 두 스테이지. 프로그램은 확장자를 뺀 경로로 부른다(lit.vert + lit.frag -> lit).
+struct ShaderSources {
+    std::string vertex;
+    std::string fragment;
+};
+
+// 핫 리로드용 importer를 등록한다.
+//  - "obj": gfx::MeshData artifact(LOD + 최적화 포함), cooked 결과는 파생 데이터 캐시에 남는다.
+//  - "shader": 프로그램 노드. 두 스테이지를 모두 읽어 ShaderSources artifact를 만든다.
+// 파일 읽기와 파싱은 import 작업에서 돌고, GPU 리소스 교체는 적용 핸들러가 맡는다.
+void registerHotReloadImporters(ImportPipeline& pipeline);
+
+// root 아래 OBJ와 셰이더 스테이지를 이미 import된 애셋으로 track한다(ID = root 기준 상대 경로).
+// sourcePath는 ImportPipeline::normalizeSourcePath로 정규화해 저장하므로, 교체 대상을 찾는 쪽도
+// 같은 정규화 경로를 키로 써야 한다.
+// .vert/.frag가 모두 있는 셰이더마다 프로그램 노드("lit")를 두고 두 스테이지("lit.vert", "lit.frag")에
+// 의존시킨다. 스테이지 하나가 바뀌면 dependentsOf로 프로그램까지 reimport되어 한 번만 다시 링크된다.
+// MTL은 track하지 않는다: OBJ importer가 재질을 읽지 않는다.
+std::size_t trackWatchedAssets(const std::filesystem::path& root, ImportPipeline& pipeline, DependencyGraph& dependencies);
+
+// TODO [Editor-Asset-007]:
+// 책임: 핫 리로드 대상 애셋 종류(메시, 셰이더 프로그램)와 의존 엣지 등록
+// 요구사항:
+//  - 감시 디렉터리의 OBJ/셰이더 스테이지 track
+//  - 프로그램 -> 스테이지 의존 엣지
+//  - 정규화된 원본 경로를 교체 키로 사용
+// 의존성:
+//  - Editor/Asset/ImportPipeline
+//  - Editor/Asset/DependencyGraph
+//  - Graphics/MeshLibrary
+// 구현 단계: Phase B
+// 성능 고려사항:
+//  - 스테이지 노드는 importer 없이 통과(파일 읽기는 프로그램 노드에서 한 번)
+//  - OBJ cooked 결과는 파생 데이터 캐시 재사용
+// 테스트 전략:
+//  - 스테이지 변경 시 프로그램 reimport 테스트
+//  - 한쪽 스테이지만 있는 셰이더 무시 테스트
+
+} // namespace rex::editor::asset
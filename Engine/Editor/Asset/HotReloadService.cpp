@@ -0,0 +1,148 @@
+#include "HotReloadService.h"
+
+#include <algorithm>
+#include <deque>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "../../Core/Logger.h"
+
+namespace rex::editor::asset {
+
+HotReloadService::HotReloadService(ImportPipeline& pipeline,
+                                   const DependencyGraph& dependencies,
+                                   ::rex::core::job::ThreadPool& jobs,
+                                   HotReloadConfig config)
+    : pipeline_(pipeline),
+      dependencies_(dependencies),
+      jobs_(jobs),
+      watcher_({config.debounce, true}) {}
+
+HotReloadService::~HotReloadService() {
+    // 작업이 pipeline_을 참조하므로 끝날 때까지 기다린다.
+    if (inFlight_.valid()) inFlight_.wait();
+}
+
+bool HotReloadService::watch(const std::filesystem::path& directory) {
+    return watcher_.watch(directory);
+}
+
+void HotReloadService::setApplyHandler(ApplyHandler handler) {
+    applyHandler_ = std::move(handler);
+}
+
+std::size_t HotReloadService::update() {
+    std::size_t applied = 0;
+    if (inFlight_.valid() && inFlight_.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+        Batch batch = inFlight_.get();
+        ++stats_.batches;
+        stats_.lastBatchMs = batch.milliseconds;
+        for (const ImportResult& result : batch.results) {
+            if (result.success) {
+                ++stats_.reimported;
+            } else {
+                ++stats_.failed;
+                Logger::error("Hot reload failed: {} ({})", result.assetId, result.message);
+            }
+        }
+        if (applyHandler_) applyHandler_(batch.results);
+        applied = batch.results.size();
+        Logger::info("Hot reload: {} asset(s) in {:.1f} ms", applied, batch.milliseconds);
+    }
+
+    queueChanges();
+    if (!inFlight_.valid() && !queued_.empty()) startBatch();
+    return applied;
+}
+
+bool HotReloadService::busy() const {
+    return inFlight_.valid();
+}
+
+const HotReloadStats& HotReloadService::stats() const {
+    return stats_;
+}
+
+std::vector<std::string> HotReloadService::collectReimportSet(const std::vector<std::string>& changed) const {
+    // 1) changed에서 dependentsOf를 따라 영향 범위를 모은다.
+    std::vector<std::string> affected;
+    std::unordered_set<std::string> seen;
+    std::deque<std::string> frontier;
+    for (const std::string& id : changed) {
+        if (seen.insert(id).second) frontier.push_back(id);
+    }
+    while (!frontier.empty()) {
+        std::string id = std::move(frontier.front());
+        frontier.pop_front();
+        for (std::string& dependent : dependencies_.dependentsOf(id)) {
+            if (seen.insert(dependent).second) frontier.push_back(std::move(dependent));
+        }
+        affected.push_back(std::move(id));
+    }
+
+    // 2) 영향 범위 안에서 의존 대상이 먼저 오도록 위상 정렬한다. 순환이 남으면 BFS 순서로 붙인다.
+    std::unordered_map<std::string, std::size_t> pendingDependencies;
+    for (const std::string& id : affected) {
+        std::size_t count = 0;
+        for (const std::string& dependency : dependencies_.dependenciesOf(id)) {
+            if (seen.count(dependency) != 0) ++count;
+        }
+        pendingDependencies[id] = count;
+    }
+
+    std::vector<std::string> ordered;
+    ordered.reserve(affected.size());
+    std::unordered_set<std::string> emitted;
+    bool progressed = true;
+    while (ordered.size() < affected.size() && progressed) {
+        progressed = false;
+        for (const std::string& id : affected) {
+            if (emitted.count(id) != 0 || pendingDependencies[id] != 0) continue;
+            emitted.insert(id);
+            ordered.push_back(id);
+            progressed = true;
+            for (const std::string& dependent : dependencies_.dependentsOf(id)) {
+                auto it = pendingDependencies.find(dependent);
+                if (it != pendingDependencies.end() && it->second > 0) --it->second;
+            }
+        }
+    }
+    for (const std::string& id : affected) {
+        if (emitted.insert(id).second) ordered.push_back(id);
+    }
+    return ordered;
+}
+
+void HotReloadService::queueChanges() {
+    for (const ::rex::core::platform::FileChange& change : watcher_.poll()) {
+        if (change.kind == ::rex::core::platform::FileChangeKind::Removed) continue;
+        const std::optional<std::string> assetId = pipeline_.assetIdForSource(change.path.string());
+        if (!assetId) continue;
+        if (std::find(queued_.begin(), queued_.end(), *assetId) == queued_.end()) {
+            queued_.push_back(*assetId);
+        }
+    }
+}
+
+void HotReloadService::startBatch() {
+    std::vector<std::string> ids = collectReimportSet(queued_);
+    queued_.clear();
+    Logger::info("Hot reload: reimporting {} asset(s)", ids.size());
+
+    ImportPipeline* pipeline = &pipeline_;
+    inFlight_ = jobs_.submit([pipeline, ids = std::move(ids)]() {
+        REX_TRACE_SCOPE("HotReloadBatch");
+        const auto begin = std::chrono::steady_clock::now();
+        Batch batch{};
+        batch.results.reserve(ids.size());
+        for (const std::string& id : ids) {
+            batch.results.push_back(pipeline->reimportAsset(id));
+        }
+        batch.milliseconds =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+        return batch;
+    });
+}
+
+} // namespace rex::editor::asset
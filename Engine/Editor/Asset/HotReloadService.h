@@ -0,0 +1,101 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "../../Core/Job/ThreadPool.h"
+#include "../../Core/Platform/FileWatcher.h"
+#include "DependencyGraph.h"
+#include "ImportPipeline.h"
+
+namespace rex::editor::asset {
+
+struct HotReloadConfig {
+    std::chrono::milliseconds debounce{150};
+};
+
+struct HotReloadStats {
+    std::uint64_t batches = 0;
+    std::uint64_t reimported = 0;
+    std::uint64_t failed = 0;
+    // 마지막 배치의 백그라운드 reimport 소요 시간.
+    double lastBatchMs = 0.0;
+};
+
+// 감시 디렉터리의 변경을 받아 바뀐 애셋과 그 dependent만 백그라운드에서 reimport하고,
+// 결과는 update()에서 배치 단위로 한 번에 적용 핸들러에 넘긴다(프레임 경계 교체).
+// update/watch/setApplyHandler는 메인 스레드 전용이다. DependencyGraph는 메인 스레드에서만 읽는다.
+class HotReloadService {
+public:
+    // 배치의 모든 결과를 받는다. 메인(GL) 스레드에서 호출되므로 GPU 리소스 교체를 여기서 한다.
+    using ApplyHandler = std::function<void(std::span<const ImportResult>)>;
+
+    HotReloadService(ImportPipeline& pipeline,
+                     const DependencyGraph& dependencies,
+                     ::rex::core::job::ThreadPool& jobs,
+                     HotReloadConfig config = {});
+    ~HotReloadService();
+
+    HotReloadService(const HotReloadService&) = delete;
+    HotReloadService& operator=(const HotReloadService&) = delete;
+
+    bool watch(const std::filesystem::path& directory);
+    void setApplyHandler(ApplyHandler handler);
+
+    // 프레임 경계에서 호출: 끝난 배치를 적용하고, debounce된 변경으로 새 배치를 시작한다.
+    // 적용한 결과 수를 돌려준다. 진행 중인 배치를 기다리지 않는다.
+    std::size_t update();
+
+    bool busy() const;
+    const HotReloadStats& stats() const;
+
+    // changed와 그 dependent(전이)를 한 번씩, 의존 대상이 먼저 오도록 정렬해 돌려준다.
+    std::vector<std::string> collectReimportSet(const std::vector<std::string>& changed) const;
+
+private:
+    struct Batch {
+        std::vector<ImportResult> results;
+        double milliseconds = 0.0;
+    };
+
+    void queueChanges();
+    void startBatch();
+
+    ImportPipeline& pipeline_;
+    const DependencyGraph& dependencies_;
+    ::rex::core::job::ThreadPool& jobs_;
+    ::rex::core::platform::FileWatcher watcher_;
+    ApplyHandler applyHandler_{};
+    std::vector<std::string> queued_{};
+    std::future<Batch> inFlight_{};
+    HotReloadStats stats_{};
+};
+
+// TODO [Editor-Asset-005]:
+// 책임: 파일 변경 기반 증분 reimport와 프레임 경계 적용
+// 요구사항:
+//  - FileWatcher debounce 변경 수신
+//  - DependencyGraph::dependentsOf 기반 영향 범위 계산
+//  - 백그라운드 reimport, 배치 결과 일괄 적용
+//  - 배치 진행 중 들어온 변경은 다음 배치로 병합
+// 의존성:
+//  - Editor/Asset/ImportPipeline
+//  - Editor/Asset/DependencyGraph
+//  - Core/Platform/FileWatcher
+//  - Core/Job/ThreadPool
+// 구현 단계: Phase B
+// 성능 고려사항:
+//  - 메인 스레드는 poll + 결과 적용만 수행(파일 읽기/파싱 없음)
+//  - 배치는 한 번에 하나: 연속 저장이 작업을 쌓지 않음
+// 테스트 전략:
+//  - 의존 체인 reimport 순서 테스트
+//  - 배치 중 변경 병합 테스트
+//  - 삭제 파일 무시 테스트
+
+} // namespace rex::editor::asset
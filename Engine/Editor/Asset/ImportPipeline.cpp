@@ -1,7 +1,29 @@
 #include "ImportPipeline.h"
 
+#include <filesystem>
+#include <system_error>
+
+#include "../../Core/Platform/FileSystem.h"
+#include "DerivedDataCache.h"
+
 namespace rex::editor::asset {
 
+void ImportPipeline::registerImporter(const std::string& name, Importer importer, std::uint32_t version, Loader loader) {
+    if (name.empty() || !importer) return;
+    std::lock_guard<std::mutex> lock(mutex_);
+    importers_[name] = {std::move(importer), std::move(loader), version};
+}
+
+void ImportPipeline::setDerivedDataCache(DerivedDataCache* cache) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cache_ = cache;
+}
+
+bool ImportPipeline::hasImporter(const std::string& name) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return importers_.find(name) != importers_.end();
+}
+
 ImportResult ImportPipeline::importAsset(const ImportRequest& request) {
     ImportResult result{};
     if (request.sourcePath.empty() || request.destinationPath.empty()) {
@@ -10,9 +32,8 @@ ImportResult ImportPipeline::importAsset(const ImportRequest& request) {
         return result;
     }
 
-    result.success = true;
-    result.assetId = request.destinationPath;
-    result.message = "imported";
+    result = runImporter(request);
+    if (result.success) track(request);
     return result;
 }
 
@@ -23,11 +44,102 @@ ImportResult ImportPipeline::reimportAsset(const std::string& assetId) {
         result.message = "invalid asset id";
         return result;
     }
-    result.success = true;
-    result.assetId = assetId;
-    result.message = "reimported";
+
+    const std::optional<ImportRequest> request = findRequest(assetId);
+    if (!request) {
+        result.success = false;
+        result.assetId = assetId;
+        result.message = "asset was never imported";
+        return result;
+    }
+
+    result = runImporter(*request);
+    if (result.success) result.message = "reimported";
     return result;
 }
 
-} // namespace rex::editor::asset
+bool ImportPipeline::track(const ImportRequest& request) {
+    if (request.sourcePath.empty() || request.destinationPath.empty()) return false;
+    std::lock_guard<std::mutex> lock(mutex_);
+    requests_[request.destinationPath] = request;
+    assetBySource_[normalizeSourcePath(request.sourcePath)] = request.destinationPath;
+    return true;
+}
+
+std::optional<ImportRequest> ImportPipeline::findRequest(const std::string& assetId) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = requests_.find(assetId);
+    if (it == requests_.end()) return std::nullopt;
+    return it->second;
+}
+
+std::optional<std::string> ImportPipeline::assetIdForSource(const std::string& sourcePath) const {
+    const std::string key = normalizeSourcePath(sourcePath);
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = assetBySource_.find(key);
+    if (it == assetBySource_.end()) return std::nullopt;
+    return it->second;
+}
+
+std::size_t ImportPipeline::trackedCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return requests_.size();
+}
+
+std::string ImportPipeline::normalizeSourcePath(const std::string& path) {
+    std::error_code ec;
+    const std::filesystem::path absolute = std::filesystem::absolute(path, ec);
+    return (ec ? std::filesystem::path(path) : absolute).lexically_normal().string();
+}
+
+ImportResult ImportPipeline::runImporter(const ImportRequest& request) const {
+    ImportResult result{};
+    result.assetId = request.destinationPath;
 
+    // importer를 지정하지 않은 요청은 원본을 그대로 쓰는 애셋으로 본다.
+    if (request.importer.empty()) {
+        result.success = true;
+        result.message = "imported";
+        return result;
+    }
+
+    ImporterEntry importer;
+    DerivedDataCache* cache = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto it = importers_.find(request.importer);
+        if (it != importers_.end()) importer = it->second;
+        cache = cache_;
+    }
+    if (!importer.cook) {
+        result.success = false;
+        result.message = "unknown importer: " + request.importer;
+        return result;
+    }
+
+    std::optional<DerivedDataCache::Key> key;
+    if (cache) {
+        if (const auto source = ::rex::core::platform::FileSystem::readBinary(request.sourcePath)) {
+            key = DerivedDataCache::makeKey(*source, request.importer, importer.version, request.settings);
+            if (auto cooked = cache->load(*key)) {
+                result.success = true;
+                result.cacheHit = true;
+                result.message = "cache hit";
+                if (importer.load) result.artifact = importer.load(*cooked);
+                result.cooked = std::move(*cooked);
+                // 로더가 복원하지 못하면(형식 불일치 등) 아래에서 다시 처리한다.
+                if (!importer.load || result.artifact) return result;
+                result = ImportResult{};
+                result.assetId = request.destinationPath;
+            }
+        }
+    }
+
+    result = importer.cook(request);
+    result.assetId = request.destinationPath;
+    if (result.success && result.message.empty()) result.message = "imported";
+    if (result.success && key && !result.cooked.empty()) cache->store(*key, result.cooked);
+    return result;
+}
+
+} // namespace rex::editor::asset
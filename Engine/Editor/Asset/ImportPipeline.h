@@ -1,6 +1,15 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace rex::editor::asset {
@@ -9,18 +18,64 @@ struct ImportRequest {
     std::string sourcePath;
     std::string destinationPath;
     std::string importer;
+    // importer 옵션(압축, 스케일 등). 캐시 키에 포함되므로 순서가 고정된 map을 쓴다.
+    std::map<std::string, std::string> settings;
 };
 
 struct ImportResult {
     bool success = false;
     std::string assetId;
     std::string message;
+    // importer가 만든 CPU 데이터(예: gfx::MeshData). 핫 리로드가 프레임 경계에서 GPU 리소스를 교체할 때 쓴다.
+    std::shared_ptr<void> artifact;
+    // 캐시에 저장할 직렬화된 결과. 비어 있으면 캐시하지 않는다.
+    std::vector<std::byte> cooked;
+    bool cacheHit = false;
 };
 
+class DerivedDataCache;
+
+// importer 이름별 처리 함수를 실행하고, 성공한 요청을 assetId 단위로 추적해 reimport에 재사용한다.
+// importAsset/reimportAsset은 백그라운드 작업에서 호출될 수 있으므로 importer 함수는 스레드 안전해야 한다.
+// 파생 데이터 캐시가 연결되어 있으면 (원본, importer, 버전, 설정)이 같은 요청은 처리 없이 캐시에서 복원한다.
 class ImportPipeline {
 public:
+    using Importer = std::function<ImportResult(const ImportRequest&)>;
+    // 캐시 히트 시 cooked 바이트로 artifact를 복원한다. 없으면 cooked만 채워 돌려준다.
+    using Loader = std::function<std::shared_ptr<void>(std::span<const std::byte> cooked)>;
+
+    // 출력 형식이 바뀌면 version을 올려 이전 캐시 항목을 무효화한다.
+    void registerImporter(const std::string& name, Importer importer, std::uint32_t version = 1, Loader loader = {});
+    void setDerivedDataCache(DerivedDataCache* cache);
+    bool hasImporter(const std::string& name) const;
+
     ImportResult importAsset(const ImportRequest& request);
     ImportResult reimportAsset(const std::string& assetId);
+
+    // 이미 import된 애셋을 처리 없이 reimport 추적 대상으로 등록한다(에디터 시작 시 스캔 결과 등).
+    bool track(const ImportRequest& request);
+
+    std::optional<ImportRequest> findRequest(const std::string& assetId) const;
+    std::optional<std::string> assetIdForSource(const std::string& sourcePath) const;
+    std::size_t trackedCount() const;
+
+    // 절대 경로 + lexically_normal. 감시자 경로와 요청 경로를 같은 키로 맞춘다.
+    static std::string normalizeSourcePath(const std::string& path);
+
+private:
+    ImportResult runImporter(const ImportRequest& request) const;
+
+    struct ImporterEntry {
+        Importer cook;
+        Loader load;
+        std::uint32_t version = 1;
+    };
+
+    mutable std::mutex mutex_;
+    DerivedDataCache* cache_ = nullptr;
+    std::unordered_map<std::string, ImporterEntry> importers_;
+    std::unordered_map<std::string, ImportRequest> requests_;
+    std::unordered_map<std::string, std::string> assetBySource_;
 };
 
 // TODO [Editor-Asset-003]:
@@ -31,13 +86,17 @@ public:
 //  - 실패 메시지/복구 경로 제공
 // 의존성:
 //  - Editor/Asset/AssetRegistry
+//  - Editor/Asset/DerivedDataCache
 // 구현 단계: Phase B
 // 성능 고려사항:
-//  - 비동기 import 큐 연계
+//  - 비동기 import 큐 연계(HotReloadService)
+//  - importer 실행은 락 밖에서(병렬 reimport 허용)
+//  - 캐시 히트 시 원본 해시 + 캐시 파일 읽기만 수행
 //  - 대형 파일 처리 시 메모리 피크 제어
 // 테스트 전략:
 //  - import/reimport 성공/실패 테스트
 //  - 잘못된 포맷 처리 테스트
+//  - 미등록 importer 실패 테스트
+//  - 캐시 히트 시 importer 미호출 테스트
 
 } // namespace rex::editor::asset
-
@@ -3,6 +3,7 @@
 #include <array>
 #include <memory>
 
+#include "../Debug/ProfilerPanel.h"
 #include "../Panels/ContentBrowserPanel.h"
 #include "../Panels/DetailsPanel.h"
 #include "../Panels/OutlinerPanel.h"
@@ -86,6 +87,14 @@ const std::vector<std::shared_ptr<panels::IEditorPanel>>& EditorApp::activePanel
     return activePanels_;
 }
 
+::rex::core::time::FrameTimingStats& EditorApp::frameTiming() {
+    return frameTiming_;
+}
+
+const ::rex::core::time::FrameTimingStats& EditorApp::frameTiming() const {
+    return frameTiming_;
+}
+
 bool EditorApp::registerCorePanels() {
     auto& registry = moduleManager_.panelRegistry();
 
@@ -102,15 +111,19 @@ bool EditorApp::registerCorePanels() {
     ok = ok && registerPanelFactory(registry, "content_browser", []() {
         return std::make_shared<panels::ContentBrowserPanel>();
     });
+    ok = ok && registerPanelFactory(registry, "profiler", []() {
+        return std::make_shared<debug::ProfilerPanel>();
+    });
     return ok;
 }
 
 bool EditorApp::attachCorePanels() {
-    static constexpr std::array<const char*, 4> kCorePanelIds = {
+    static constexpr std::array<const char*, 5> kCorePanelIds = {
         "viewport",
         "outliner",
         "details",
         "content_browser",
+        "profiler",
     };
 
     detachPanels();
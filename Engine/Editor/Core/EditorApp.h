@@ -5,6 +5,7 @@
 #include <string>
 #include <vector>
 
+#include "../../Core/Time/FrameTimeHistogram.h"
 #include "../../UI/RexUI/App/RexUIEngine.h"
 #include "../../UI/RexUI/Framework/Docking/DockManager.h"
 #include "../Plugin/EditorModuleManager.h"
@@ -38,6 +39,10 @@ public:
     plugin::EditorModuleManager& moduleManager();
     const std::vector<std::shared_ptr<panels::IEditorPanel>>& activePanels() const;
 
+    // 호스트 루프가 매 프레임 기록하고, 프로파일러 패널이 상태 스토어로 퍼블리시한다.
+    ::rex::core::time::FrameTimingStats& frameTiming();
+    const ::rex::core::time::FrameTimingStats& frameTiming() const;
+
 private:
     bool registerCorePanels();
     bool attachCorePanels();
@@ -55,6 +60,7 @@ private:
     LayoutService layoutService_{};
     plugin::EditorModuleManager moduleManager_{};
     std::vector<std::shared_ptr<panels::IEditorPanel>> activePanels_{};
+    ::rex::core::time::FrameTimingStats frameTiming_{};
 };
 
 // TODO [Editor-Core-009]:
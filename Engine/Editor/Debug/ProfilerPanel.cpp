@@ -0,0 +1,90 @@
+#include "ProfilerPanel.h"
+
+#include "../Core/EditorApp.h"
+
+#include <algorithm>
+
+namespace rex::editor::debug {
+
+namespace {
+void publishHistogram(ui::framework::state::UIStateStore& store,
+                      const std::string& prefix,
+                      const ::rex::core::time::FrameTimeHistogram& histogram) {
+    const auto summary = histogram.summary();
+    store.set(prefix + ".p50", summary.p50);
+    store.set(prefix + ".p95", summary.p95);
+    store.set(prefix + ".p99", summary.p99);
+    store.set(prefix + ".max", summary.max);
+    store.set(prefix + ".mean", summary.mean);
+    store.set(prefix + ".samples", static_cast<std::int64_t>(summary.samples));
+}
+
+void removeHistogram(ui::framework::state::UIStateStore& store, const std::string& prefix) {
+    for (const char* field : {"p50", "p95", "p99", "max", "mean", "samples"}) {
+        store.remove(prefix + "." + field);
+    }
+}
+}
+
+bool ProfilerPanel::onAttach(core::EditorApp& app) {
+    if (dockPanelId_ == 0) {
+        dockPanelId_ = app.dockManager().createPanel(title());
+    }
+
+    app.stateStore().rawStore().set("editor.panels.profiler.visible", true);
+    sincePublish_ = publishInterval_;
+    return true;
+}
+
+void ProfilerPanel::onDetach(core::EditorApp& app) {
+    if (dockPanelId_ != 0) {
+        app.dockManager().destroyPanel(dockPanelId_);
+        dockPanelId_ = 0;
+    }
+
+    auto& store = app.stateStore().rawStore();
+    store.remove("editor.panels.profiler.visible");
+    for (const char* metric : {"frame_ms", "cpu_ms", "gpu_ms"}) {
+        removeHistogram(store, std::string("editor.profiler.") + metric);
+    }
+    store.remove("editor.profiler.fps");
+    for (const auto& prefix : publishedPassPrefixes_) {
+        removeHistogram(store, prefix + ".cpu_ms");
+        removeHistogram(store, prefix + ".gpu_ms");
+    }
+    store.remove("editor.profiler.passes");
+    publishedPassPrefixes_.clear();
+}
+
+void ProfilerPanel::onTick(core::EditorApp& app, float dt) {
+    sincePublish_ += dt;
+    if (sincePublish_ < publishInterval_) return;
+    sincePublish_ = 0.0f;
+
+    const auto& stats = app.frameTiming();
+    auto& store = app.stateStore().rawStore();
+    store.beginBatch();
+    publishHistogram(store, "editor.profiler.frame_ms", stats.frame());
+    publishHistogram(store, "editor.profiler.cpu_ms", stats.cpu());
+    publishHistogram(store, "editor.profiler.gpu_ms", stats.gpu());
+    const double meanFrameMs = stats.frame().summary().mean;
+    store.set("editor.profiler.fps", meanFrameMs > 0.0 ? 1000.0 / meanFrameMs : 0.0);
+
+    // 렌더 패스별 CPU/GPU 시간: editor.profiler.pass.<이름>.{cpu_ms,gpu_ms}.*
+    // editor.profiler.passes에는 실행 순서대로 쉼표로 구분한 패스 이름 목록을 둔다.
+    std::string passList;
+    for (const auto& pass : stats.passes()) {
+        const std::string prefix = std::string("editor.profiler.pass.") + pass.name;
+        publishHistogram(store, prefix + ".cpu_ms", pass.cpu);
+        publishHistogram(store, prefix + ".gpu_ms", pass.gpu);
+        if (!passList.empty()) passList += ',';
+        passList += pass.name;
+        if (std::find(publishedPassPrefixes_.begin(), publishedPassPrefixes_.end(), prefix) == publishedPassPrefixes_.end()) {
+            publishedPassPrefixes_.push_back(prefix);
+        }
+    }
+    if (!passList.empty()) store.set("editor.profiler.passes", passList);
+    store.endBatch();
+}
+
+} // namespace rex::editor::debug
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <cstdint>
+#include <string>
+#include <vector>
+
 #include "../Panels/IEditorPanel.h"
 
 namespace rex::editor::debug {
@@ -12,6 +16,14 @@ public:
     bool onAttach(core::EditorApp& app) override;
     void onDetach(core::EditorApp& app) override;
     void onTick(core::EditorApp& app, float dt) override;
+
+private:
+    // 통계 퍼블리시 주기(초). 매 프레임 상태 스토어를 갱신하지 않는다.
+    float publishInterval_ = 0.25f;
+    float sincePublish_ = 0.0f;
+    std::uint64_t dockPanelId_ = 0;
+    // onDetach에서 지울 패스별 키 접두사.
+    std::vector<std::string> publishedPassPrefixes_;
 };
 
 // TODO [Editor-Debug-001]:
@@ -20,9 +32,11 @@ public:
 //  - 실시간 FPS/frametime 표시
 //  - 샘플 히스토리 시각화
 //  - 엔진 프로파일 훅과 연동
+//  - 렌더 패스별 CPU/GPU 시간 표시
 // 의존성:
 //  - Editor/Panels/IEditorPanel
 //  - Core/Diagnostics/ProfilerHooks
+//  - Core/Time/FrameTimeHistogram
 // 구현 단계: Phase C
 // 성능 고려사항:
 //  - 샘플 버퍼 고정 크기 유지
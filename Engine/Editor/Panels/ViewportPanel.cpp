@@ -1,6 +1,10 @@
 #include "ViewportPanel.h"
 
 #include "../Core/EditorApp.h"
+#include "../../Graphics/Core/RenderDevice.h"
+
+#include <cstddef>
+#include <iterator>
 
 namespace rex::editor::panels {
 
@@ -13,6 +17,41 @@ std::int64_t renderModeToValue(core::ViewportRenderMode mode) {
     }
     return 0;
 }
+
+constexpr const char* kOverlayKeys[] = {
+    "editor.panels.viewport.overlay.draw_calls",
+    "editor.panels.viewport.overlay.instances",
+    "editor.panels.viewport.overlay.triangles",
+    "editor.panels.viewport.overlay.program_binds",
+    "editor.panels.viewport.overlay.vertex_array_binds",
+    "editor.panels.viewport.overlay.framebuffer_binds",
+    "editor.panels.viewport.overlay.texture_binds",
+    "editor.panels.viewport.overlay.uniform_updates",
+    "editor.panels.viewport.overlay.upload_bytes",
+};
+
+void publishRenderStats(ui::framework::state::UIStateStore& store, const gfx::RenderStats& stats) {
+    const std::int64_t values[] = {
+        stats.drawCalls,
+        stats.instances,
+        static_cast<std::int64_t>(stats.triangles),
+        stats.programBinds,
+        stats.vertexArrayBinds,
+        stats.framebufferBinds,
+        stats.textureBinds,
+        stats.uniformUpdates,
+        static_cast<std::int64_t>(stats.uploadBytes),
+    };
+    for (std::size_t i = 0; i < std::size(kOverlayKeys); ++i) {
+        store.set(kOverlayKeys[i], values[i]);
+    }
+}
+
+void removeRenderStats(ui::framework::state::UIStateStore& store) {
+    for (const char* key : kOverlayKeys) {
+        store.remove(key);
+    }
+}
 }
 
 bool ViewportPanel::onAttach(core::EditorApp& app) {
@@ -41,6 +80,8 @@ void ViewportPanel::onDetach(core::EditorApp& app) {
     store.remove("editor.panels.viewport.debug_overlay");
     store.remove("editor.panels.viewport.selection_outline");
     store.remove("editor.panels.viewport.post_process");
+    removeRenderStats(store);
+    renderStatsPublished_ = false;
 }
 
 void ViewportPanel::onTick(core::EditorApp& app, float dt) {
@@ -57,6 +98,14 @@ void ViewportPanel::onTick(core::EditorApp& app, float dt) {
     store.set("editor.panels.viewport.render_mode", renderModeToValue(typed.viewportRenderMode));
     store.set("editor.panels.viewport.selected_entity_count",
               static_cast<std::int64_t>(typed.selectedEntities.size()));
+    // 디버그 오버레이: 직전 프레임 RenderDevice 카운터(드로우/삼각형/바인드/유니폼/업로드 바이트).
+    if (debugOverlay_) {
+        publishRenderStats(store, gfx::RenderDevice::frameStats());
+        renderStatsPublished_ = true;
+    } else if (renderStatsPublished_) {
+        removeRenderStats(store);
+        renderStatsPublished_ = false;
+    }
     store.endBatch();
 }
 
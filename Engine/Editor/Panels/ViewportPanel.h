@@ -26,6 +26,7 @@ private:
     bool debugOverlay_ = true;
     bool showSelectionOutline_ = true;
     bool showPostProcess_ = true;
+    bool renderStatsPublished_ = false;
     std::uint64_t dockPanelId_ = 0;
 };
 
@@ -35,9 +36,11 @@ private:
 //  - gizmo/선택/카메라 입력 연동
 //  - 렌더 모드(wireframe/lighting-only) 토글
 //  - 디버그 오버레이(FPS/frametime) 표시
+//  - 렌더 통계(드로우 콜/삼각형/상태 바인드/유니폼/업로드) 오버레이
 // 의존성:
 //  - Editor/Core/EditorApp
 //  - Editor/Gizmo/TransformGizmo
+//  - Graphics/Core/RenderDevice
 // 구현 단계: Phase A
 // 성능 고려사항:
 //  - viewport resize 시 재할당 최소화
@@ -1,6 +1,7 @@
 #include "../Core/Components.h"
 #include "../Core/Logger.h"
 #include "../Core/Scene.h"
+#include "../Graphics/Core/RenderDevice.h"
 #include "../Graphics/GLInternal.h"
 #include "../Graphics/Mesh.h"
 #include "../Graphics/Renderer.h"
@@ -49,6 +50,7 @@ struct EditorUIRefs {
 
     Label* outputLabel = nullptr;
     Label* viewportLabel = nullptr;
+    Label* renderStatsLabel = nullptr;
 };
 
 struct EditorState {
@@ -127,10 +129,20 @@ std::string formatFloat(float v) {
     return std::string(buf);
 }
 
+std::string formatRenderStats(const gfx::RenderStats& stats) {
+    char buf[192];
+    std::snprintf(buf, sizeof(buf),
+                  "Draws %u | Tris %llu | Binds P%u V%u F%u T%u | Uniforms %u | Upload %.1f KB",
+                  stats.drawCalls, static_cast<unsigned long long>(stats.triangles),
+                  stats.programBinds, stats.vertexArrayBinds, stats.framebufferBinds, stats.textureBinds,
+                  stats.uniformUpdates, static_cast<double>(stats.uploadBytes) / 1024.0);
+    return std::string(buf);
+}
+
 EntityId addCubeEntity(EditorState& state, const Vec3& position) {
     EntityId e = state.scene.createEntity();
     state.scene.addComponent<Transform>(e, position);
-    state.scene.addComponent<MeshRenderer>(e, nullptr, state.cubeMesh, Vec3{1.0f, 1.0f, 1.0f});
+    state.scene.addComponent<MeshRenderer>(e, state.cubeMesh, Vec3{1.0f, 1.0f, 1.0f});
     state.hierarchyDirty = true;
     pushLog(state, "Add Cube: Entity " + std::to_string(e));
     return e;
@@ -237,6 +249,10 @@ void syncInspectorFromSelection(EditorState& state, UIContext& ui, EditorUIRefs&
             state.sceneTabActive ? "Viewport: Scene" : "Viewport: Game");
     }
 
+    if (uiRefs.renderStatsLabel) {
+        uiRefs.renderStatsLabel->setText(formatRenderStats(gfx::RenderDevice::frameStats()));
+    }
+
     if (uiRefs.outputLabel) {
         if (state.logs.empty()) {
             uiRefs.outputLabel->setText("Output: Ready");
@@ -400,6 +416,9 @@ void buildEditorUI(UIContext& ui, EditorState& state, EditorUIRefs& refs) {
         auto viewportLabel = std::make_unique<Label>("Viewport: Scene");
         refs.viewportLabel = viewportLabel.get();
         sceneTab->addChild(std::move(viewportLabel));
+        auto renderStatsLabel = std::make_unique<Label>("Draws 0");
+        refs.renderStatsLabel = renderStatsLabel.get();
+        sceneTab->addChild(std::move(renderStatsLabel));
         sceneTab->addChild(std::make_unique<Label>("RMB: look around | WASD/Space/Ctrl: move camera"));
         sceneTab->addChild(std::make_unique<Label>("W/E/R: Translate/Rotate/Scale mode"));
 
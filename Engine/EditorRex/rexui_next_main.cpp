@@ -1,4 +1,12 @@
+#include "../Core/Diagnostics/FrameWatchdog.h"
+#include "../Core/Job/ThreadPool.h"
 #include "../Core/Logger.h"
+#include "../Core/Time/FramePacer.h"
+#include "../Editor/Asset/DependencyGraph.h"
+#include "../Editor/Asset/DerivedDataCache.h"
+#include "../Editor/Asset/HotReloadAssets.h"
+#include "../Editor/Asset/HotReloadService.h"
+#include "../Editor/Asset/ImportPipeline.h"
 #include "../Editor/Core/EditorApp.h"
 #include "../Graphics/GLInternal.h"
 #include "../UI/RexUI/App/RexUIEngine.h"
@@ -17,9 +25,15 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
 #include <memory>
+#include <span>
 #include <string>
+#include <string_view>
 #include <variant>
 
 using namespace rex;
@@ -103,7 +117,27 @@ std::shared_ptr<ui::widgets::basic::TextWidget> makeText(const std::string& text
 
 } // namespace
 
-int main() {
+int main(int argc, char** argv) {
+    // --fps N: pace the editor loop to N frames per second instead of relying on vsync alone.
+    // --watchdog MS / --watchdog-p99 X: dump the recent frame window to Spikes/ when a frame is slow.
+    // --watch DIR: reimport changed OBJ and shader (.vert/.frag) files into the derived-data cache
+    // in the background.
+    double targetFps = 0.0;
+    std::filesystem::path watchDirectory;
+    rex::core::diagnostics::FrameWatchdogConfig watchdogConfig{};
+    for (int i = 1; i + 1 < argc; ++i) {
+        const std::string_view arg(argv[i]);
+        if (arg == "--fps") {
+            targetFps = std::max(0.0, std::strtod(argv[++i], nullptr));
+        } else if (arg == "--watchdog") {
+            watchdogConfig.budgetMs = std::max(0.0, std::strtod(argv[++i], nullptr));
+        } else if (arg == "--watchdog-p99") {
+            watchdogConfig.p99Multiplier = std::max(0.0, std::strtod(argv[++i], nullptr));
+        } else if (arg == "--watch") {
+            watchDirectory = argv[++i];
+        }
+    }
+
     if (SDL_Init(SDL_INIT_VIDEO) < 0) {
         Logger::error("SDL Init Error: {}", SDL_GetError());
         return 1;
@@ -239,11 +273,43 @@ int main() {
     editorApp.stateStore().state().activeScenePath = "Scenes/Sandbox.rexscene";
     editorApp.stateStore().rawStore().set("editor.scene.path", std::string("Scenes/Sandbox.rexscene"));
 
+    // Reimports run on importJobs and only their results reach this thread, at the top of a frame.
+    // The editor has no 3D viewport yet, so it keeps the cooked results in the derived-data cache
+    // and reports the count; rex-runtime --watch swaps the GPU meshes and shaders.
+    core::job::ThreadPool importJobs(2);
+    std::unique_ptr<editor::asset::DerivedDataCache> derivedData;
+    editor::asset::ImportPipeline importPipeline;
+    editor::asset::DependencyGraph assetDependencies;
+    editor::asset::HotReloadService hotReload(importPipeline, assetDependencies, importJobs);
+    if (!watchDirectory.empty()) {
+        editor::asset::registerHotReloadImporters(importPipeline);
+        // Cooked results keyed by source content; kept across sessions so unchanged assets skip parsing.
+        derivedData = std::make_unique<editor::asset::DerivedDataCache>(
+            std::filesystem::path(workspace.cacheRoot) / "DerivedData", 2ull * 1024 * 1024 * 1024);
+        importPipeline.setDerivedDataCache(derivedData.get());
+        const std::size_t tracked = editor::asset::trackWatchedAssets(watchDirectory, importPipeline, assetDependencies);
+        if (hotReload.watch(watchDirectory)) {
+            Logger::info("Hot reload: watching {} ({} assets)", watchDirectory.string(), tracked);
+        }
+        hotReload.setApplyHandler([&](std::span<const editor::asset::ImportResult>) {
+            editorApp.stateStore().rawStore().set("editor.assets.reloaded",
+                                                  static_cast<std::int64_t>(hotReload.stats().reimported));
+        });
+    }
+
     bool running = true;
     std::uint64_t frameIndex = 0;
     std::uint64_t lastTicks = SDL_GetTicks64();
 
+    using FrameClock = rex::core::time::FramePacer::Clock;
+    rex::core::time::FramePacerConfig pacerConfig{};
+    pacerConfig.targetFps = targetFps;
+    rex::core::time::FramePacer pacer(pacerConfig);
+    FrameClock::time_point frameStart = FrameClock::now();
+    rex::core::diagnostics::FrameWatchdog watchdog(watchdogConfig);
+
     while (running) {
+        watchdog.beginFrame(frameIndex);
         SDL_Event ev;
         while (SDL_PollEvent(&ev)) {
             if (ev.type == SDL_QUIT) {
@@ -281,6 +347,8 @@ int main() {
             }
         }
 
+        hotReload.update();
+
         const std::uint64_t now = SDL_GetTicks64();
         float dt = static_cast<float>(now - lastTicks) / 1000.0f;
         lastTicks = now;
@@ -297,11 +365,18 @@ int main() {
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
         uiEngine.setViewport(static_cast<std::uint32_t>(w), static_cast<std::uint32_t>(h));
+        const FrameClock::time_point tickBegin = FrameClock::now();
         if (!editorApp.tick(dt, frameIndex++)) {
             Logger::error("Editor frame failed");
             running = false;
             continue;
         }
+        watchdog.setCounter("Editor tick ms",
+                            std::chrono::duration<double, std::milli>(FrameClock::now() - tickBegin).count());
+        watchdog.setCounter("UI frame memory KB",
+                            static_cast<double>(uiEngine.frameMemory().highWaterBytes()) / 1024.0);
+        watchdog.setCounter("UI frame memory overflows",
+                            static_cast<double>(uiEngine.frameMemory().overflowAllocations()));
 
         std::int64_t panelCount = 0;
         if (const auto v = editorApp.stateStore().rawStore().get("editor.panels.active_count")) {
@@ -327,6 +402,14 @@ int main() {
                 canRedo = *b;
             }
         }
+        double frameP99Ms = 0.0;
+        if (const auto v = editorApp.stateStore().rawStore().get("editor.profiler.frame_ms.p99")) {
+            if (const auto* d = std::get_if<double>(&*v)) {
+                frameP99Ms = *d;
+            }
+        }
+        char frameText[32];
+        std::snprintf(frameText, sizeof(frameText), "%.2f", frameP99Ms);
 
         outlinerInfo->setText("Selected entities: " + std::to_string(selectedEntityCount));
         detailsInfo->setText(
@@ -334,15 +417,26 @@ int main() {
                 ? "Selection count: " + std::to_string(selectedEntityCount)
                 : "No selection");
         viewportInfo->setText("Scene: " + editorApp.stateStore().state().activeScenePath);
-        contentInfo->setText("Assets: 0 | Filter: *");
+        contentInfo->setText("Assets: " + std::to_string(importPipeline.trackedCount()) + " | Filter: *");
         outputInfo->setText("Panels: " + std::to_string(panelCount) + " | Editor tick running");
         status->setText(
             "Panels " + std::to_string(panelCount) +
             " | Selected " + std::to_string(selectedEntityCount) +
             " | Undo " + (canUndo ? "Yes" : "No") +
-            " | Redo " + (canRedo ? "Yes" : "No"));
+            " | Redo " + (canRedo ? "Yes" : "No") +
+            " | Frame p99 " + frameText + " ms");
 
+        const FrameClock::time_point cpuEnd = FrameClock::now();
         SDL_GL_SwapWindow(window);
+        watchdog.setCounter("Swap ms", std::chrono::duration<double, std::milli>(FrameClock::now() - cpuEnd).count());
+
+        // The pacer's sleep is idle time, not frame work; close the watchdog frame before it.
+        watchdog.endFrame();
+        const FrameClock::time_point nextFrameStart = pacer.wait();
+        editorApp.frameTiming().recordFrame(
+            std::chrono::duration<double, std::milli>(nextFrameStart - frameStart).count(),
+            std::chrono::duration<double, std::milli>(cpuEnd - frameStart).count());
+        frameStart = nextFrameStart;
     }
 
     editorApp.shutdown();
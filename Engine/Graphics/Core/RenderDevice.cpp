@@ -1,9 +1,36 @@
 #include "RenderDevice.h"
 
+#include "../../Core/Diagnostics/ProfilerHooks.h"
+
 namespace rex::gfx {
 
+namespace {
+RenderStats g_current{};
+RenderStats g_lastFrame{};
+RenderStats g_total{};
+uint64_t g_frameCount = 0;
+
+uint64_t trianglesFor(uint32_t mode, int count) {
+    return mode == GL_TRIANGLES && count > 0 ? static_cast<uint64_t>(count) / 3 : 0;
+}
+} // namespace
+
+RenderStats& RenderStats::operator+=(const RenderStats& other) {
+    drawCalls += other.drawCalls;
+    instances += other.instances;
+    triangles += other.triangles;
+    programBinds += other.programBinds;
+    vertexArrayBinds += other.vertexArrayBinds;
+    framebufferBinds += other.framebufferBinds;
+    textureBinds += other.textureBinds;
+    uniformUpdates += other.uniformUpdates;
+    uploadBytes += other.uploadBytes;
+    return *this;
+}
+
 void RenderDevice::bindFramebuffer(uint32_t fbo) {
     glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    ++g_current.framebufferBinds;
 }
 
 void RenderDevice::setViewport(int x, int y, int w, int h) {
@@ -33,4 +60,94 @@ void RenderDevice::setCullFace(bool enabled) {
     }
 }
 
+void RenderDevice::useProgram(uint32_t program) {
+    glUseProgram(program);
+    ++g_current.programBinds;
+}
+
+void RenderDevice::bindVertexArray(uint32_t vao) {
+    glBindVertexArray(vao);
+    ++g_current.vertexArrayBinds;
+}
+
+void RenderDevice::bindTexture(uint32_t unit, uint32_t texture) {
+    glActiveTexture(GL_TEXTURE0 + unit);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    ++g_current.textureBinds;
+}
+
+void RenderDevice::bufferData(uint32_t target, std::size_t bytes, const void* data, uint32_t usage) {
+    glBufferData(target, static_cast<GLsizeiptr>(bytes), data, usage);
+    g_current.uploadBytes += bytes;
+}
+
+void RenderDevice::setUniform(int location, int value) {
+    glUniform1i(location, value);
+    ++g_current.uniformUpdates;
+}
+
+void RenderDevice::setUniform(int location, float value) {
+    glUniform1f(location, value);
+    ++g_current.uniformUpdates;
+}
+
+void RenderDevice::setUniform(int location, float x, float y, float z) {
+    glUniform3f(location, x, y, z);
+    ++g_current.uniformUpdates;
+}
+
+void RenderDevice::setUniform(int location, float x, float y, float z, float w) {
+    glUniform4f(location, x, y, z, w);
+    ++g_current.uniformUpdates;
+}
+
+void RenderDevice::setUniformMatrix4(int location, const float* values) {
+    glUniformMatrix4fv(location, 1, GL_FALSE, values);
+    ++g_current.uniformUpdates;
+}
+
+void RenderDevice::drawArrays(uint32_t mode, int first, int count) {
+    glDrawArrays(mode, first, count);
+    ++g_current.drawCalls;
+    ++g_current.instances;
+    g_current.triangles += trianglesFor(mode, count);
+}
+
+void RenderDevice::drawElements(uint32_t mode, int count, uint32_t indexType, std::size_t indexOffset) {
+    glDrawElements(mode, count, indexType, reinterpret_cast<const void*>(indexOffset));
+    ++g_current.drawCalls;
+    ++g_current.instances;
+    g_current.triangles += trianglesFor(mode, count);
+}
+
+void RenderDevice::endFrame() {
+    g_lastFrame = g_current;
+    g_total += g_current;
+    g_current = RenderStats{};
+    ++g_frameCount;
+
+    REX_TRACE_COUNTER("Draw calls", g_lastFrame.drawCalls);
+    REX_TRACE_COUNTER("Triangles", g_lastFrame.triangles);
+    REX_TRACE_COUNTER("State binds", g_lastFrame.programBinds + g_lastFrame.vertexArrayBinds +
+                                         g_lastFrame.framebufferBinds + g_lastFrame.textureBinds);
+    REX_TRACE_COUNTER("Uniform updates", g_lastFrame.uniformUpdates);
+    REX_TRACE_COUNTER("Upload KB", static_cast<double>(g_lastFrame.uploadBytes) / 1024.0);
+}
+
+const RenderStats& RenderDevice::frameStats() {
+    return g_lastFrame;
+}
+
+const RenderStats& RenderDevice::currentStats() {
+    return g_current;
+}
+
+const RenderStats& RenderDevice::totalStats() {
+    return g_total;
+}
+
+uint64_t RenderDevice::frameCount() {
+    return g_frameCount;
+}
+
 } // namespace rex::gfx
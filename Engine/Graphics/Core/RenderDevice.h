@@ -2,8 +2,27 @@
 
 #include "../GLInternal.h"
 
+#include <cstddef>
+#include <cstdint>
+
 namespace rex::gfx {
 
+// Per-frame GL call counters. Every draw, bind, uniform update and buffer upload issued
+// through RenderDevice is counted; raw gl* calls elsewhere are not.
+struct RenderStats {
+    uint32_t drawCalls = 0;
+    uint32_t instances = 0;
+    uint64_t triangles = 0;
+    uint32_t programBinds = 0;
+    uint32_t vertexArrayBinds = 0;
+    uint32_t framebufferBinds = 0;
+    uint32_t textureBinds = 0;
+    uint32_t uniformUpdates = 0;
+    uint64_t uploadBytes = 0;
+
+    RenderStats& operator+=(const RenderStats& other);
+};
+
 class RenderDevice {
 public:
     static void bindFramebuffer(uint32_t fbo);
@@ -12,6 +31,31 @@ public:
     static void clearDepth();
     static void setDepthTest(bool enabled);
     static void setCullFace(bool enabled);
+
+    static void useProgram(uint32_t program);
+    static void bindVertexArray(uint32_t vao);
+    // Binds a GL_TEXTURE_2D to texture unit `unit` (0-based).
+    static void bindTexture(uint32_t unit, uint32_t texture);
+    static void bufferData(uint32_t target, std::size_t bytes, const void* data, uint32_t usage);
+
+    static void setUniform(int location, int value);
+    static void setUniform(int location, float value);
+    static void setUniform(int location, float x, float y, float z);
+    static void setUniform(int location, float x, float y, float z, float w);
+    static void setUniformMatrix4(int location, const float* values);
+
+    static void drawArrays(uint32_t mode, int first, int count);
+    static void drawElements(uint32_t mode, int count, uint32_t indexType, std::size_t indexOffset);
+
+    // Closes the current frame: its counters become frameStats() and counting restarts.
+    // Work issued between frames (e.g. mesh uploads at load time) lands in the next frame.
+    static void endFrame();
+
+    // Counters are plain values owned by the GL thread; read them there or while it is idle.
+    static const RenderStats& frameStats();
+    static const RenderStats& currentStats();
+    static const RenderStats& totalStats();
+    static uint64_t frameCount();
 };
 
 } // namespace rex::gfx
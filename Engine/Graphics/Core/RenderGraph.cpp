@@ -1,5 +1,7 @@
 #include "RenderGraph.h"
 
+#include "RenderPassProfiler.h"
+
 namespace rex::gfx {
 
 void RenderGraph::addPass(RenderPass& pass) {
@@ -11,10 +13,22 @@ void RenderGraph::clear() {
 }
 
 void RenderGraph::execute(RenderFrameContext& ctx) const {
+    if (!m_profiler) {
+        for (RenderPass* pass : m_passes) {
+            if (!pass) continue;
+            pass->execute(ctx);
+        }
+        return;
+    }
+
+    m_profiler->beginFrame();
     for (RenderPass* pass : m_passes) {
         if (!pass) continue;
+        m_profiler->beginPass(pass->name());
         pass->execute(ctx);
+        m_profiler->endPass();
     }
+    m_profiler->endFrame();
 }
 
 } // namespace rex::gfx
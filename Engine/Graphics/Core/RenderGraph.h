@@ -6,14 +6,21 @@
 
 namespace rex::gfx {
 
+class RenderPassProfiler;
+
 class RenderGraph {
 public:
     void addPass(RenderPass& pass);
     void clear();
     void execute(RenderFrameContext& ctx) const;
 
+    // Optional; when set, each pass is timed on the CPU and GPU. Survives clear().
+    void setProfiler(RenderPassProfiler* profiler) { m_profiler = profiler; }
+    RenderPassProfiler* profiler() const { return m_profiler; }
+
 private:
     std::vector<RenderPass*> m_passes;
+    RenderPassProfiler* m_profiler = nullptr;
 };
 
 } // namespace rex::gfx
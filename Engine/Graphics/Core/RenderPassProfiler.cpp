@@ -0,0 +1,144 @@
+#include "RenderPassProfiler.h"
+
+#include "../GLInternal.h"
+
+#include <string>
+
+namespace rex::gfx {
+
+RenderPassProfiler::~RenderPassProfiler() {
+    releaseGpuResources();
+}
+
+void RenderPassProfiler::releaseGpuResources() {
+    if (!m_queriesCreated) return;
+    for (auto& slot : m_ring) {
+        glDeleteQueries(static_cast<GLsizei>(slot.queries.size()), slot.queries.data());
+        slot.queries.fill(0);
+        slot.pending = false;
+    }
+    m_queriesCreated = false;
+}
+
+void RenderPassProfiler::ensureQueries() {
+    if (m_queriesCreated || !glGenQueries) return;
+    for (auto& slot : m_ring) {
+        glGenQueries(static_cast<GLsizei>(slot.queries.size()), slot.queries.data());
+    }
+    m_queriesCreated = true;
+}
+
+void RenderPassProfiler::beginFrame() {
+    if (m_gpuEnabled) ensureQueries();
+
+    // Resolve oldest-first so m_latest always moves forward.
+    for (std::size_t i = 1; i <= kFrameLatency; ++i) {
+        FrameSlot& slot = m_ring[(m_current + i) % kFrameLatency];
+        if (slot.pending && !tryResolve(slot)) break;
+    }
+
+    m_current = (m_current + 1) % kFrameLatency;
+    FrameSlot& slot = m_ring[m_current];
+    if (slot.pending) {
+        // Still not available after a full ring: reuse the queries and drop the old results.
+        slot.pending = false;
+        ++m_droppedFrames;
+    }
+    slot.passCount = 0;
+    slot.frameIndex = ++m_frameIndex;
+    m_inFrame = true;
+}
+
+void RenderPassProfiler::beginPass(const char* name) {
+    if (!m_inFrame) return;
+    m_passName = name;
+    m_passBegin = std::chrono::steady_clock::now();
+    m_passBeginTicks = core::diagnostics::TraceClock::now();
+
+    FrameSlot& slot = m_ring[m_current];
+    m_queryActive = m_gpuEnabled && m_queriesCreated && slot.passCount < kMaxPasses;
+    if (m_queryActive) {
+        glBeginQuery(GL_TIME_ELAPSED, slot.queries[slot.passCount]);
+    }
+}
+
+void RenderPassProfiler::endPass() {
+    if (!m_inFrame || !m_passName) return;
+    if (m_queryActive) {
+        glEndQuery(GL_TIME_ELAPSED);
+    }
+
+    const double cpuMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_passBegin).count();
+#if REX_ENABLE_TRACING
+    auto& recorder = core::diagnostics::TraceRecorder::instance();
+    if (recorder.enabled()) {
+        recorder.recordComplete(traceName(m_passName, false), "render", m_passBeginTicks, core::diagnostics::TraceClock::now());
+    }
+#endif
+
+    FrameSlot& slot = m_ring[m_current];
+    if (slot.passCount < kMaxPasses) {
+        slot.names[slot.passCount] = m_passName;
+        slot.cpuMs[slot.passCount] = cpuMs;
+        ++slot.passCount;
+    }
+    m_passName = nullptr;
+    m_queryActive = false;
+}
+
+void RenderPassProfiler::endFrame() {
+    if (!m_inFrame) return;
+    m_inFrame = false;
+    FrameSlot& slot = m_ring[m_current];
+    if (slot.passCount == 0) return;
+
+    if (m_gpuEnabled && m_queriesCreated) {
+        slot.pending = true;
+        return;
+    }
+
+    // No GPU timing: CPU times are final right away.
+    m_latest.clear();
+    for (std::size_t i = 0; i < slot.passCount; ++i) {
+        m_latest.push_back({slot.names[i], slot.cpuMs[i], 0.0});
+    }
+    m_latestFrame = slot.frameIndex;
+}
+
+bool RenderPassProfiler::tryResolve(FrameSlot& slot) {
+    const std::size_t count = std::min(slot.passCount, kMaxPasses);
+    // Queries complete in order, so the last one being available implies the rest are.
+    GLint available = GL_FALSE;
+    glGetQueryObjectiv(slot.queries[count - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (available == GL_FALSE) return false;
+
+    m_latest.clear();
+    for (std::size_t i = 0; i < count; ++i) {
+        GLuint64 elapsedNs = 0;
+        glGetQueryObjectui64v(slot.queries[i], GL_QUERY_RESULT, &elapsedNs);
+        const double gpuMs = static_cast<double>(elapsedNs) / 1.0e6;
+        m_latest.push_back({slot.names[i], slot.cpuMs[i], gpuMs});
+#if REX_ENABLE_TRACING
+        auto& recorder = core::diagnostics::TraceRecorder::instance();
+        if (recorder.enabled()) {
+            recorder.counter(traceName(slot.names[i], true), gpuMs);
+        }
+#endif
+    }
+    m_latestFrame = slot.frameIndex;
+    slot.pending = false;
+    return true;
+}
+
+core::diagnostics::TraceName RenderPassProfiler::traceName(const char* passName, bool gpu) {
+    auto& names = gpu ? m_gpuTraceNames : m_cpuTraceNames;
+    for (const auto& [raw, interned] : names) {
+        if (raw == passName) return interned;
+    }
+    const std::string label = gpu ? std::string("GPU ") + passName + " ms" : std::string(passName);
+    const auto interned = core::diagnostics::TraceRecorder::instance().intern(label);
+    names.emplace_back(passName, interned);
+    return interned;
+}
+
+} // namespace rex::gfx
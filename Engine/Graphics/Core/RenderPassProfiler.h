@@ -0,0 +1,82 @@
+#pragma once
+
+#include "../../Core/Diagnostics/TraceRecorder.h"
+#include "../../Core/Time/FrameTimeHistogram.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace rex::gfx {
+
+// Times each pass of a RenderGraph on the CPU and, with GL_TIME_ELAPSED queries, on the GPU.
+// Queries live in a ring of kFrameLatency frames and are read back only once available, so
+// GPU results trail the CPU by a few frames and never stall the pipeline.
+class RenderPassProfiler {
+public:
+    static constexpr std::size_t kFrameLatency = 4;
+    static constexpr std::size_t kMaxPasses = 16;
+
+    RenderPassProfiler() = default;
+    ~RenderPassProfiler();
+
+    RenderPassProfiler(const RenderPassProfiler&) = delete;
+    RenderPassProfiler& operator=(const RenderPassProfiler&) = delete;
+
+    void setGpuTimingEnabled(bool enabled) { m_gpuEnabled = enabled; }
+    bool gpuTimingEnabled() const { return m_gpuEnabled; }
+
+    // Called by RenderGraph::execute; `name` must outlive the profiler (RenderPass::name()).
+    void beginFrame();
+    void beginPass(const char* name);
+    void endPass();
+    void endFrame();
+
+    // Most recent frame whose GPU results are complete.
+    const std::vector<core::time::PassTiming>& latest() const { return m_latest; }
+    uint64_t latestFrameIndex() const { return m_latestFrame; }
+    // Ring frames reused before their results arrived (GPU more than kFrameLatency frames behind).
+    uint64_t droppedFrames() const { return m_droppedFrames; }
+
+    // Deletes the GL query objects; requires the GL context that created them.
+    void releaseGpuResources();
+
+private:
+    struct FrameSlot {
+        std::array<uint32_t, kMaxPasses> queries{};
+        std::array<const char*, kMaxPasses> names{};
+        std::array<double, kMaxPasses> cpuMs{};
+        std::size_t passCount = 0;
+        uint64_t frameIndex = 0;
+        bool pending = false;
+    };
+
+    void ensureQueries();
+    bool tryResolve(FrameSlot& slot);
+    core::diagnostics::TraceName traceName(const char* passName, bool gpu);
+
+    std::array<FrameSlot, kFrameLatency> m_ring{};
+    std::size_t m_current = 0;
+    uint64_t m_frameIndex = 0;
+    bool m_gpuEnabled = true;
+    bool m_queriesCreated = false;
+    bool m_inFrame = false;
+    bool m_queryActive = false;
+
+    const char* m_passName = nullptr;
+    uint64_t m_passBeginTicks = 0;
+    std::chrono::steady_clock::time_point m_passBegin{};
+
+    std::vector<core::time::PassTiming> m_latest;
+    uint64_t m_latestFrame = 0;
+    uint64_t m_droppedFrames = 0;
+
+    // Trace names for pass scopes and "GPU <pass>" counters, interned once per pass.
+    std::vector<std::pair<const char*, core::diagnostics::TraceName>> m_cpuTraceNames;
+    std::vector<std::pair<const char*, core::diagnostics::TraceName>> m_gpuTraceNames;
+};
+
+} // namespace rex::gfx
@@ -1,4 +1,6 @@
 #include "FrustumCuller.h"
+#include "../MeshLibrary.h"
+#include "../MeshLod.h"
 
 #include <algorithm>
 #include <cmath>
@@ -8,6 +10,8 @@ namespace rex::gfx {
 namespace {
 
 constexpr float DEG2RAD = 0.01745329251994329577f;
+// A LOD threshold is crossed once the projected size is this far (relative) past it.
+constexpr float kLodHysteresis = 0.1f;
 
 float max3(float a, float b, float c) {
     return std::max(a, std::max(b, c));
@@ -22,27 +26,38 @@ Vec3 normalizeSafe(const Vec3& v) {
 
 } // namespace
 
-std::vector<VisibleRenderable> FrustumCuller::collectVisible(Scene& scene,
-                                                             const Vec3& cameraPos,
-                                                             const Vec3& cameraForward,
-                                                             float fovDegrees,
-                                                             float aspect,
-                                                             float nearPlane,
-                                                             float farPlane) const {
-    std::vector<VisibleRenderable> visible;
+Mesh* resolveMesh(const MeshRenderer& renderer, const MeshLibrary* meshes) {
+    return meshes ? meshes->resolve(renderer.meshHandle, renderer.mesh) : renderer.mesh;
+}
+
+float renderableRadius(const Transform& transform) {
+    return max3(std::fabs(transform.scale.x), std::fabs(transform.scale.y), std::fabs(transform.scale.z)) * 0.9f + 0.15f;
+}
+
+float lodRadius(const Mesh& mesh, const Transform& transform) {
+    if (mesh.boundingRadius() <= 0.0f) return renderableRadius(transform);
+    return mesh.boundingRadius() * max3(std::fabs(transform.scale.x), std::fabs(transform.scale.y), std::fabs(transform.scale.z));
+}
 
+void FrustumCuller::collectVisible(Scene& scene,
+                                   const Vec3& cameraPos,
+                                   const Vec3& cameraForward,
+                                   float fovDegrees,
+                                   float aspect,
+                                   float nearPlane,
+                                   float farPlane,
+                                   VisibleList& visible) {
     const Vec3 forward = normalizeSafe(cameraForward);
     const float halfFov = std::max(1.0f, fovDegrees) * DEG2RAD * 0.5f;
     const float tanHalfFov = std::tan(halfFov);
     const float tanHalfFovH = tanHalfFov * std::max(0.1f, aspect);
 
+    const uint32_t previousFrame = m_frame++;
     scene.each<MeshRenderer>([&](EntityId id, MeshRenderer& renderer) {
         auto* transform = scene.getComponent<Transform>(id);
         if (!transform) return;
 
-        const float radius = max3(std::fabs(transform->scale.x),
-                                  std::fabs(transform->scale.y),
-                                  std::fabs(transform->scale.z)) * 0.9f + 0.15f;
+        const float radius = renderableRadius(*transform);
 
         const Vec3 toObj = transform->position - cameraPos;
         const float depth = dot(toObj, forward);
@@ -61,10 +76,21 @@ std::vector<VisibleRenderable> FrustumCuller::collectVisible(Scene& scene,
             return;
         }
 
-        visible.push_back(VisibleRenderable{id, transform, &renderer});
-    });
+        // Only meshes with a LOD chain pay for the projection and the hysteresis lookup.
+        Mesh* mesh = resolveMesh(renderer, m_meshes);
+        const std::span<const MeshLodRange> lods = mesh ? mesh->lods() : std::span<const MeshLodRange>();
+        uint32_t lod = 0;
+        if (lods.size() > 1) {
+            const float distance = std::max(std::sqrt(distSq), std::max(nearPlane, 1e-3f));
+            const float screenSize = lodRadius(*mesh, *transform) / (distance * tanHalfFov);
+            if (id >= m_lodPicks.size()) m_lodPicks.resize(size_t{id} + 1);
+            LodPick& pick = m_lodPicks[id];
+            lod = selectLod(lods, screenSize, pick.frame == previousFrame ? pick.lod : 0, kLodHysteresis);
+            pick = {m_frame, lod};
+        }
 
-    return visible;
+        visible.push_back(VisibleRenderable{id, transform, &renderer, mesh, lod});
+    });
 }
 
 } // namespace rex::gfx
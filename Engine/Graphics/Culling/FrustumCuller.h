@@ -3,25 +3,65 @@
 #include "../../Core/Components.h"
 #include "../../Core/Scene.h"
 
+#include <memory_resource>
 #include <vector>
 
 namespace rex::gfx {
 
+class MeshLibrary;
+
 struct VisibleRenderable {
     EntityId entity = 0;
     Transform* transform = nullptr;
     MeshRenderer* renderer = nullptr;
+    // Resolved at cull time; null draws nothing.
+    Mesh* mesh = nullptr;
+    uint32_t lod = 0;
 };
 
+using VisibleList = std::pmr::vector<VisibleRenderable>;
+
+// Bounding-sphere radius assumed for a renderable: unit-sized meshes scaled by the transform.
+float renderableRadius(const Transform& transform);
+
+// World-space size used to pick a LOD: the mesh's bounding radius times the largest scale axis,
+// the same measure its LOD screen sizes were built against. Falls back to renderableRadius for
+// meshes without bounds.
+float lodRadius(const Mesh& mesh, const Transform& transform);
+
+// Mesh drawn for a renderer: its streamed mesh once resident, otherwise renderer.mesh. Without a
+// library only renderer.mesh is drawn.
+Mesh* resolveMesh(const MeshRenderer& renderer, const MeshLibrary* meshes);
+
 class FrustumCuller {
 public:
-    std::vector<VisibleRenderable> collectVisible(Scene& scene,
-                                                  const Vec3& cameraPos,
-                                                  const Vec3& cameraForward,
-                                                  float fovDegrees,
-                                                  float aspect,
-                                                  float nearPlane,
-                                                  float farPlane) const;
+    // Library that MeshRenderer::meshHandle refers to; may be null.
+    void setMeshLibrary(const MeshLibrary* meshes) { m_meshes = meshes; }
+
+    // Appends to `visible`, so callers control which memory resource backs the list. Each entry
+    // carries the LOD picked from its projected size; the culler remembers the pick per entity
+    // for hysteresis (objects leaving the view start over).
+    void collectVisible(Scene& scene,
+                        const Vec3& cameraPos,
+                        const Vec3& cameraForward,
+                        float fovDegrees,
+                        float aspect,
+                        float nearPlane,
+                        float farPlane,
+                        VisibleList& visible);
+
+private:
+    // Last pick per entity (ids are dense and never reused). A pick is only used for hysteresis
+    // if it was made in the previous collectVisible, so nothing is cleared per frame and the
+    // vector only grows when a new entity id shows up.
+    struct LodPick {
+        uint32_t frame = 0;
+        uint32_t lod = 0;
+    };
+
+    const MeshLibrary* m_meshes = nullptr;
+    std::vector<LodPick> m_lodPicks;
+    uint32_t m_frame = 0;
 };
 
 } // namespace rex::gfx
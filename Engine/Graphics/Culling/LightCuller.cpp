@@ -5,17 +5,19 @@
 
 namespace rex::gfx {
 
-std::vector<RuntimeLight> LightCuller::cullForView(const std::vector<RuntimeLight>& input,
-                                                   const Vec3& viewPos,
-                                                   int maxLights) const {
-    if (maxLights <= 0) return {};
+void LightCuller::cullForView(const std::vector<RuntimeLight>& input,
+                              const Vec3& viewPos,
+                              int maxLights,
+                              LightList& out) const {
+    out.clear();
+    if (maxLights <= 0) return;
 
     struct ScoredLight {
         RuntimeLight light;
         float score = 0.0f;
     };
 
-    std::vector<ScoredLight> scored;
+    std::pmr::vector<ScoredLight> scored(out.get_allocator());
     scored.reserve(input.size());
 
     for (const auto& light : input) {
@@ -40,12 +42,10 @@ std::vector<RuntimeLight> LightCuller::cullForView(const std::vector<RuntimeLigh
         scored.resize(static_cast<size_t>(maxLights));
     }
 
-    std::vector<RuntimeLight> out;
     out.reserve(scored.size());
     for (const auto& s : scored) {
         out.push_back(s.light);
     }
-    return out;
 }
 
 } // namespace rex::gfx
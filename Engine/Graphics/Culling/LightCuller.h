@@ -2,15 +2,20 @@
 
 #include "../Lighting/Light.h"
 
+#include <memory_resource>
 #include <vector>
 
 namespace rex::gfx {
 
+using LightList = std::pmr::vector<RuntimeLight>;
+
 class LightCuller {
 public:
-    std::vector<RuntimeLight> cullForView(const std::vector<RuntimeLight>& input,
-                                          const Vec3& viewPos,
-                                          int maxLights) const;
+    // Writes into `out`; scratch storage comes from the same memory resource as `out`.
+    void cullForView(const std::vector<RuntimeLight>& input,
+                     const Vec3& viewPos,
+                     int maxLights,
+                     LightList& out) const;
 };
 
 } // namespace rex::gfx
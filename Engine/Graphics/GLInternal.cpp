@@ -48,6 +48,12 @@
 #undef glFramebufferRenderbuffer
 #undef glDeleteRenderbuffers
 #undef glDrawBuffers
+#undef glGenQueries
+#undef glDeleteQueries
+#undef glBeginQuery
+#undef glEndQuery
+#undef glGetQueryObjectiv
+#undef glGetQueryObjectui64v
 
 namespace rex::gl::internal {
     #define X(type, name) type ptr_##name = nullptr;
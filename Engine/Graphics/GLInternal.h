@@ -125,7 +125,13 @@ namespace rex::gl::internal {
         X(PFNGLRENDERBUFFERSTORAGEPROC, RenderbufferStorage) \
         X(PFNGLFRAMEBUFFERRENDERBUFFERPROC, FramebufferRenderbuffer) \
         X(PFNGLDELETERENDERBUFFERSPROC, DeleteRenderbuffers) \
-        X(PFNGLDRAWBUFFERSPROC, DrawBuffers)
+        X(PFNGLDRAWBUFFERSPROC, DrawBuffers) \
+        X(PFNGLGENQUERIESPROC, GenQueries) \
+        X(PFNGLDELETEQUERIESPROC, DeleteQueries) \
+        X(PFNGLBEGINQUERYPROC, BeginQuery) \
+        X(PFNGLENDQUERYPROC, EndQuery) \
+        X(PFNGLGETQUERYOBJECTIVPROC, GetQueryObjectiv) \
+        X(PFNGLGETQUERYOBJECTUI64VPROC, GetQueryObjectui64v)
 
     #define X(type, name) extern type ptr_##name;
     GL_POINTERS
@@ -181,6 +187,12 @@ namespace rex::gl::internal {
 #define glFramebufferRenderbuffer ::rex::gl::internal::ptr_FramebufferRenderbuffer
 #define glDeleteRenderbuffers ::rex::gl::internal::ptr_DeleteRenderbuffers
 #define glDrawBuffers ::rex::gl::internal::ptr_DrawBuffers
+#define glGenQueries ::rex::gl::internal::ptr_GenQueries
+#define glDeleteQueries ::rex::gl::internal::ptr_DeleteQueries
+#define glBeginQuery ::rex::gl::internal::ptr_BeginQuery
+#define glEndQuery ::rex::gl::internal::ptr_EndQuery
+#define glGetQueryObjectiv ::rex::gl::internal::ptr_GetQueryObjectiv
+#define glGetQueryObjectui64v ::rex::gl::internal::ptr_GetQueryObjectui64v
 
 typedef void* (*RexGLLoaderFunc)(const char* name);
 
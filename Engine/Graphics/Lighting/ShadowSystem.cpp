@@ -1,6 +1,8 @@
 #include "ShadowSystem.h"
 
-#include "../Model.h"
+#include "../Core/RenderDevice.h"
+#include "../Culling/FrustumCuller.h"
+#include "../MeshLod.h"
 
 #include <algorithm>
 #include <cmath>
@@ -10,6 +12,8 @@ namespace rex::gfx {
 namespace {
 
 constexpr float kCascadeLambda = 0.7f;
+// Shadow casters draw this many levels coarser than their cascade footprint asks for.
+constexpr uint32_t kShadowLodBias = 1;
 
 } // namespace
 
@@ -99,6 +103,7 @@ void ShadowSystem::renderCascades(Scene& scene,
     const float nearPlane = std::max(0.001f, camera.nearPlane);
     const float farPlane = std::max(nearPlane + 1.0f, camera.farPlane);
 
+    std::array<float, kMaxCascades> cascadeRadius{};
     float lastSplit = nearPlane;
     for (int i = 0; i < kMaxCascades; ++i) {
         const float p = float(i + 1) / float(kMaxCascades);
@@ -109,6 +114,7 @@ void ShadowSystem::renderCascades(Scene& scene,
 
         const float mid = 0.5f * (lastSplit + split);
         const float radius = std::max(6.0f, split * 0.75f);
+        cascadeRadius[i] = radius;
 
         Vec3 camForward = normalizeSafe({viewMatrix.m[2], viewMatrix.m[6], viewMatrix.m[10]});
         if (dot(camForward, camForward) <= 1e-6f) {
@@ -125,7 +131,7 @@ void ShadowSystem::renderCascades(Scene& scene,
         lastSplit = split;
     }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, m_shadowAtlas.id());
+    RenderDevice::bindFramebuffer(m_shadowAtlas.id());
     glDrawBuffer(GL_NONE);
     glReadBuffer(GL_NONE);
     glEnable(GL_DEPTH_TEST);
@@ -144,22 +150,28 @@ void ShadowSystem::renderCascades(Scene& scene,
         m_depthShader->setUniform("lightViewProj", m_lightViewProj[cascade]);
 
         scene.each<MeshRenderer>([&](EntityId id, MeshRenderer& mr) {
-            (void)mr;
             auto* transform = scene.getComponent<Transform>(id);
             if (!transform) return;
 
             const Mat4 model = transform->getMatrix();
             m_depthShader->setUniform("model", model);
 
-            if (mr.model) {
-                mr.model->draw();
-            } else if (mr.mesh) {
-                mr.mesh->draw();
+            // The LOD follows the caster's size in this cascade's tile (a fraction of it, like a
+            // screen size), biased coarser: depth-only silhouettes hide the missing detail.
+            Mesh* mesh = resolveMesh(mr, m_meshes);
+            if (!mesh) return;
+            const std::span<const MeshLodRange> lods = mesh->lods();
+            uint32_t lod = 0;
+            if (lods.size() > 1) {
+                const float tileSize = lodRadius(*mesh, *transform) / cascadeRadius[cascade];
+                lod = selectLod(lods, tileSize, 0, 0.0f) + kShadowLodBias;
             }
+
+            mesh->draw(lod);
         });
     }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    RenderDevice::bindFramebuffer(0);
 }
 
 } // namespace rex::gfx
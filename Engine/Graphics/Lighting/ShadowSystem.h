@@ -9,6 +9,8 @@
 
 namespace rex::gfx {
 
+class MeshLibrary;
+
 class ShadowSystem {
 public:
     static constexpr int kMaxCascades = 4;
@@ -17,6 +19,8 @@ public:
     ~ShadowSystem() = default;
 
     void ensureResources(int atlasResolution);
+    // Library that MeshRenderer::meshHandle refers to; may be null.
+    void setMeshLibrary(const MeshLibrary* meshes) { m_meshes = meshes; }
     void renderCascades(Scene& scene,
                         const Camera& camera,
                         const Mat4& viewMatrix,
@@ -36,6 +40,7 @@ private:
 
     FrameBuffer m_shadowAtlas;
     std::unique_ptr<Shader> m_depthShader;
+    const MeshLibrary* m_meshes = nullptr;
 
     int m_atlasResolution = 2048;
 
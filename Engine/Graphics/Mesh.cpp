@@ -1,24 +1,47 @@
 #include "Mesh.h"
+#include "Core/RenderDevice.h"
+#include "MeshFile.h"
+
+#include <algorithm>
 
 namespace rex {
 
-Mesh::Mesh(const std::vector<Vertex>& v, const std::vector<uint32_t>& i) : m_indexCount(i.size()) {
+Mesh::Mesh(std::span<const Vertex> v, std::span<const uint32_t> i)
+    : Mesh(VertexFormat::Float32, std::as_bytes(v), i, {}, gfx::boundingRadius(gfx::computeMeshBounds(v))) {}
+
+Mesh::Mesh(VertexFormat format, std::span<const std::byte> v, std::span<const uint32_t> i, std::span<const MeshLodRange> lods,
+           float boundingRadius)
+    : m_format(format), m_boundingRadius(boundingRadius) {
+    for (const MeshLodRange& lod : lods) {
+        if (uint64_t{lod.firstIndex} + lod.indexCount <= i.size()) m_lods.push_back(lod);
+    }
+    if (m_lods.empty()) m_lods.push_back({0, static_cast<uint32_t>(i.size()), 0.0f});
+
     glGenVertexArrays(1, &m_vao);
     glGenBuffers(1, &m_vbo);
     glGenBuffers(1, &m_ebo);
 
     glBindVertexArray(m_vao);
     glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
-    glBufferData(GL_ARRAY_BUFFER, v.size() * sizeof(Vertex), v.data(), GL_STATIC_DRAW);
+    gfx::RenderDevice::bufferData(GL_ARRAY_BUFFER, v.size_bytes(), v.data(), GL_STATIC_DRAW);
 
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ebo);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, i.size() * sizeof(uint32_t), i.data(), GL_STATIC_DRAW);
+    gfx::RenderDevice::bufferData(GL_ELEMENT_ARRAY_BUFFER, i.size_bytes(), i.data(), GL_STATIC_DRAW);
 
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
+    if (format == VertexFormat::Float32) {
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, normal));
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, texCoords));
+    } else {
+        // Normals arrive as the two octahedral components (z = 0); the vertex shader unfolds them.
+        const GLenum uvType = format == VertexFormat::Packed ? GL_UNSIGNED_SHORT : GL_HALF_FLOAT;
+        const GLboolean uvNormalized = format == VertexFormat::Packed ? GL_TRUE : GL_FALSE;
+        glVertexAttribPointer(0, 3, GL_HALF_FLOAT, GL_FALSE, sizeof(PackedVertex), (void*)offsetof(PackedVertex, position));
+        glVertexAttribPointer(1, 2, GL_SHORT, GL_TRUE, sizeof(PackedVertex), (void*)offsetof(PackedVertex, normal));
+        glVertexAttribPointer(2, 2, uvType, uvNormalized, sizeof(PackedVertex), (void*)offsetof(PackedVertex, texCoords));
+    }
     glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, normal));
     glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, texCoords));
     glEnableVertexAttribArray(2);
 
     glBindVertexArray(0);
@@ -30,10 +53,12 @@ Mesh::~Mesh() {
     glDeleteBuffers(1, &m_ebo);
 }
 
-void Mesh::draw() const {
-    glBindVertexArray(m_vao);
-    glDrawElements(GL_TRIANGLES, m_indexCount, GL_UNSIGNED_INT, 0);
-    glBindVertexArray(0);
+void Mesh::draw(uint32_t lod) const {
+    const MeshLodRange& range = m_lods[std::min<size_t>(lod, m_lods.size() - 1)];
+    gfx::RenderDevice::bindVertexArray(m_vao);
+    gfx::RenderDevice::drawElements(GL_TRIANGLES, static_cast<int>(range.indexCount), GL_UNSIGNED_INT,
+                                    std::size_t{range.firstIndex} * sizeof(uint32_t));
+    gfx::RenderDevice::bindVertexArray(0);
 }
 
 Mesh* Mesh::createCube() {
@@ -1,28 +1,53 @@
 #pragma once
 #include "GLInternal.h"
+#include "VertexFormat.h"
 #include "../Core/RexMath.h"
+#include <cstddef>
+#include <span>
 #include <vector>
 
 namespace rex {
 
-struct Vertex {
-    Vec3 position;
-    Vec3 normal;
-    Vec2 texCoords;
+// Index range drawn for one level of detail. A level may be used once the object's projected
+// size (bounding-sphere diameter over viewport height) drops below screenSize; LOD 0 ignores it.
+struct MeshLodRange {
+    uint32_t firstIndex = 0;
+    uint32_t indexCount = 0;
+    float screenSize = 0.0f;
 };
 
 class Mesh {
 public:
-    Mesh(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices);
+    // Uploads straight from the given memory (a vector, or a mapped .rexmesh file).
+    Mesh(std::span<const Vertex> vertices, std::span<const uint32_t> indices);
+    // Raw vertex stream in the given layout (vertexStride(format) bytes per vertex). Every LOD
+    // indexes the same vertex buffer; without lods the whole index buffer is LOD 0.
+    // boundingRadius is half the bounding-box diagonal (see gfx::boundingRadius); 0 if unknown.
+    Mesh(VertexFormat format,
+         std::span<const std::byte> vertices,
+         std::span<const uint32_t> indices,
+         std::span<const MeshLodRange> lods = {},
+         float boundingRadius = 0.0f);
     ~Mesh();
 
-    void draw() const;
+    // Levels past the last one draw the coarsest.
+    void draw(uint32_t lod = 0) const;
+
+    uint32_t lodCount() const { return static_cast<uint32_t>(m_lods.size()); }
+    std::span<const MeshLodRange> lods() const { return m_lods; }
+    // Mesh-space size the LOD screenSize thresholds are relative to; 0 if unknown.
+    float boundingRadius() const { return m_boundingRadius; }
+
+    // Packed formats carry octahedral normals; shaders reading aNormal must decode them.
+    VertexFormat vertexFormat() const { return m_format; }
 
     static Mesh* createCube();
 
 private:
     uint32_t m_vao, m_vbo, m_ebo;
-    uint32_t m_indexCount;
+    std::vector<MeshLodRange> m_lods;
+    VertexFormat m_format = VertexFormat::Float32;
+    float m_boundingRadius = 0.0f;
 };
 
 }
@@ -0,0 +1,199 @@
+#include "MeshFile.h"
+#include "../Core/Logger.h"
+#include "../Core/Platform/FileSystem.h"
+#include "../Core/Serialization/BinaryStream.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <system_error>
+
+namespace rex::gfx {
+
+namespace {
+
+// Section [offset, offset + count * elementSize) lies inside the file and is aligned for T.
+template <typename T>
+bool sectionFits(uint64_t offset, uint64_t count, uint64_t fileBytes) {
+    if (offset % alignof(T) != 0 || offset > fileBytes) return false;
+    return count <= (fileBytes - offset) / sizeof(T);
+}
+
+template <typename T>
+std::span<const T> section(std::span<const std::byte> bytes, uint64_t offset, uint32_t count) {
+    return {reinterpret_cast<const T*>(bytes.data() + offset), count};
+}
+
+bool validRanges(std::span<const MeshSubmesh> submeshes, std::span<const MeshLod> lods, uint64_t indexCount) {
+    for (const MeshSubmesh& submesh : submeshes) {
+        if (uint64_t{submesh.firstIndex} + submesh.indexCount > indexCount) return false;
+    }
+    for (const MeshLod& lod : lods) {
+        if (uint64_t{lod.firstSubmesh} + lod.submeshCount > submeshes.size()) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+std::optional<MeshFileView> MeshFileView::parse(std::span<const std::byte> bytes) {
+    if (bytes.size() < sizeof(MeshFileHeader) ||
+        reinterpret_cast<uintptr_t>(bytes.data()) % alignof(MeshFileHeader) != 0) {
+        return std::nullopt;
+    }
+    const auto* header = reinterpret_cast<const MeshFileHeader*>(bytes.data());
+    if (header->magic != kMeshFileMagic || header->endianTag != kMeshFileEndianTag) return std::nullopt;
+    const bool knownFormat = isValidVertexFormat(header->vertexFormat) &&
+                             (header->version == kMeshFileVersion || header->vertexFormat == 0);
+    if (header->version == 0 || header->version > kMeshFileVersion || !knownFormat ||
+        header->vertexStride != vertexStride(static_cast<VertexFormat>(header->vertexFormat))) {
+        Logger::error("Mesh file: unsupported version {} (stride {})", header->version, header->vertexStride);
+        return std::nullopt;
+    }
+    // Both vertex layouts are whole multiples of the 16-byte PackedVertex; a Float32 section is
+    // viewed as Vertex, so it also needs Vertex alignment.
+    const bool float32 = header->vertexFormat == static_cast<uint32_t>(VertexFormat::Float32);
+    const uint64_t vertexUnits = uint64_t{header->vertexCount} * (header->vertexStride / sizeof(PackedVertex));
+    if (header->fileBytes != bytes.size() ||
+        !sectionFits<PackedVertex>(header->vertexOffset, vertexUnits, header->fileBytes) ||
+        (float32 && header->vertexOffset % alignof(Vertex) != 0) ||
+        !sectionFits<uint32_t>(header->indexOffset, header->indexCount, header->fileBytes) ||
+        !sectionFits<MeshSubmesh>(header->submeshOffset, header->submeshCount, header->fileBytes) ||
+        !sectionFits<MeshLod>(header->lodOffset, header->lodCount, header->fileBytes)) {
+        Logger::error("Mesh file: truncated or corrupt section table");
+        return std::nullopt;
+    }
+
+    MeshFileView view;
+    view.m_header = header;
+    view.m_vertexBytes = bytes.subspan(header->vertexOffset, size_t{header->vertexCount} * header->vertexStride);
+    if (float32) {
+        view.m_vertices = section<Vertex>(bytes, header->vertexOffset, header->vertexCount);
+    } else {
+        view.m_packedVertices = section<PackedVertex>(bytes, header->vertexOffset, header->vertexCount);
+    }
+    view.m_indices = section<uint32_t>(bytes, header->indexOffset, header->indexCount);
+    view.m_submeshes = section<MeshSubmesh>(bytes, header->submeshOffset, header->submeshCount);
+    view.m_lods = section<MeshLod>(bytes, header->lodOffset, header->lodCount);
+    // Index values are not scanned here: that would touch every page of the mapping. An
+    // out-of-range index only reads the wrong vertex on the GPU, it cannot fault the process.
+    if (view.m_lods.empty() || !validRanges(view.m_submeshes, view.m_lods, header->indexCount)) {
+        Logger::error("Mesh file: submesh or LOD range out of bounds");
+        return std::nullopt;
+    }
+    return view;
+}
+
+std::span<const MeshSubmesh> MeshFileView::submeshes(size_t lod) const {
+    if (lod >= m_lods.size()) return {};
+    return m_submeshes.subspan(m_lods[lod].firstSubmesh, m_lods[lod].submeshCount);
+}
+
+MeshBounds computeMeshBounds(std::span<const Vertex> vertices) {
+    MeshBounds bounds{};
+    if (vertices.empty()) return bounds;
+    bounds.min = bounds.max = vertices.front().position;
+    for (const Vertex& v : vertices) {
+        bounds.min = {std::min(bounds.min.x, v.position.x), std::min(bounds.min.y, v.position.y),
+                      std::min(bounds.min.z, v.position.z)};
+        bounds.max = {std::max(bounds.max.x, v.position.x), std::max(bounds.max.y, v.position.y),
+                      std::max(bounds.max.z, v.position.z)};
+    }
+    return bounds;
+}
+
+MeshBounds computeMeshBounds(std::span<const PackedVertex> vertices) {
+    MeshBounds bounds{};
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        const Vec3 p{halfToFloat(vertices[i].position[0]), halfToFloat(vertices[i].position[1]),
+                     halfToFloat(vertices[i].position[2])};
+        if (i == 0) {
+            bounds.min = bounds.max = p;
+            continue;
+        }
+        bounds.min = {std::min(bounds.min.x, p.x), std::min(bounds.min.y, p.y), std::min(bounds.min.z, p.z)};
+        bounds.max = {std::max(bounds.max.x, p.x), std::max(bounds.max.y, p.y), std::max(bounds.max.z, p.z)};
+    }
+    return bounds;
+}
+
+float boundingRadius(const MeshBounds& bounds) {
+    const Vec3 extent = bounds.max - bounds.min;
+    return 0.5f * std::sqrt(dot(extent, extent));
+}
+
+std::optional<std::vector<std::byte>> buildMeshFile(const MeshFileContents& contents) {
+    const bool packed = !contents.packedVertices.empty();
+    const VertexFormat format = packed ? contents.packedFormat : VertexFormat::Float32;
+    const std::span<const std::byte> vertexBytes =
+        packed ? std::as_bytes(contents.packedVertices) : std::as_bytes(contents.vertices);
+    const size_t vertexCount = packed ? contents.packedVertices.size() : contents.vertices.size();
+    constexpr uint64_t kMaxCount = std::numeric_limits<uint32_t>::max();
+    if (vertexCount > kMaxCount || contents.indices.size() > kMaxCount) return std::nullopt;
+    if (packed && format == VertexFormat::Float32) return std::nullopt;
+
+    const MeshSubmesh wholeMesh{0, static_cast<uint32_t>(contents.indices.size()), 0, 0};
+    const std::span<const MeshSubmesh> submeshes =
+        contents.submeshes.empty() ? std::span<const MeshSubmesh>(&wholeMesh, 1) : contents.submeshes;
+    const MeshLod baseLod{0, static_cast<uint32_t>(submeshes.size()), 0.0f, 0.0f};
+    const std::span<const MeshLod> lods = contents.lods.empty() ? std::span<const MeshLod>(&baseLod, 1) : contents.lods;
+
+    if (!validRanges(submeshes, lods, contents.indices.size())) return std::nullopt;
+    for (const uint32_t index : contents.indices) {
+        if (index >= vertexCount) return std::nullopt;
+    }
+
+    MeshFileHeader header{};
+    header.vertexFormat = static_cast<uint32_t>(format);
+    header.vertexStride = static_cast<uint32_t>(vertexStride(format));
+    header.vertexCount = static_cast<uint32_t>(vertexCount);
+    header.indexCount = static_cast<uint32_t>(contents.indices.size());
+    header.submeshCount = static_cast<uint32_t>(submeshes.size());
+    header.lodCount = static_cast<uint32_t>(lods.size());
+    header.bounds = packed ? computeMeshBounds(contents.packedVertices) : computeMeshBounds(contents.vertices);
+
+    core::serialization::BinaryWriter out;
+    out.reserve(kMeshFileAlignment * 5 + vertexBytes.size() + contents.indices.size_bytes() +
+                submeshes.size_bytes() + lods.size_bytes());
+    out.write(header);
+    const auto writeSection = [&](uint64_t& offset, const void* data, size_t size) {
+        out.align(kMeshFileAlignment);
+        offset = out.size();
+        out.writeBytes(data, size);
+    };
+    writeSection(header.vertexOffset, vertexBytes.data(), vertexBytes.size());
+    writeSection(header.indexOffset, contents.indices.data(), contents.indices.size_bytes());
+    writeSection(header.submeshOffset, submeshes.data(), submeshes.size_bytes());
+    writeSection(header.lodOffset, lods.data(), lods.size_bytes());
+    header.fileBytes = out.size();
+    out.patch(0, header);
+    return out.take();
+}
+
+bool saveMeshFile(const std::string& path, const MeshFileContents& contents) {
+    const auto bytes = buildMeshFile(contents);
+    if (!bytes) {
+        Logger::error("Mesh file: invalid contents for {}", path);
+        return false;
+    }
+    // A reader mapping the old file keeps its pages; the new one appears atomically.
+    const std::filesystem::path target(path);
+    std::filesystem::path temp = target;
+    temp += ".tmp";
+    if (!core::platform::FileSystem::writeBinary(temp, *bytes)) {
+        Logger::error("Failed to write mesh file: {}", temp.string());
+        return false;
+    }
+    std::error_code ec;
+    std::filesystem::rename(temp, target, ec);
+    if (ec) {
+        Logger::error("Failed to publish mesh file {}: {}", path, ec.message());
+        std::filesystem::remove(temp, ec);
+        return false;
+    }
+    return true;
+}
+
+}
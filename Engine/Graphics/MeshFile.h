@@ -0,0 +1,133 @@
+#pragma once
+
+#include "Mesh.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace rex::gfx {
+
+// .rexmesh: cooked mesh container laid out so a read-only mapping of the file can be used
+// in place. Every section starts on a kMeshFileAlignment boundary, and the vertex and index
+// streams are stored exactly as the GPU consumes them (interleaved vertices, uint32 indices).
+//
+//   MeshFileHeader
+//   vertex[vertexCount]          (vertexOffset; Vertex or PackedVertex per vertexFormat)
+//   uint32_t[indexCount]         (indexOffset)
+//   MeshSubmesh[submeshCount]    (submeshOffset)
+//   MeshLod[lodCount]            (lodOffset)
+//
+// All LODs share the vertex stream; each LOD owns a contiguous run of submeshes, and each
+// submesh is a range of the index stream. LOD 0 is the full-detail mesh.
+constexpr std::array<char, 8> kMeshFileMagic{'R', 'E', 'X', 'M', 'E', 'S', 'H', '\0'};
+// Version 2 added vertexFormat (version 1 files are always Float32).
+constexpr uint32_t kMeshFileVersion = 2;
+constexpr uint32_t kMeshFileEndianTag = 0x01020304u;
+constexpr size_t kMeshFileAlignment = 64;
+constexpr const char* kMeshFileExtension = ".rexmesh";
+
+struct MeshSubmesh {
+    uint32_t firstIndex = 0;
+    uint32_t indexCount = 0;
+    uint32_t materialIndex = 0;
+    uint32_t reserved = 0;
+};
+
+struct MeshLod {
+    uint32_t firstSubmesh = 0;
+    uint32_t submeshCount = 0;
+    // Smallest projected size (fraction of viewport height) at which this LOD is used.
+    float screenSize = 0.0f;
+    // Simplification error relative to LOD 0, in object-space units.
+    float error = 0.0f;
+};
+
+struct MeshBounds {
+    Vec3 min{0.0f, 0.0f, 0.0f};
+    Vec3 max{0.0f, 0.0f, 0.0f};
+};
+
+struct MeshFileHeader {
+    std::array<char, 8> magic = kMeshFileMagic;
+    uint32_t version = kMeshFileVersion;
+    uint32_t endianTag = kMeshFileEndianTag;
+    uint32_t vertexStride = sizeof(Vertex);
+    uint32_t vertexCount = 0;
+    uint32_t indexCount = 0;
+    uint32_t submeshCount = 0;
+    uint32_t lodCount = 0;
+    uint32_t vertexFormat = static_cast<uint32_t>(VertexFormat::Float32);
+    MeshBounds bounds{};
+    uint64_t vertexOffset = 0;
+    uint64_t indexOffset = 0;
+    uint64_t submeshOffset = 0;
+    uint64_t lodOffset = 0;
+    // Whole file size; a truncated file is rejected before any section is touched.
+    uint64_t fileBytes = 0;
+};
+
+static_assert(std::is_trivially_copyable_v<Vertex> && sizeof(Vertex) == 32);
+static_assert(std::is_trivially_copyable_v<MeshFileHeader>);
+
+// Non-owning, validated view of a .rexmesh image. The spans point into the buffer passed to
+// parse(), which must outlive the view and be at least 8-byte aligned (any mmap base or heap
+// allocation qualifies).
+class MeshFileView {
+public:
+    static std::optional<MeshFileView> parse(std::span<const std::byte> bytes);
+
+    const MeshFileHeader& header() const { return *m_header; }
+    const MeshBounds& bounds() const { return m_header->bounds; }
+    VertexFormat vertexFormat() const { return static_cast<VertexFormat>(m_header->vertexFormat); }
+    // Raw vertex stream in vertexFormat(); what the GPU upload consumes.
+    std::span<const std::byte> vertexBytes() const { return m_vertexBytes; }
+    // Typed views; empty unless the file uses that layout.
+    std::span<const Vertex> vertices() const { return m_vertices; }
+    std::span<const PackedVertex> packedVertices() const { return m_packedVertices; }
+    std::span<const uint32_t> indices() const { return m_indices; }
+    std::span<const MeshSubmesh> submeshes() const { return m_submeshes; }
+    std::span<const MeshLod> lods() const { return m_lods; }
+    // Submesh range of one LOD; empty when lod is out of range.
+    std::span<const MeshSubmesh> submeshes(size_t lod) const;
+
+private:
+    const MeshFileHeader* m_header = nullptr;
+    std::span<const std::byte> m_vertexBytes;
+    std::span<const Vertex> m_vertices;
+    std::span<const PackedVertex> m_packedVertices;
+    std::span<const uint32_t> m_indices;
+    std::span<const MeshSubmesh> m_submeshes;
+    std::span<const MeshLod> m_lods;
+};
+
+struct MeshFileContents {
+    // Float32 vertices; ignored when packedVertices is set.
+    std::span<const Vertex> vertices;
+    std::span<const uint32_t> indices;
+    // Empty: one submesh covering every index.
+    std::span<const MeshSubmesh> submeshes;
+    // Empty: a single LOD 0 over all submeshes.
+    std::span<const MeshLod> lods;
+    // Quantized stream (see quantizeVertices) and its layout.
+    std::span<const PackedVertex> packedVertices = {};
+    VertexFormat packedFormat = VertexFormat::Packed;
+};
+
+MeshBounds computeMeshBounds(std::span<const Vertex> vertices);
+MeshBounds computeMeshBounds(std::span<const PackedVertex> vertices);
+// Half the box diagonal: the size MeshLod errors (and so LOD screen sizes) are relative to.
+float boundingRadius(const MeshBounds& bounds);
+
+// Builds a .rexmesh image in memory. Index ranges are validated against the vertex count.
+std::optional<std::vector<std::byte>> buildMeshFile(const MeshFileContents& contents);
+
+// Writes to a temporary file next to path and renames it into place.
+bool saveMeshFile(const std::string& path, const MeshFileContents& contents);
+
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "../Core/Resource/Handle.h"
+
+namespace rex::gfx {
+
+// Reference to a mesh streamed by MeshLibrary. Kept in its own header so components can hold one
+// without pulling in the loader.
+struct MeshTag {};
+using MeshHandle = core::resource::StrongHandle<MeshTag>;
+
+} // namespace rex::gfx
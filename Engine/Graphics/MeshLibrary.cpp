@@ -0,0 +1,95 @@
+#include "MeshLibrary.h"
+#include "MeshLod.h"
+#include "../Core/Logger.h"
+
+#include <algorithm>
+#include <memory>
+
+namespace rex::gfx {
+
+MeshLibrary::MeshLibrary(core::job::ThreadPool& jobs,
+                         core::resource::ResourceManagerConfig config,
+                         core::event::AsyncEventQueue* events)
+    : m_manager(
+          jobs,
+          &MeshLibrary::load,
+          [](MeshData& data) {
+              return std::make_unique<Mesh>(data.vertexFormat(), data.vertexBytes(), data.indexStream(),
+                                            makeLodRanges(data.submeshStream(), data.lodStream()),
+                                            boundingRadius(data.meshBounds()));
+          },
+          &MeshLibrary::gpuBytes,
+          config,
+          events) {}
+
+std::optional<MeshData> MeshLibrary::load(const std::string& path) {
+    return path.ends_with(kMeshFileExtension) ? loadMeshFile(path) : loadObj(path, nullptr);
+}
+
+std::optional<MeshData> MeshLibrary::loadObj(const std::string& path, ObjImportStats* stats, const ObjImportOptions& options) {
+    auto mesh = ObjImporter::importFile(path, options, stats);
+    if (!mesh || mesh->indices.empty()) return std::nullopt;
+
+    MeshData data;
+    data.vertices = std::move(mesh->vertices);
+    data.indices = std::move(mesh->indices);
+    data.bounds = computeMeshBounds(data.vertices);
+    // Material names are not kept in the cooked mesh; submeshes refer to them by first-use order.
+    std::vector<std::string> materials;
+    for (const ObjSubmesh& submesh : mesh->submeshes) {
+        auto it = std::find(materials.begin(), materials.end(), submesh.material);
+        if (it == materials.end()) it = materials.insert(materials.end(), submesh.material);
+        data.submeshes.push_back({submesh.firstIndex, submesh.indexCount, static_cast<uint32_t>(it - materials.begin()), 0});
+    }
+    return data;
+}
+
+std::optional<MeshData> MeshLibrary::loadMeshFile(const std::string& path) {
+    MeshData data;
+    data.file = core::platform::VirtualFileSystem::instance().open(path);
+    if (!data.file.valid()) {
+        Logger::error("Failed to open mesh file: {}", path);
+        return std::nullopt;
+    }
+    data.view = MeshFileView::parse(data.file.bytes());
+    if (!data.view || data.view->indices().empty()) {
+        Logger::error("Failed to load mesh file: {}", path);
+        return std::nullopt;
+    }
+    // Fault the pages in here rather than inside the upload on the GL thread.
+    data.file.prefetch();
+    return data;
+}
+
+size_t MeshLibrary::gpuBytes(const MeshData& data) {
+    return data.vertexBytes().size() + data.indexStream().size_bytes();
+}
+
+std::vector<std::byte> MeshLibrary::encode(const MeshData& data) {
+    MeshFileContents contents{data.vertexStream(), data.indexStream(), data.submeshStream(), data.lodStream()};
+    if (data.vertexFormat() != VertexFormat::Float32) {
+        contents.packedVertices = data.view->packedVertices();
+        contents.packedFormat = data.vertexFormat();
+    }
+    auto bytes = buildMeshFile(contents);
+    return bytes ? std::move(*bytes) : std::vector<std::byte>{};
+}
+
+std::optional<MeshData> MeshLibrary::decode(std::span<const std::byte> bytes) {
+    const auto view = MeshFileView::parse(bytes);
+    if (!view) return std::nullopt;
+    MeshData data;
+    if (view->vertexFormat() == VertexFormat::Float32) {
+        data.vertices.assign(view->vertices().begin(), view->vertices().end());
+    } else {
+        data.vertices.reserve(view->packedVertices().size());
+        for (const PackedVertex& v : view->packedVertices()) data.vertices.push_back(unpackVertex(v, view->vertexFormat()));
+    }
+    data.indices.assign(view->indices().begin(), view->indices().end());
+    data.submeshes.assign(view->submeshes().begin(), view->submeshes().end());
+    data.lods.assign(view->lods().begin(), view->lods().end());
+    data.bounds = view->bounds();
+    return data;
+}
+
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "Mesh.h"
+#include "MeshFile.h"
+#include "MeshHandle.h"
+#include "ObjImporter.h"
+#include "../Core/Platform/Vfs.h"
+#include "../Core/Resource/AssetPath.h"
+#include "../Core/Resource/ResourceManager.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace rex::gfx {
+
+// CPU-side mesh produced on a worker thread and consumed by the GL upload. OBJ sources fill the
+// vectors; .rexmesh sources keep the VFS file open and the streams point into it (the mapping
+// itself for loose files and uncompressed pak entries).
+struct MeshData {
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    // Index ranges of every LOD, grouped per level by lods; empty means one range over every
+    // index (and no LOD chain).
+    std::vector<MeshSubmesh> submeshes;
+    std::vector<MeshLod> lods;
+    // Bounds of vertices; a .rexmesh carries its own in the header.
+    MeshBounds bounds{};
+    core::platform::VfsFile file;
+    std::optional<MeshFileView> view;
+
+    // Float32 vertices; empty for a quantized .rexmesh (see vertexBytes()).
+    std::span<const Vertex> vertexStream() const { return view ? view->vertices() : std::span<const Vertex>(vertices); }
+    VertexFormat vertexFormat() const { return view ? view->vertexFormat() : VertexFormat::Float32; }
+    std::span<const std::byte> vertexBytes() const { return view ? view->vertexBytes() : std::as_bytes(std::span<const Vertex>(vertices)); }
+    std::span<const uint32_t> indexStream() const { return view ? view->indices() : std::span<const uint32_t>(indices); }
+    std::span<const MeshSubmesh> submeshStream() const { return view ? view->submeshes() : std::span<const MeshSubmesh>(submeshes); }
+    std::span<const MeshLod> lodStream() const { return view ? view->lods() : std::span<const MeshLod>(lods); }
+    const MeshBounds& meshBounds() const { return view ? view->bounds() : bounds; }
+};
+
+// Streams meshes: .rexmesh files are mapped (OBJ files parsed) on the job system, GPU buffers are created
+// by processUploads() on the GL thread within the per-frame upload budget, and unreferenced
+// meshes are evicted LRU-first once the resident budget is exceeded.
+class MeshLibrary {
+public:
+    MeshLibrary(core::job::ThreadPool& jobs,
+                core::resource::ResourceManagerConfig config = {},
+                core::event::AsyncEventQueue* events = nullptr);
+
+    // Also records path under its AssetId so scenes can save the reference (assetPaths()).
+    MeshHandle acquire(const std::string& path) {
+        {
+            std::lock_guard<std::mutex> lock(m_assetMutex);
+            m_assets.add(path);
+        }
+        return m_manager.acquire(path);
+    }
+    // Re-acquires a saved reference; null if paths does not know the id.
+    MeshHandle acquire(core::resource::AssetId id, const core::resource::AssetPathTable& paths) {
+        const std::string* path = paths.find(id);
+        return path ? acquire(*path) : MeshHandle{};
+    }
+    void retain(MeshHandle handle) { m_manager.retain(handle); }
+    void release(MeshHandle handle) { m_manager.release(handle); }
+
+    // Hot reload: swaps the mesh behind every handle to path (the same string given to acquire) at
+    // the next processUploads. False if nothing has acquired path.
+    bool replace(const std::string& path, MeshData data) { return m_manager.replace(path, std::move(data)); }
+
+    // Null until the upload has happened.
+    Mesh* get(MeshHandle handle) const { return m_manager.get(handle); }
+    // The streamed mesh once resident, otherwise fallback (a placeholder, or null).
+    Mesh* resolve(MeshHandle handle, Mesh* fallback) const {
+        Mesh* mesh = handle ? get(handle) : nullptr;
+        return mesh ? mesh : fallback;
+    }
+    core::resource::ResourceState state(MeshHandle handle) const { return m_manager.state(handle); }
+
+    // GL thread only, once per frame before rendering.
+    size_t processUploads() { return m_manager.processUploads(); }
+    core::resource::ResourceManagerStats stats() const { return m_manager.stats(); }
+    // Every path acquired so far, keyed by AssetId; pass to SceneSerializer::save.
+    core::resource::AssetPathTable assetPaths() const {
+        std::lock_guard<std::mutex> lock(m_assetMutex);
+        return m_assets;
+    }
+
+    // Picks the loader by extension.
+    static std::optional<MeshData> load(const std::string& path);
+    // Parses on the calling thread by default: load() and the importers already run on job
+    // threads. Pass a pool (or a thread count) in options to split the parse.
+    static std::optional<MeshData> loadObj(const std::string& path, ObjImportStats* stats = nullptr,
+                                           const ObjImportOptions& options = {.threadCount = 1});
+    // Opens the file through the VFS and validates it; no vertex or index data is copied unless
+    // the pak entry is compressed.
+    static std::optional<MeshData> loadMeshFile(const std::string& path);
+    static size_t gpuBytes(const MeshData& data);
+
+    // .rexmesh image of the mesh, used as the cooked form in the import derived-data cache.
+    static std::vector<std::byte> encode(const MeshData& data);
+    // Copies out of bytes, which need not outlive the result. Quantized vertices are expanded.
+    static std::optional<MeshData> decode(std::span<const std::byte> bytes);
+
+private:
+    core::resource::ResourceManager<MeshTag, MeshData, Mesh> m_manager;
+    mutable std::mutex m_assetMutex;
+    core::resource::AssetPathTable m_assets;
+};
+
+}
@@ -0,0 +1,458 @@
+#include "MeshLod.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <unordered_map>
+
+namespace rex::gfx {
+
+namespace {
+
+constexpr uint32_t kNone = std::numeric_limits<uint32_t>::max();
+
+// Symmetric 4x4 plane quadric (Garland-Heckbert) plus the accumulated area weight, so
+// eval() / weight is a mean squared distance.
+struct Quadric {
+    double a2 = 0, b2 = 0, c2 = 0, d2 = 0;
+    double ab = 0, ac = 0, ad = 0, bc = 0, bd = 0, cd = 0;
+    double weight = 0;
+
+    void addPlane(double a, double b, double c, double d, double w) {
+        a2 += a * a * w; b2 += b * b * w; c2 += c * c * w; d2 += d * d * w;
+        ab += a * b * w; ac += a * c * w; ad += a * d * w;
+        bc += b * c * w; bd += b * d * w; cd += c * d * w;
+        weight += w;
+    }
+
+    void add(const Quadric& q) {
+        a2 += q.a2; b2 += q.b2; c2 += q.c2; d2 += q.d2;
+        ab += q.ab; ac += q.ac; ad += q.ad;
+        bc += q.bc; bd += q.bd; cd += q.cd;
+        weight += q.weight;
+    }
+
+    double eval(const Vec3& p) const {
+        const double x = p.x, y = p.y, z = p.z;
+        return a2 * x * x + b2 * y * y + c2 * z * z + 2.0 * (ab * x * y + ac * x * z + bc * y * z) +
+               2.0 * (ad * x + bd * y + cd * z) + d2;
+    }
+};
+
+double collapseCost(const Quadric& from, const Quadric& to, const Vec3& position) {
+    Quadric merged = from;
+    merged.add(to);
+    return merged.weight > 0.0 ? std::max(0.0, merged.eval(position) / merged.weight) : 0.0;
+}
+
+struct PositionKey {
+    uint32_t x, y, z;
+    bool operator==(const PositionKey&) const = default;
+};
+
+struct PositionKeyHash {
+    size_t operator()(const PositionKey& k) const {
+        return (k.x * 73856093u) ^ (k.y * 19349663u) ^ (k.z * 83492791u);
+    }
+};
+
+struct Collapse {
+    uint32_t from = 0;
+    uint32_t to = 0;
+    double cost = 0.0;
+};
+
+// Simplification state for one index range. Corners refer to local wedges (distinct vertex
+// records); topology and quadrics live on positions, which group the wedges.
+class Simplifier {
+public:
+    Simplifier(std::span<const Vertex> vertices, std::span<const uint32_t> indices) {
+        std::vector<uint32_t> local(vertices.size(), kNone);
+        std::unordered_map<PositionKey, uint32_t, PositionKeyHash> positionIds;
+        Vec3 lo{0, 0, 0};
+        Vec3 hi{0, 0, 0};
+        for (const uint32_t index : indices) {
+            if (local[index] != kNone) continue;
+            local[index] = static_cast<uint32_t>(m_globalWedge.size());
+            m_globalWedge.push_back(index);
+            const Vec3& p = vertices[index].position;
+            // Adding zero folds -0 into +0 so both weld.
+            const PositionKey key{std::bit_cast<uint32_t>(p.x + 0.0f), std::bit_cast<uint32_t>(p.y + 0.0f),
+                                  std::bit_cast<uint32_t>(p.z + 0.0f)};
+            const auto [it, inserted] = positionIds.try_emplace(key, static_cast<uint32_t>(m_positions.size()));
+            if (inserted) {
+                lo = m_positions.empty() ? p : Vec3{std::min(lo.x, p.x), std::min(lo.y, p.y), std::min(lo.z, p.z)};
+                hi = m_positions.empty() ? p : Vec3{std::max(hi.x, p.x), std::max(hi.y, p.y), std::max(hi.z, p.z)};
+                m_positions.push_back(p);
+            }
+            m_wedgePosition.push_back(it->second);
+        }
+
+        // Work in a unit-diagonal frame so errors are relative to the range's size.
+        const Vec3 extent = hi - lo;
+        const float diagonal = std::sqrt(dot(extent, extent));
+        const float scale = diagonal > 0.0f ? 1.0f / diagonal : 1.0f;
+        for (Vec3& p : m_positions) p = (p - lo) * scale;
+
+        m_quadrics.resize(m_positions.size());
+        for (size_t t = 0; t + 2 < indices.size(); t += 3) {
+            const uint32_t a = local[indices[t]];
+            const uint32_t b = local[indices[t + 1]];
+            const uint32_t c = local[indices[t + 2]];
+            const uint32_t pa = m_wedgePosition[a];
+            const uint32_t pb = m_wedgePosition[b];
+            const uint32_t pc = m_wedgePosition[c];
+            // Triangles that are degenerate after welding cover no area; drop them up front.
+            if (pa == pb || pb == pc || pa == pc) continue;
+            m_corners.insert(m_corners.end(), {a, b, c});
+
+            const Vec3 n = cross(m_positions[pb] - m_positions[pa], m_positions[pc] - m_positions[pa]);
+            const double length = std::sqrt(double{dot(n, n)});
+            if (length <= 0.0) continue;
+            const double nx = n.x / length, ny = n.y / length, nz = n.z / length;
+            const double d = -(nx * m_positions[pa].x + ny * m_positions[pa].y + nz * m_positions[pa].z);
+            const double area = length * 0.5;
+            for (const uint32_t p : {pa, pb, pc}) m_quadrics[p].addPlane(nx, ny, nz, d, area);
+        }
+        m_alive.assign(m_corners.size() / 3, 1);
+        m_liveTriangles = m_alive.size();
+    }
+
+    size_t liveIndexCount() const { return m_liveTriangles * 3; }
+
+    // Collapses until at most targetIndexCount indices remain or nothing under maxCost is
+    // left. Can be called again with a smaller target to continue from the current state;
+    // the returned error covers every collapse made so far.
+    double simplify(size_t targetIndexCount, double maxCost) {
+        const size_t targetTriangles = targetIndexCount / 3;
+        while (m_liveTriangles > targetTriangles) {
+            buildAdjacency();
+            collectCandidates(maxCost);
+            if (m_candidates.empty()) break;
+
+            // Take roughly as many of the cheapest collapses as the target still needs; each
+            // removes about two triangles. Endpoints touched this pass wait for the next one so
+            // every collapse is costed on current quadrics. Cheap candidates that keep failing
+            // the seam or flip checks would stall the passes, so a pass goes past the cost limit
+            // until it has made a minimum number of collapses (a share of the mesh, not of the
+            // remaining goal, so the last passes still make progress).
+            const size_t wanted = (m_liveTriangles - targetTriangles + 1) / 2;
+            const size_t minimum = std::clamp<size_t>(m_liveTriangles / 64, 1, wanted);
+            // Only the head of the list is usually visited, so order just that much.
+            const auto byCost = [](const Collapse& x, const Collapse& y) { return x.cost < y.cost; };
+            const auto limit = m_candidates.begin() + static_cast<std::ptrdiff_t>(std::min(m_candidates.size() - 1, wanted));
+            std::nth_element(m_candidates.begin(), limit, m_candidates.end(), byCost);
+            std::sort(m_candidates.begin(), limit, byCost);
+            const double passLimit = limit->cost;
+
+            m_touched.assign(m_positions.size(), 0);
+            size_t collapsed = 0;
+            for (auto it = m_candidates.begin(); it != m_candidates.end(); ++it) {
+                if ((it->cost > passLimit && collapsed >= minimum) || m_liveTriangles <= targetTriangles) break;
+                if (it == limit + 1) std::sort(it, m_candidates.end(), byCost);
+                if (m_touched[it->from] || m_touched[it->to] || !tryCollapse(it->from, it->to)) continue;
+                m_touched[it->from] = m_touched[it->to] = 1;
+                m_error = std::max(m_error, it->cost);
+                ++collapsed;
+            }
+            if (collapsed == 0) break;
+        }
+        return std::sqrt(m_error);
+    }
+
+    void emit(std::vector<uint32_t>& out) const {
+        for (size_t t = 0; t < m_alive.size(); ++t) {
+            if (!m_alive[t]) continue;
+            for (size_t k = 0; k < 3; ++k) out.push_back(m_globalWedge[m_corners[t * 3 + k]]);
+        }
+    }
+
+private:
+    uint32_t positionOf(size_t corner) const { return m_wedgePosition[m_corners[corner]]; }
+
+    void buildAdjacency() {
+        m_offsets.assign(m_positions.size() + 1, 0);
+        for (size_t t = 0; t < m_alive.size(); ++t) {
+            if (!m_alive[t]) continue;
+            for (size_t k = 0; k < 3; ++k) ++m_offsets[positionOf(t * 3 + k) + 1];
+        }
+        for (size_t p = 0; p < m_positions.size(); ++p) m_offsets[p + 1] += m_offsets[p];
+        m_adjacency.resize(m_offsets.back());
+        std::vector<uint32_t> fill(m_offsets.begin(), m_offsets.end() - 1);
+        for (size_t t = 0; t < m_alive.size(); ++t) {
+            if (!m_alive[t]) continue;
+            for (size_t k = 0; k < 3; ++k) m_adjacency[fill[positionOf(t * 3 + k)]++] = static_cast<uint32_t>(t);
+        }
+    }
+
+    void collectCandidates(double maxCost) {
+        std::vector<uint64_t>& edges = m_edges;
+        edges.clear();
+        for (size_t t = 0; t < m_alive.size(); ++t) {
+            if (!m_alive[t]) continue;
+            for (size_t k = 0; k < 3; ++k) {
+                const uint32_t a = positionOf(t * 3 + k);
+                const uint32_t b = positionOf(t * 3 + (k + 1) % 3);
+                edges.push_back(uint64_t{std::min(a, b)} << 32 | std::max(a, b));
+            }
+        }
+        std::sort(edges.begin(), edges.end());
+
+        // An edge used by one triangle is a border, by more than two a non-manifold fin; both
+        // pin their vertices.
+        std::vector<uint8_t>& locked = m_touched;
+        locked.assign(m_positions.size(), 0);
+        size_t unique = 0;
+        for (size_t i = 0; i < edges.size();) {
+            size_t j = i + 1;
+            while (j < edges.size() && edges[j] == edges[i]) ++j;
+            const uint32_t a = static_cast<uint32_t>(edges[i] >> 32);
+            const uint32_t b = static_cast<uint32_t>(edges[i]);
+            if (j - i != 2) locked[a] = locked[b] = 1;
+            edges[unique++] = edges[i];
+            i = j;
+        }
+        edges.resize(unique);
+
+        m_candidates.clear();
+        for (const uint64_t edge : edges) {
+            const uint32_t a = static_cast<uint32_t>(edge >> 32);
+            const uint32_t b = static_cast<uint32_t>(edge);
+            Collapse best{kNone, kNone, std::numeric_limits<double>::max()};
+            if (!locked[a]) best = {a, b, collapseCost(m_quadrics[a], m_quadrics[b], m_positions[b])};
+            if (!locked[b]) {
+                const double cost = collapseCost(m_quadrics[b], m_quadrics[a], m_positions[a]);
+                if (cost < best.cost) best = {b, a, cost};
+            }
+            if (best.from != kNone && best.cost <= maxCost) m_candidates.push_back(best);
+        }
+    }
+
+    // Moves position `from` onto `to`. Each wedge of `from` must meet exactly one wedge of `to`
+    // in the triangles they share, which is where its corners are redirected; a wedge with no
+    // shared triangle (e.g. the third face at a hard cube corner) would lose its attributes.
+    bool tryCollapse(uint32_t from, uint32_t to) {
+        m_wedgeMap.clear();
+        for (uint32_t a = m_offsets[from]; a < m_offsets[from + 1]; ++a) {
+            const uint32_t t = m_adjacency[a];
+            if (!m_alive[t]) continue;
+            uint32_t fromWedge = kNone;
+            uint32_t toWedge = kNone;
+            for (size_t k = 0; k < 3; ++k) {
+                const uint32_t w = m_corners[t * 3 + k];
+                if (m_wedgePosition[w] == from) fromWedge = w;
+                if (m_wedgePosition[w] == to) toWedge = w;
+            }
+            auto it = std::find_if(m_wedgeMap.begin(), m_wedgeMap.end(), [&](const auto& m) { return m.first == fromWedge; });
+            if (it == m_wedgeMap.end()) it = m_wedgeMap.insert(m_wedgeMap.end(), {fromWedge, kNone});
+            if (toWedge == kNone) continue;
+            if (it->second != kNone && it->second != toWedge) return false;
+            it->second = toWedge;
+        }
+        for (const auto& [fromWedge, toWedge] : m_wedgeMap) {
+            if (toWedge == kNone) return false;
+        }
+
+        // Link condition: the only positions adjacent to both ends may be the apexes of the
+        // triangles on the edge, otherwise the collapse pinches the surface into a fin.
+        m_ring.clear();
+        size_t shared = 0;
+        for (uint32_t a = m_offsets[from]; a < m_offsets[from + 1]; ++a) {
+            const uint32_t t = m_adjacency[a];
+            if (!m_alive[t]) continue;
+            for (size_t k = 0; k < 3; ++k) {
+                const uint32_t p = positionOf(t * 3 + k);
+                if (p != from) m_ring.push_back(p);
+                if (p == to) ++shared;
+            }
+        }
+        std::sort(m_ring.begin(), m_ring.end());
+        m_ring.erase(std::unique(m_ring.begin(), m_ring.end()), m_ring.end());
+        m_common.clear();
+        for (uint32_t a = m_offsets[to]; a < m_offsets[to + 1]; ++a) {
+            const uint32_t t = m_adjacency[a];
+            if (!m_alive[t]) continue;
+            for (size_t k = 0; k < 3; ++k) {
+                const uint32_t p = positionOf(t * 3 + k);
+                if (p != to && p != from && std::binary_search(m_ring.begin(), m_ring.end(), p)) m_common.push_back(p);
+            }
+        }
+        std::sort(m_common.begin(), m_common.end());
+        if (static_cast<size_t>(std::unique(m_common.begin(), m_common.end()) - m_common.begin()) > shared) return false;
+
+        // Reject collapses that fold a surviving triangle over.
+        const Vec3& target = m_positions[to];
+        for (uint32_t a = m_offsets[from]; a < m_offsets[from + 1]; ++a) {
+            const uint32_t t = m_adjacency[a];
+            if (!m_alive[t]) continue;
+            Vec3 before[3];
+            Vec3 after[3];
+            bool sharesTarget = false;
+            for (size_t k = 0; k < 3; ++k) {
+                const uint32_t p = positionOf(t * 3 + k);
+                sharesTarget = sharesTarget || p == to;
+                before[k] = m_positions[p];
+                after[k] = p == from ? target : before[k];
+            }
+            if (sharesTarget) continue;
+            const Vec3 n0 = cross(before[1] - before[0], before[2] - before[0]);
+            const Vec3 n1 = cross(after[1] - after[0], after[2] - after[0]);
+            const float d = dot(n0, n1);
+            if (d <= 0.0f || d * d < 0.0625f * dot(n0, n0) * dot(n1, n1)) return false;
+        }
+
+        for (uint32_t a = m_offsets[from]; a < m_offsets[from + 1]; ++a) {
+            const uint32_t t = m_adjacency[a];
+            if (!m_alive[t]) continue;
+            bool sharesTarget = false;
+            for (size_t k = 0; k < 3; ++k) sharesTarget = sharesTarget || positionOf(t * 3 + k) == to;
+            if (sharesTarget) {
+                m_alive[t] = 0;
+                --m_liveTriangles;
+                continue;
+            }
+            for (size_t k = 0; k < 3; ++k) {
+                uint32_t& corner = m_corners[t * 3 + k];
+                if (m_wedgePosition[corner] != from) continue;
+                corner = std::find_if(m_wedgeMap.begin(), m_wedgeMap.end(), [&](const auto& m) { return m.first == corner; })->second;
+            }
+        }
+        m_quadrics[to].add(m_quadrics[from]);
+        return true;
+    }
+
+    std::vector<uint32_t> m_globalWedge;
+    std::vector<uint32_t> m_wedgePosition;
+    std::vector<Vec3> m_positions;
+    std::vector<Quadric> m_quadrics;
+    std::vector<uint32_t> m_corners;
+    std::vector<uint8_t> m_alive;
+    size_t m_liveTriangles = 0;
+    double m_error = 0.0;
+    std::vector<uint32_t> m_offsets;
+    std::vector<uint32_t> m_adjacency;
+    std::vector<std::pair<uint32_t, uint32_t>> m_wedgeMap;
+    std::vector<uint32_t> m_ring;
+    std::vector<uint32_t> m_common;
+    std::vector<uint64_t> m_edges;
+    std::vector<Collapse> m_candidates;
+    std::vector<uint8_t> m_touched;
+};
+
+// Triangle-complete part of a range, or nothing if it refers past the vertex array.
+std::span<const uint32_t> simplifiableTriangles(std::span<const Vertex> vertices, std::span<const uint32_t> indices) {
+    const std::span<const uint32_t> triangles = indices.first(indices.size() - indices.size() % 3);
+    if (std::any_of(triangles.begin(), triangles.end(), [&](uint32_t i) { return i >= vertices.size(); })) return {};
+    return triangles;
+}
+
+} // namespace
+
+float simplifyMesh(std::span<const Vertex> vertices,
+                   std::span<const uint32_t> indices,
+                   size_t targetIndexCount,
+                   float maxError,
+                   std::vector<uint32_t>& out) {
+    const std::span<const uint32_t> triangles = simplifiableTriangles(vertices, indices);
+    if (triangles.empty()) {
+        out.insert(out.end(), indices.begin(), indices.end() - static_cast<std::ptrdiff_t>(indices.size() % 3));
+        return 0.0f;
+    }
+    Simplifier simplifier(vertices, triangles);
+    const double maxCost = double{maxError} * maxError;
+    const float error = static_cast<float>(simplifier.simplify(targetIndexCount, maxCost));
+    simplifier.emit(out);
+    return error;
+}
+
+LodChainReport buildLodChain(std::span<const Vertex> vertices,
+                             std::vector<uint32_t>& indices,
+                             std::vector<MeshSubmesh>& submeshes,
+                             std::vector<MeshLod>& lods,
+                             const LodChainOptions& options) {
+    const auto begin = std::chrono::steady_clock::now();
+    if (submeshes.empty()) submeshes.push_back({0, static_cast<uint32_t>(indices.size()), 0, 0});
+    const std::vector<MeshSubmesh> base = submeshes;
+    uint32_t baseIndexCount = 0;
+    for (const MeshSubmesh& submesh : base) baseIndexCount += submesh.indexCount;
+    lods.assign(1, {0, static_cast<uint32_t>(base.size()), 0.0f, 0.0f});
+
+    LodChainReport report;
+    report.indexCounts.push_back(baseIndexCount);
+    report.errors.push_back(0.0f);
+
+    // Each submesh keeps one simplifier for the whole chain: a coarser level continues from
+    // the finer one, so welding and quadrics are built once and errors accumulate.
+    std::vector<std::optional<Simplifier>> simplifiers(base.size());
+    for (size_t s = 0; s < base.size(); ++s) {
+        const MeshSubmesh& submesh = base[s];
+        if (uint64_t{submesh.firstIndex} + submesh.indexCount > indices.size()) continue;
+        const auto triangles =
+            simplifiableTriangles(vertices, std::span<const uint32_t>(indices).subspan(submesh.firstIndex, submesh.indexCount));
+        if (!triangles.empty()) simplifiers[s].emplace(vertices, triangles);
+    }
+
+    const double maxCost = double{options.maxError} * options.maxError;
+    float lastScreenSize = std::numeric_limits<float>::max();
+    for (const float ratio : options.ratios) {
+        const size_t firstIndex = indices.size();
+        const size_t firstSubmesh = submeshes.size();
+        float error = 0.0f;
+        for (size_t s = 0; s < base.size(); ++s) {
+            if (!simplifiers[s]) continue;
+            const size_t target = static_cast<size_t>(static_cast<double>(base[s].indexCount) * ratio / 3.0) * 3;
+            error = std::max(error, static_cast<float>(simplifiers[s]->simplify(target, maxCost)));
+            const size_t start = indices.size();
+            simplifiers[s]->emit(indices);
+            submeshes.push_back({static_cast<uint32_t>(start), static_cast<uint32_t>(indices.size() - start),
+                                 base[s].materialIndex, 0});
+        }
+
+        const uint32_t levelIndexCount = static_cast<uint32_t>(indices.size() - firstIndex);
+        if (levelIndexCount == 0 ||
+            static_cast<float>(levelIndexCount) > static_cast<float>(report.indexCounts.back()) * (1.0f - options.minReduction)) {
+            indices.resize(firstIndex);
+            submeshes.resize(firstSubmesh);
+            break;
+        }
+        // Projected error stays under pixelError while the object is smaller than this; a
+        // lossless level is usable at any size, but never before the finer level is.
+        const float screenSize = error > 0.0f ? options.pixelError / (error * kLodReferenceHeight) : lastScreenSize;
+        lastScreenSize = std::min(lastScreenSize, screenSize);
+        lods.push_back({static_cast<uint32_t>(firstSubmesh), static_cast<uint32_t>(submeshes.size() - firstSubmesh),
+                        lastScreenSize, error});
+        report.indexCounts.push_back(levelIndexCount);
+        report.errors.push_back(error);
+    }
+    report.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    return report;
+}
+
+std::vector<MeshLodRange> makeLodRanges(std::span<const MeshSubmesh> submeshes, std::span<const MeshLod> lods) {
+    std::vector<MeshLodRange> ranges;
+    ranges.reserve(lods.size());
+    for (const MeshLod& lod : lods) {
+        if (uint64_t{lod.firstSubmesh} + lod.submeshCount > submeshes.size() || lod.submeshCount == 0) break;
+        uint32_t first = std::numeric_limits<uint32_t>::max();
+        uint32_t end = 0;
+        for (const MeshSubmesh& submesh : submeshes.subspan(lod.firstSubmesh, lod.submeshCount)) {
+            first = std::min(first, submesh.firstIndex);
+            end = std::max(end, submesh.firstIndex + submesh.indexCount);
+        }
+        ranges.push_back({first, end - first, lod.screenSize});
+    }
+    return ranges;
+}
+
+uint32_t selectLod(std::span<const MeshLodRange> lods, float screenSize, uint32_t current, float hysteresis) {
+    if (lods.size() < 2) return 0;
+    uint32_t lod = std::min<uint32_t>(current, static_cast<uint32_t>(lods.size() - 1));
+    while (lod + 1 < lods.size() && screenSize < lods[lod + 1].screenSize * (1.0f - hysteresis)) ++lod;
+    while (lod > 0 && screenSize > lods[lod].screenSize * (1.0f + hysteresis)) --lod;
+    return lod;
+}
+
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Mesh.h"
+#include "MeshFile.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace rex::gfx {
+
+// LOD screen sizes are the bounding-sphere diameter over the viewport height; a level's
+// threshold is where its simplification error projects to `pixelError` pixels on a viewport
+// this tall.
+constexpr float kLodReferenceHeight = 1080.0f;
+
+// Quadric-error edge collapse over one index range. Vertices are welded by position, so a
+// collapse moves every attribute wedge of a vertex together and UV/normal seams survive;
+// border and non-manifold vertices never move, so ranges simplified separately still meet.
+// Appends to `out` (indices into the same vertex array) and returns the largest collapse
+// error as a distance relative to the range's bounding-box diagonal.
+float simplifyMesh(std::span<const Vertex> vertices,
+                   std::span<const uint32_t> indices,
+                   size_t targetIndexCount,
+                   float maxError,
+                   std::vector<uint32_t>& out);
+
+struct LodChainOptions {
+    // Triangle ratio of each coarser level, relative to LOD 0.
+    std::vector<float> ratios{0.5f, 0.25f, 0.125f, 0.0625f};
+    // Relative error past which no collapse is made (see simplifyMesh).
+    float maxError = 0.05f;
+    float pixelError = 1.0f;
+    // The chain ends at the first level that removes less than this fraction of the
+    // previous level's triangles.
+    float minReduction = 0.1f;
+};
+
+struct LodChainReport {
+    // Index count per level, LOD 0 first.
+    std::vector<uint32_t> indexCounts;
+    std::vector<float> errors;
+    double milliseconds = 0.0;
+};
+
+// Simplifies every LOD 0 submesh into each coarser level, appends the level's indices and
+// submeshes, and fills `lods` (LOD 0 being the submeshes passed in; empty means one submesh
+// over all indices). All levels share the vertex stream.
+LodChainReport buildLodChain(std::span<const Vertex> vertices,
+                             std::vector<uint32_t>& indices,
+                             std::vector<MeshSubmesh>& submeshes,
+                             std::vector<MeshLod>& lods,
+                             const LodChainOptions& options = {});
+
+// One drawable index range per LOD, spanning that LOD's submeshes.
+std::vector<MeshLodRange> makeLodRanges(std::span<const MeshSubmesh> submeshes, std::span<const MeshLod> lods);
+
+// Steps from `current` towards the level whose threshold band contains screenSize, crossing a
+// threshold only once the size is `hysteresis` (relative) past it so objects near a
+// boundary do not flicker between levels. Pass hysteresis 0 for a stateless pick.
+uint32_t selectLod(std::span<const MeshLodRange> lods, float screenSize, uint32_t current, float hysteresis);
+
+}
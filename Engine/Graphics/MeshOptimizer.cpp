@@ -0,0 +1,362 @@
+#include "MeshOptimizer.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+namespace rex::gfx {
+
+namespace {
+
+constexpr uint32_t kNone = std::numeric_limits<uint32_t>::max();
+
+// Forsyth's tuning: a 32-entry LRU model, the last triangle's vertices at a flat score,
+// older entries decaying with power 1.5, and a valence boost so lonely vertices finish first.
+constexpr uint32_t kScoreCacheSize = 32;
+constexpr uint32_t kMaxScoredValence = 32;
+constexpr float kCacheDecayPower = 1.5f;
+constexpr float kLastTriangleScore = 0.75f;
+constexpr float kValenceBoostScale = 2.0f;
+constexpr float kValenceBoostPower = 0.5f;
+
+struct ScoreTables {
+    std::array<float, kScoreCacheSize> cache{};
+    std::array<float, kMaxScoredValence + 1> valence{};
+};
+
+const ScoreTables& scoreTables() {
+    static const ScoreTables tables = [] {
+        ScoreTables t;
+        for (uint32_t i = 0; i < kScoreCacheSize; ++i) {
+            if (i < 3) {
+                t.cache[i] = kLastTriangleScore;
+            } else {
+                const float scale = 1.0f - static_cast<float>(i - 3) / static_cast<float>(kScoreCacheSize - 3);
+                t.cache[i] = std::pow(scale, kCacheDecayPower);
+            }
+        }
+        for (uint32_t v = 1; v <= kMaxScoredValence; ++v) {
+            t.valence[v] = kValenceBoostScale * std::pow(static_cast<float>(v), -kValenceBoostPower);
+        }
+        return t;
+    }();
+    return tables;
+}
+
+float vertexScore(uint32_t cachePosition, uint32_t remaining) {
+    if (remaining == 0) return -1.0f;
+    const ScoreTables& tables = scoreTables();
+    const float cache = cachePosition < kScoreCacheSize ? tables.cache[cachePosition] : 0.0f;
+    return cache + tables.valence[std::min(remaining, kMaxScoredValence)];
+}
+
+// FIFO post-transform cache: a vertex is resident if fewer than `size` misses happened since
+// it was last loaded, so one timestamp per vertex replaces an explicit queue.
+class FifoCache {
+public:
+    FifoCache(size_t vertexCount, unsigned size) : m_loadedAt(vertexCount, 0), m_size(size), m_time(size + 1) {}
+
+    // Returns true on a miss.
+    bool touch(uint32_t vertex) {
+        if (m_time - m_loadedAt[vertex] <= m_size) return false;
+        m_loadedAt[vertex] = m_time++;
+        return true;
+    }
+
+    // Ages every entry out, as if the cache had been flushed.
+    void reset() { m_time += m_size + 1; }
+
+    bool referenced(uint32_t vertex) const { return m_loadedAt[vertex] != 0; }
+
+private:
+    std::vector<uint64_t> m_loadedAt;
+    uint64_t m_size;
+    uint64_t m_time;
+};
+
+// Overdraw clustering: the FIFO size matches analyzeVertexCache's default, and a soft cluster
+// is never cut shorter than this many triangles.
+constexpr unsigned kOverdrawCacheSize = 16;
+constexpr uint32_t kMinClusterTriangles = 64;
+
+struct Cluster {
+    uint32_t firstTriangle = 0;
+    uint32_t triangleCount = 0;
+    float sortKey = 0.0f;
+};
+
+} // namespace
+
+VertexCacheStats analyzeVertexCache(std::span<const uint32_t> indices, size_t vertexCount, unsigned cacheSize) {
+    VertexCacheStats stats;
+    if (indices.size() < 3 || vertexCount == 0) return stats;
+    FifoCache cache(vertexCount, std::max(cacheSize, 1u));
+    for (const uint32_t index : indices) {
+        if (index < vertexCount && cache.touch(index)) ++stats.transforms;
+    }
+    size_t referenced = 0;
+    for (uint32_t v = 0; v < vertexCount; ++v) {
+        if (cache.referenced(v)) ++referenced;
+    }
+    stats.acmr = static_cast<float>(stats.transforms) / static_cast<float>(indices.size() / 3);
+    stats.atvr = referenced ? static_cast<float>(stats.transforms) / static_cast<float>(referenced) : 0.0f;
+    return stats;
+}
+
+void optimizeVertexCache(std::span<uint32_t> indices, size_t vertexCount) {
+    const size_t triangleCount = indices.size() / 3;
+    if (triangleCount < 2 || vertexCount == 0) return;
+    for (size_t i = 0; i < triangleCount * 3; ++i) {
+        if (indices[i] >= vertexCount) return;
+    }
+
+    // Triangle adjacency per vertex. live[v] counts the not-yet-emitted triangles, which are
+    // kept at the front of the vertex's adjacency slice.
+    std::vector<uint32_t> live(vertexCount, 0);
+    for (size_t i = 0; i < triangleCount * 3; ++i) ++live[indices[i]];
+    std::vector<uint32_t> offsets(vertexCount + 1, 0);
+    for (size_t v = 0; v < vertexCount; ++v) offsets[v + 1] = offsets[v] + live[v];
+    std::vector<uint32_t> adjacency(triangleCount * 3);
+    {
+        std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+        for (size_t t = 0; t < triangleCount; ++t) {
+            for (size_t k = 0; k < 3; ++k) adjacency[fill[indices[t * 3 + k]]++] = static_cast<uint32_t>(t);
+        }
+    }
+
+    std::vector<uint32_t> cachePosition(vertexCount, kNone);
+    std::vector<float> vertexScores(vertexCount);
+    for (size_t v = 0; v < vertexCount; ++v) vertexScores[v] = vertexScore(kNone, live[v]);
+    std::vector<float> triangleScores(triangleCount);
+    uint32_t best = 0;
+    for (size_t t = 0; t < triangleCount; ++t) {
+        triangleScores[t] = vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] +
+                            vertexScores[indices[t * 3 + 2]];
+        if (triangleScores[t] > triangleScores[best]) best = static_cast<uint32_t>(t);
+    }
+
+    std::vector<uint8_t> emitted(triangleCount, 0);
+    std::vector<uint32_t> output(triangleCount * 3);
+    std::array<uint32_t, kScoreCacheSize + 3> cache{};
+    std::array<uint32_t, kScoreCacheSize + 3> next{};
+    size_t cacheCount = 0;
+    size_t cursor = 0;
+
+    for (size_t out = 0; out < triangleCount; ++out) {
+        if (best == kNone) {
+            // Nothing in the cache touches a live triangle: restart at the next unemitted one.
+            while (emitted[cursor]) ++cursor;
+            best = static_cast<uint32_t>(cursor);
+        }
+        const uint32_t triangle = best;
+        emitted[triangle] = 1;
+
+        size_t nextCount = 0;
+        for (size_t k = 0; k < 3; ++k) {
+            const uint32_t v = indices[triangle * 3 + k];
+            output[out * 3 + k] = v;
+            uint32_t* begin = adjacency.data() + offsets[v];
+            uint32_t* end = begin + live[v];
+            *std::find(begin, end, triangle) = end[-1];
+            --live[v];
+            if (std::find(next.begin(), next.begin() + nextCount, v) == next.begin() + nextCount) {
+                next[nextCount++] = v;
+            }
+        }
+        const size_t fresh = nextCount;
+        for (size_t i = 0; i < cacheCount; ++i) {
+            if (std::find(next.begin(), next.begin() + fresh, cache[i]) == next.begin() + fresh) {
+                next[nextCount++] = cache[i];
+            }
+        }
+
+        // Rescore every vertex whose cache slot or valence changed, including the ones that
+        // just fell out, and push the deltas into their live triangles.
+        for (size_t i = 0; i < nextCount; ++i) {
+            const uint32_t v = next[i];
+            cachePosition[v] = i < kScoreCacheSize ? static_cast<uint32_t>(i) : kNone;
+            const float score = vertexScore(cachePosition[v], live[v]);
+            const float delta = score - vertexScores[v];
+            vertexScores[v] = score;
+            for (uint32_t a = offsets[v]; a < offsets[v] + live[v]; ++a) triangleScores[adjacency[a]] += delta;
+        }
+        cacheCount = std::min<size_t>(nextCount, kScoreCacheSize);
+        std::copy_n(next.begin(), cacheCount, cache.begin());
+
+        best = kNone;
+        float bestScore = -std::numeric_limits<float>::max();
+        for (size_t i = 0; i < cacheCount; ++i) {
+            const uint32_t v = cache[i];
+            for (uint32_t a = offsets[v]; a < offsets[v] + live[v]; ++a) {
+                const uint32_t candidate = adjacency[a];
+                if (triangleScores[candidate] > bestScore) {
+                    bestScore = triangleScores[candidate];
+                    best = candidate;
+                }
+            }
+        }
+    }
+    std::copy(output.begin(), output.end(), indices.begin());
+}
+
+bool optimizeOverdraw(std::span<uint32_t> indices, std::span<const Vertex> vertices, float threshold) {
+    const size_t triangleCount = indices.size() / 3;
+    if (triangleCount < 2 || vertices.empty()) return false;
+    for (size_t i = 0; i < triangleCount * 3; ++i) {
+        if (indices[i] >= vertices.size()) return false;
+    }
+    const std::span<uint32_t> triangles = indices.first(triangleCount * 3);
+    const VertexCacheStats before = analyzeVertexCache(triangles, vertices.size());
+
+    // A triangle whose three corners all miss starts a hard cluster: the cache held nothing
+    // useful there, so moving the cluster costs no extra transforms. Hard clusters are then
+    // cut into soft ones wherever a cold-started prefix already reaches `threshold` times the
+    // cluster's own ACMR, which bounds what reordering the pieces can cost.
+    std::vector<Cluster> hard;
+    std::vector<uint8_t> misses(triangleCount);
+    {
+        FifoCache cache(vertices.size(), kOverdrawCacheSize);
+        for (size_t t = 0; t < triangleCount; ++t) {
+            for (size_t k = 0; k < 3; ++k) misses[t] += cache.touch(triangles[t * 3 + k]) ? 1 : 0;
+            if (t == 0 || misses[t] == 3) hard.push_back({static_cast<uint32_t>(t), 0, 0.0f});
+            ++hard.back().triangleCount;
+        }
+    }
+    std::vector<Cluster> clusters;
+    {
+        FifoCache cache(vertices.size(), kOverdrawCacheSize);
+        for (const Cluster& cluster : hard) {
+            const uint32_t end = cluster.firstTriangle + cluster.triangleCount;
+            uint32_t clusterMisses = 0;
+            for (uint32_t t = cluster.firstTriangle; t < end; ++t) clusterMisses += misses[t];
+            const float budget = static_cast<float>(clusterMisses) / static_cast<float>(cluster.triangleCount) * threshold;
+
+            cache.reset();
+            uint32_t start = cluster.firstTriangle;
+            uint32_t running = 0;
+            for (uint32_t t = cluster.firstTriangle; t < end; ++t) {
+                for (size_t k = 0; k < 3; ++k) running += cache.touch(triangles[t * 3 + k]) ? 1 : 0;
+                const uint32_t count = t + 1 - start;
+                if (t + 1 < end && count >= kMinClusterTriangles && static_cast<float>(running) <= budget * static_cast<float>(count)) {
+                    clusters.push_back({start, count, 0.0f});
+                    start = t + 1;
+                    running = 0;
+                    cache.reset();
+                }
+            }
+            clusters.push_back({start, end - start, 0.0f});
+        }
+    }
+    if (clusters.size() < 2) return false;
+
+    // Area-weighted centroid and normal per cluster. Clusters facing away from the mesh centre
+    // sit on the silhouette-facing outside and tend to occlude the rest, so they draw first.
+    std::vector<Vec3> centroids(clusters.size());
+    std::vector<Vec3> normals(clusters.size());
+    Vec3 meshCentroid{0, 0, 0};
+    float meshArea = 0.0f;
+    for (size_t c = 0; c < clusters.size(); ++c) {
+        Vec3 centroid{0, 0, 0};
+        Vec3 normal{0, 0, 0};
+        float area = 0.0f;
+        for (uint32_t t = clusters[c].firstTriangle; t < clusters[c].firstTriangle + clusters[c].triangleCount; ++t) {
+            const Vec3& p0 = vertices[triangles[t * 3]].position;
+            const Vec3& p1 = vertices[triangles[t * 3 + 1]].position;
+            const Vec3& p2 = vertices[triangles[t * 3 + 2]].position;
+            const Vec3 n = cross(p1 - p0, p2 - p0);
+            const float a = std::sqrt(dot(n, n));
+            centroid += (p0 + p1 + p2) * (a / 3.0f);
+            normal += n;
+            area += a;
+        }
+        meshCentroid += centroid;
+        meshArea += area;
+        centroids[c] = area > 0.0f ? centroid * (1.0f / area) : vertices[triangles[clusters[c].firstTriangle * 3]].position;
+        normals[c] = normalize(normal);
+    }
+    if (meshArea > 0.0f) meshCentroid = meshCentroid * (1.0f / meshArea);
+    for (size_t c = 0; c < clusters.size(); ++c) {
+        clusters[c].sortKey = dot(centroids[c] - meshCentroid, normals[c]);
+    }
+    std::stable_sort(clusters.begin(), clusters.end(),
+                     [](const Cluster& a, const Cluster& b) { return a.sortKey > b.sortKey; });
+
+    std::vector<uint32_t> reordered;
+    reordered.reserve(triangles.size());
+    for (const Cluster& cluster : clusters) {
+        const auto first = triangles.begin() + size_t{cluster.firstTriangle} * 3;
+        reordered.insert(reordered.end(), first, first + size_t{cluster.triangleCount} * 3);
+    }
+    const VertexCacheStats after = analyzeVertexCache(reordered, vertices.size());
+    if (after.acmr > before.acmr * threshold) return false;
+    std::copy(reordered.begin(), reordered.end(), triangles.begin());
+    return true;
+}
+
+size_t optimizeVertexFetch(std::span<uint32_t> indices, std::vector<Vertex>& vertices) {
+    std::vector<uint32_t> remap(vertices.size(), kNone);
+    std::vector<Vertex> reordered;
+    reordered.reserve(vertices.size());
+    for (uint32_t& index : indices) {
+        if (index >= vertices.size()) continue;
+        if (remap[index] == kNone) {
+            remap[index] = static_cast<uint32_t>(reordered.size());
+            reordered.push_back(vertices[index]);
+        }
+        index = remap[index];
+    }
+    vertices.swap(reordered);
+    return vertices.size();
+}
+
+MeshOptimizeReport optimizeMesh(std::vector<Vertex>& vertices,
+                                std::vector<uint32_t>& indices,
+                                std::span<const MeshSubmesh> submeshes,
+                                const MeshOptimizeOptions& options) {
+    const auto begin = std::chrono::steady_clock::now();
+    MeshOptimizeReport report;
+    report.verticesBefore = vertices.size();
+    report.before = analyzeVertexCache(indices, vertices.size());
+
+    const MeshSubmesh wholeMesh{0, static_cast<uint32_t>(indices.size()), 0, 0};
+    const std::span<const MeshSubmesh> ranges = submeshes.empty() ? std::span<const MeshSubmesh>(&wholeMesh, 1) : submeshes;
+    for (const MeshSubmesh& submesh : ranges) {
+        if (uint64_t{submesh.firstIndex} + submesh.indexCount > indices.size()) continue;
+        const std::span<uint32_t> range = std::span<uint32_t>(indices).subspan(submesh.firstIndex, submesh.indexCount);
+        optimizeVertexCache(range, vertices.size());
+        if (options.overdraw && optimizeOverdraw(range, vertices, options.overdrawThreshold)) {
+            ++report.overdrawRanges;
+        }
+    }
+    // Fetch order is global: one vertex stream serves every submesh.
+    optimizeVertexFetch(indices, vertices);
+
+    report.after = analyzeVertexCache(indices, vertices.size());
+    report.verticesAfter = vertices.size();
+    report.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    return report;
+}
+
+VertexFormat quantizeVertices(std::span<const Vertex> vertices,
+                              std::vector<PackedVertex>& out,
+                              float* maxPositionError) {
+    const bool unitTexCoords = std::all_of(vertices.begin(), vertices.end(), [](const Vertex& v) {
+        return v.texCoords.x >= 0.0f && v.texCoords.x <= 1.0f && v.texCoords.y >= 0.0f && v.texCoords.y <= 1.0f;
+    });
+    const VertexFormat format = unitTexCoords ? VertexFormat::Packed : VertexFormat::PackedWideUV;
+    out.resize(vertices.size());
+    float maxError = 0.0f;
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        out[i] = packVertex(vertices[i], format);
+        const Vec3& p = vertices[i].position;
+        maxError = std::max({maxError, std::fabs(halfToFloat(out[i].position[0]) - p.x),
+                             std::fabs(halfToFloat(out[i].position[1]) - p.y),
+                             std::fabs(halfToFloat(out[i].position[2]) - p.z)});
+    }
+    if (maxPositionError) *maxPositionError = maxError;
+    return format;
+}
+
+}
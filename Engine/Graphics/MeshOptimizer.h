@@ -0,0 +1,67 @@
+#pragma once
+
+#include "MeshFile.h"
+#include "VertexFormat.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace rex::gfx {
+
+// Post-transform cache behaviour of an index stream under a FIFO cache model.
+struct VertexCacheStats {
+    uint64_t transforms = 0;
+    // Average cache miss ratio: vertex shader runs per triangle (0.5 is ideal on a regular
+    // grid, 3.0 is the worst case).
+    float acmr = 0.0f;
+    // Vertex shader runs per referenced vertex (1.0 is ideal).
+    float atvr = 0.0f;
+};
+
+VertexCacheStats analyzeVertexCache(std::span<const uint32_t> indices, size_t vertexCount, unsigned cacheSize = 16);
+
+// Reorders triangles in place for post-transform cache hits (Tom Forsyth's linear-speed
+// vertex cache optimisation).
+void optimizeVertexCache(std::span<uint32_t> indices, size_t vertexCount);
+
+// Splits a cache-optimised index stream into clusters where the cache restarts anyway and
+// sorts the clusters so outward-facing ones draw first. The new order is kept only if the
+// ACMR stays within `threshold` times the input's; returns whether it was kept.
+bool optimizeOverdraw(std::span<uint32_t> indices, std::span<const Vertex> vertices, float threshold = 1.05f);
+
+// Renumbers vertices in first-use order (dropping unreferenced ones) so vertex fetch walks
+// memory forwards. Returns the new vertex count.
+size_t optimizeVertexFetch(std::span<uint32_t> indices, std::vector<Vertex>& vertices);
+
+struct MeshOptimizeOptions {
+    bool overdraw = true;
+    float overdrawThreshold = 1.05f;
+};
+
+struct MeshOptimizeReport {
+    VertexCacheStats before;
+    VertexCacheStats after;
+    size_t verticesBefore = 0;
+    size_t verticesAfter = 0;
+    // Submeshes whose overdraw order was kept.
+    uint32_t overdrawRanges = 0;
+    double milliseconds = 0.0;
+};
+
+// Runs the cache, overdraw and fetch passes. Each submesh range is reordered on its own, so
+// the ranges stay valid; empty submeshes means one range over all indices.
+MeshOptimizeReport optimizeMesh(std::vector<Vertex>& vertices,
+                                std::vector<uint32_t>& indices,
+                                std::span<const MeshSubmesh> submeshes = {},
+                                const MeshOptimizeOptions& options = {});
+
+// Packs vertices into the 16-byte layout and returns its format: Packed when every UV lies in
+// [0, 1], PackedWideUV otherwise. maxPositionError receives the largest half-float rounding
+// error of any position component.
+VertexFormat quantizeVertices(std::span<const Vertex> vertices,
+                              std::vector<PackedVertex>& out,
+                              float* maxPositionError = nullptr);
+
+}
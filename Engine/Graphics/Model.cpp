@@ -1,7 +1,10 @@
 #include "Model.h"
-#include <fstream>
-#include <sstream>
-#include <iostream>
+#include "MeshFile.h"
+#include "MeshLod.h"
+#include "ObjImporter.h"
+#include "../Core/Platform/Vfs.h"
+#include <iterator>
+#include <string>
 #include "../Core/Logger.h"
 
 namespace rex {
@@ -11,68 +14,48 @@ Model::~Model() {
 }
 
 bool Model::loadFromFile(const std::string& path) {
-    std::ifstream file(path);
-    if (!file.is_open()) {
-        Logger::error("Failed to open model file: {}", path);
-        return false;
-    }
-
-    std::vector<Vec3> positions;
-    std::vector<Vec3> normals;
-    std::vector<Vec2> texCoords;
-    std::vector<Vertex> vertices;
-    std::vector<uint32_t> indices;
+    if (path.ends_with(gfx::kMeshFileExtension)) return loadMeshFile(path);
 
-    std::string line;
-    while (std::getline(file, line)) {
-        std::stringstream ss(line);
-        std::string prefix;
-        ss >> prefix;
+    const auto mesh = gfx::ObjImporter::importFile(path);
+    if (!mesh || mesh->indices.empty()) return false;
 
-        if (prefix == "v") {
-            Vec3 v;
-            ss >> v.x >> v.y >> v.z;
-            positions.push_back(v);
-        } else if (prefix == "vn") {
-            Vec3 v;
-            ss >> v.x >> v.y >> v.z;
-            normals.push_back(v);
-        } else if (prefix == "vt") {
-            Vec2 v;
-            ss >> v.x >> v.y;
-            texCoords.push_back(v);
-        } else if (prefix == "f") {
-            for (int i = 0; i < 3; i++) {
-                std::string vertexData;
-                ss >> vertexData;
-                
-                // Parse face format: v/vt/vn
-                std::replace(vertexData.begin(), vertexData.end(), '/', ' ');
-                std::stringstream vss(vertexData);
-                uint32_t vi, vti = 0, vni = 0;
-                vss >> vi;
-                if (vertexData.find(' ') != std::string::npos) {
-                    vss >> vti >> vni;
-                }
+    m_meshes.push_back(new Mesh(mesh->vertices, mesh->indices));
+    Logger::info("Loaded model: {} ({} vertices)", path, mesh->vertices.size());
+    return true;
+}
 
-                Vertex v{};
-                v.position = positions[vi - 1];
-                if (vti > 0) v.texCoords = texCoords[vti - 1];
-                if (vni > 0) v.normal = normals[vni - 1];
-                
-                vertices.push_back(v);
-                indices.push_back(indices.size());
-            }
-        }
+bool Model::loadMeshFile(const std::string& path) {
+    const core::platform::VfsFile file = core::platform::VirtualFileSystem::instance().open(path);
+    if (!file.valid()) {
+        Logger::error("Failed to open mesh file: {}", path);
+        return false;
     }
+    const auto view = gfx::MeshFileView::parse(file.bytes());
+    if (!view) {
+        Logger::error("Failed to load mesh file: {}", path);
+        return false;
+    }
+    // The GL driver copies out of the mapping; nothing is staged in between.
+    m_meshes.push_back(new Mesh(view->vertexFormat(), view->vertexBytes(), view->indices(),
+                                gfx::makeLodRanges(view->submeshes(), view->lods()), gfx::boundingRadius(view->bounds())));
+    Logger::info("Loaded mesh: {} ({} vertices)", path, view->header().vertexCount);
+    return true;
+}
+
+bool Model::parseObj(std::istream& in, std::vector<Vertex>& vertices, std::vector<uint32_t>& indices) {
+    const std::string text(std::istreambuf_iterator<char>(in), {});
+    const auto mesh = gfx::ObjImporter::importText(text);
+    if (!mesh) return false;
 
-    m_meshes.push_back(new Mesh(vertices, indices));
-    Logger::info("Loaded model: {} ({} vertices)", path, vertices.size());
+    const uint32_t base = static_cast<uint32_t>(vertices.size());
+    vertices.insert(vertices.end(), mesh->vertices.begin(), mesh->vertices.end());
+    indices.reserve(indices.size() + mesh->indices.size());
+    for (const uint32_t index : mesh->indices) indices.push_back(base + index);
     return true;
 }
 
-void Model::draw() const {
-    for (auto* m : m_meshes) m->draw();
+void Model::draw(uint32_t lod) const {
+    for (auto* m : m_meshes) m->draw(lod);
 }
 
 }
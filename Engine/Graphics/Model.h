@@ -1,4 +1,5 @@
 #pragma once
+#include <istream>
 #include <string>
 #include <vector>
 #include "Mesh.h"
@@ -10,12 +11,21 @@ public:
     Model() = default;
     ~Model();
 
+    // .rexmesh files are mapped and uploaded in place; anything else is parsed as OBJ.
     bool loadFromFile(const std::string& path);
-    void draw() const;
+    // CPU-only OBJ parse through ObjImporter (n-gons triangulated, corners deduplicated);
+    // appends to the output arrays. Needs no GL context.
+    static bool parseObj(std::istream& in, std::vector<Vertex>& vertices, std::vector<uint32_t>& indices);
+    void draw(uint32_t lod = 0) const;
 
     const std::vector<Mesh*>& getMeshes() const { return m_meshes; }
+    // LOD thresholds of the first mesh; selection is per model, not per mesh.
+    std::span<const MeshLodRange> lods() const { return m_meshes.empty() ? std::span<const MeshLodRange>() : m_meshes.front()->lods(); }
+    VertexFormat vertexFormat() const { return m_meshes.empty() ? VertexFormat::Float32 : m_meshes.front()->vertexFormat(); }
 
 private:
+    bool loadMeshFile(const std::string& path);
+
     std::vector<Mesh*> m_meshes;
 };
 
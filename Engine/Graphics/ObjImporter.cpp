@@ -0,0 +1,633 @@
+#include "ObjImporter.h"
+#include "../Core/Job/ThreadPool.h"
+#include "../Core/Logger.h"
+#include "../Core/Platform/Vfs.h"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+
+namespace rex::gfx {
+
+namespace {
+
+using ImportClock = std::chrono::steady_clock;
+
+constexpr int32_t kAbsent = std::numeric_limits<int32_t>::min();
+constexpr uint8_t kRelativeV = 1;
+constexpr uint8_t kRelativeVt = 2;
+constexpr uint8_t kRelativeVn = 4;
+
+double elapsedMs(ImportClock::time_point begin, ImportClock::time_point end) {
+    return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+// Face corner as parsed. Positive OBJ indices are stored 0-based and global; negative
+// (relative) ones are stored 0-based relative to the chunk start and flagged, because the
+// chunk does not know how many elements the chunks before it defined.
+struct Corner {
+    int32_t v = kAbsent;
+    int32_t vt = kAbsent;
+    int32_t vn = kAbsent;
+    uint8_t relative = 0;
+};
+
+struct Marker {
+    enum class Kind : uint8_t { Group, Material };
+    uint32_t face = 0;
+    Kind kind = Kind::Group;
+    std::string name;
+};
+
+struct Chunk {
+    std::string_view text;
+    std::vector<Vec3> positions;
+    std::vector<Vec3> normals;
+    std::vector<Vec2> texCoords;
+    std::vector<Corner> corners;
+    // faceStart[i] is the first corner of face i; one trailing entry closes the last face.
+    std::vector<uint32_t> faceStart{0};
+    std::vector<Marker> markers;
+    std::vector<std::string> materialLibraries;
+    // Offset of the first line that failed to parse, relative to the chunk.
+    size_t errorOffset = std::string_view::npos;
+
+    uint32_t faceCount() const { return static_cast<uint32_t>(faceStart.size() - 1); }
+};
+
+// --- Scalar parsing --------------------------------------------------------
+
+inline bool isDigit(char c) {
+    return static_cast<unsigned char>(c - '0') < 10;
+}
+
+inline bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline const char* skipBlanks(const char* p, const char* end) {
+    while (p < end && isBlank(*p)) ++p;
+    return p;
+}
+
+inline const char* skipLine(const char* p, const char* end) {
+    const void* newline = std::memchr(p, '\n', static_cast<size_t>(end - p));
+    return newline ? static_cast<const char*>(newline) + 1 : end;
+}
+
+// Decimal float with optional sign, fraction and exponent. Up to 19 significant digits are
+// accumulated in an integer and scaled once by an exact power of ten, which is accurate to
+// the last bit of a float. Anything else (inf, nan, hex) goes through std::from_chars.
+const char* parseFloat(const char* p, const char* end, float& out) {
+    static constexpr double kPow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                        1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                        1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    const char* const start = p;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) negative = *p++ == '-';
+
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int exponent = 0;
+    bool any = false;
+    for (; p < end && isDigit(*p); ++p) {
+        any = true;
+        if (digits < 19) {
+            mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+            digits += mantissa != 0;
+        } else {
+            ++exponent;
+        }
+    }
+    if (p < end && *p == '.') {
+        for (++p; p < end && isDigit(*p); ++p) {
+            any = true;
+            if (digits < 19) {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+                digits += mantissa != 0;
+                --exponent;
+            }
+        }
+    }
+    if (!any) {
+        const auto [next, ec] = std::from_chars(start, end, out);
+        return ec == std::errc{} ? next : nullptr;
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        const char* q = p + 1;
+        bool negativeExponent = false;
+        if (q < end && (*q == '-' || *q == '+')) negativeExponent = *q++ == '-';
+        if (q < end && isDigit(*q)) {
+            int value = 0;
+            for (; q < end && isDigit(*q); ++q) value = std::min(value * 10 + (*q - '0'), 10000);
+            exponent += negativeExponent ? -value : value;
+            p = q;
+        }
+    }
+
+    double value = static_cast<double>(mantissa);
+    if (exponent < 0) {
+        value = exponent >= -22 ? value / kPow10[-exponent] : value * std::pow(10.0, exponent);
+    } else if (exponent > 0) {
+        value = exponent <= 22 ? value * kPow10[exponent] : value * std::pow(10.0, exponent);
+    }
+    out = static_cast<float>(negative ? -value : value);
+    return p;
+}
+
+inline const char* parseIndex(const char* p, const char* end, int32_t& out) {
+    bool negative = false;
+    if (p < end && *p == '-') {
+        negative = true;
+        ++p;
+    }
+    if (p >= end || !isDigit(*p)) return nullptr;
+    int64_t value = 0;
+    for (; p < end && isDigit(*p); ++p) value = std::min<int64_t>(value * 10 + (*p - '0'), std::numeric_limits<int32_t>::max());
+    out = static_cast<int32_t>(negative ? -value : value);
+    return p;
+}
+
+template <size_t N>
+const char* parseFloats(const char* p, const char* end, float (&values)[N], size_t required) {
+    for (size_t i = 0; i < N; ++i) {
+        p = skipBlanks(p, end);
+        if (p >= end || *p == '\n') return i >= required ? p : nullptr;
+        p = parseFloat(p, end, values[i]);
+        if (!p) return nullptr;
+    }
+    return p;
+}
+
+inline std::string_view restOfLine(const char* p, const char* end) {
+    p = skipBlanks(p, end);
+    const char* lineEnd = p;
+    while (lineEnd < end && *lineEnd != '\n') ++lineEnd;
+    while (lineEnd > p && isBlank(lineEnd[-1])) --lineEnd;
+    return {p, static_cast<size_t>(lineEnd - p)};
+}
+
+inline bool keyword(const char* p, const char* end, std::string_view word) {
+    return static_cast<size_t>(end - p) > word.size() && std::memcmp(p, word.data(), word.size()) == 0 &&
+           isBlank(p[word.size()]);
+}
+
+// Stores an OBJ index (1-based, or negative relative to the current count).
+inline bool storeIndex(int32_t index, size_t localCount, int32_t& out, uint8_t& relative, uint8_t flag) {
+    if (index > 0) {
+        out = index - 1;
+    } else if (index < 0) {
+        out = static_cast<int32_t>(static_cast<int64_t>(localCount) + index);
+        relative |= flag;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+const char* parseFace(const char* p, const char* end, Chunk& chunk) {
+    const size_t before = chunk.corners.size();
+    while (true) {
+        p = skipBlanks(p, end);
+        if (p >= end || *p == '\n') break;
+        Corner corner{};
+        int32_t index = 0;
+        p = parseIndex(p, end, index);
+        if (!p || !storeIndex(index, chunk.positions.size(), corner.v, corner.relative, kRelativeV)) return nullptr;
+        if (p < end && *p == '/') {
+            ++p;
+            if (p < end && *p != '/') {
+                p = parseIndex(p, end, index);
+                if (!p || !storeIndex(index, chunk.texCoords.size(), corner.vt, corner.relative, kRelativeVt)) return nullptr;
+            }
+            if (p < end && *p == '/') {
+                p = parseIndex(p + 1, end, index);
+                if (!p || !storeIndex(index, chunk.normals.size(), corner.vn, corner.relative, kRelativeVn)) return nullptr;
+            }
+        }
+        chunk.corners.push_back(corner);
+    }
+    if (chunk.corners.size() - before < 3) return nullptr;
+    chunk.faceStart.push_back(static_cast<uint32_t>(chunk.corners.size()));
+    return p;
+}
+
+void parseChunk(Chunk& chunk) {
+    const char* p = chunk.text.data();
+    const char* const end = p + chunk.text.size();
+    chunk.corners.reserve(chunk.text.size() / 16);
+
+    while (p < end) {
+        const char* const line = p = skipBlanks(p, end);
+        const char* next = nullptr;
+        if (p >= end) break;
+        switch (*p) {
+        case 'v':
+            if (p + 1 < end && isBlank(p[1])) {
+                float xyz[3]{};
+                if ((next = parseFloats(p + 1, end, xyz, 3))) chunk.positions.push_back({xyz[0], xyz[1], xyz[2]});
+            } else if (p + 2 < end && p[1] == 'n' && isBlank(p[2])) {
+                float xyz[3]{};
+                if ((next = parseFloats(p + 2, end, xyz, 3))) chunk.normals.push_back({xyz[0], xyz[1], xyz[2]});
+            } else if (p + 2 < end && p[1] == 't' && isBlank(p[2])) {
+                float uv[2]{};
+                if ((next = parseFloats(p + 2, end, uv, 1))) chunk.texCoords.push_back({uv[0], uv[1]});
+            } else {
+                next = p;
+            }
+            break;
+        case 'f':
+            next = p + 1 < end && isBlank(p[1]) ? parseFace(p + 1, end, chunk) : p;
+            break;
+        case 'g':
+        case 'o':
+            if (p + 1 < end && (isBlank(p[1]) || p[1] == '\n')) {
+                chunk.markers.push_back({chunk.faceCount(), Marker::Kind::Group, std::string(restOfLine(p + 1, end))});
+            }
+            next = p;
+            break;
+        case 'u':
+            if (keyword(p, end, "usemtl")) {
+                chunk.markers.push_back({chunk.faceCount(), Marker::Kind::Material, std::string(restOfLine(p + 6, end))});
+            }
+            next = p;
+            break;
+        case 'm':
+            if (keyword(p, end, "mtllib")) chunk.materialLibraries.emplace_back(restOfLine(p + 6, end));
+            next = p;
+            break;
+        default:
+            // Comments, smoothing groups, lines, points and free-form geometry are ignored.
+            next = p;
+            break;
+        }
+        if (!next) {
+            chunk.errorOffset = static_cast<size_t>(line - chunk.text.data());
+            return;
+        }
+        p = skipLine(next, end);
+    }
+}
+
+// --- Vertex deduplication --------------------------------------------------
+
+// Open-addressing map from a resolved (v, vt, vn) triple to its output vertex.
+class CornerMap {
+public:
+    explicit CornerMap(size_t expected) {
+        size_t capacity = 64;
+        while (capacity < expected * 2) capacity *= 2;
+        m_slots.assign(capacity, Slot{});
+    }
+
+    // Returns the existing vertex for the triple, or inserts `next` and returns it.
+    uint32_t findOrInsert(int32_t v, int32_t vt, int32_t vn, uint32_t next) {
+        if ((m_size + 1) * 10 > m_slots.size() * 7) grow();
+        const size_t mask = m_slots.size() - 1;
+        for (size_t i = hash(v, vt, vn) & mask;; i = (i + 1) & mask) {
+            Slot& slot = m_slots[i];
+            if (slot.v == kAbsent) {
+                slot = {v, vt, vn, next};
+                ++m_size;
+                return next;
+            }
+            if (slot.v == v && slot.vt == vt && slot.vn == vn) return slot.vertex;
+        }
+    }
+
+private:
+    struct Slot {
+        int32_t v = kAbsent;
+        int32_t vt = 0;
+        int32_t vn = 0;
+        uint32_t vertex = 0;
+    };
+
+    static size_t hash(int32_t v, int32_t vt, int32_t vn) {
+        uint64_t h = static_cast<uint32_t>(v) * 0x9E3779B97F4A7C15ull;
+        h ^= static_cast<uint32_t>(vt) * 0xC2B2AE3D27D4EB4Full;
+        h ^= static_cast<uint32_t>(vn) * 0x165667B19E3779F9ull;
+        return static_cast<size_t>(h ^ (h >> 29));
+    }
+
+    void grow() {
+        std::vector<Slot> old(m_slots.size() * 2);
+        old.swap(m_slots);
+        const size_t mask = m_slots.size() - 1;
+        for (const Slot& slot : old) {
+            if (slot.v == kAbsent) continue;
+            size_t i = hash(slot.v, slot.vt, slot.vn) & mask;
+            while (m_slots[i].v != kAbsent) i = (i + 1) & mask;
+            m_slots[i] = slot;
+        }
+    }
+
+    std::vector<Slot> m_slots;
+    size_t m_size = 0;
+};
+
+// --- Triangulation ---------------------------------------------------------
+
+float cross2(const Vec2& a, const Vec2& b, const Vec2& c) {
+    return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+}
+
+// Appends triangles for a polygon given by its output vertex ids. Convex polygons (the
+// common case) are fanned; concave ones are ear-clipped in the plane of their Newell normal.
+void triangulate(const std::vector<uint32_t>& polygon, const std::vector<Vertex>& vertices,
+                 std::vector<Vec2>& projected, std::vector<uint32_t>& remaining, std::vector<uint32_t>& out) {
+    const size_t n = polygon.size();
+    const auto fan = [&] {
+        for (size_t i = 1; i + 1 < n; ++i) out.insert(out.end(), {polygon[0], polygon[i], polygon[i + 1]});
+    };
+    if (n == 3) {
+        out.insert(out.end(), {polygon[0], polygon[1], polygon[2]});
+        return;
+    }
+
+    Vec3 normal{0.0f, 0.0f, 0.0f};
+    for (size_t i = 0; i < n; ++i) {
+        const Vec3& a = vertices[polygon[i]].position;
+        const Vec3& b = vertices[polygon[(i + 1) % n]].position;
+        normal.x += (a.y - b.y) * (a.z + b.z);
+        normal.y += (a.z - b.z) * (a.x + b.x);
+        normal.z += (a.x - b.x) * (a.y + b.y);
+    }
+    // Drop the dominant axis; orient so the polygon winds counter-clockwise in 2D.
+    const float ax = std::fabs(normal.x), ay = std::fabs(normal.y), az = std::fabs(normal.z);
+    projected.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        const Vec3& p = vertices[polygon[i]].position;
+        if (ax >= ay && ax >= az) projected[i] = normal.x >= 0.0f ? Vec2{p.y, p.z} : Vec2{p.z, p.y};
+        else if (ay >= az) projected[i] = normal.y >= 0.0f ? Vec2{p.z, p.x} : Vec2{p.x, p.z};
+        else projected[i] = normal.z >= 0.0f ? Vec2{p.x, p.y} : Vec2{p.y, p.x};
+    }
+
+    bool convex = true;
+    for (size_t i = 0; i < n && convex; ++i) {
+        convex = cross2(projected[i], projected[(i + 1) % n], projected[(i + 2) % n]) >= 0.0f;
+    }
+    if (convex) {
+        fan();
+        return;
+    }
+
+    remaining.resize(n);
+    for (size_t i = 0; i < n; ++i) remaining[i] = static_cast<uint32_t>(i);
+    size_t guard = n * n;
+    for (size_t i = 0; remaining.size() > 3 && guard-- > 0;) {
+        const size_t count = remaining.size();
+        const uint32_t prev = remaining[(i + count - 1) % count];
+        const uint32_t curr = remaining[i % count];
+        const uint32_t next = remaining[(i + 1) % count];
+        bool ear = cross2(projected[prev], projected[curr], projected[next]) > 0.0f;
+        for (size_t j = 0; ear && j < count; ++j) {
+            const uint32_t k = remaining[j];
+            if (k == prev || k == curr || k == next) continue;
+            ear = !(cross2(projected[prev], projected[curr], projected[k]) >= 0.0f &&
+                    cross2(projected[curr], projected[next], projected[k]) >= 0.0f &&
+                    cross2(projected[next], projected[prev], projected[k]) >= 0.0f);
+        }
+        if (ear) {
+            out.insert(out.end(), {polygon[prev], polygon[curr], polygon[next]});
+            remaining.erase(remaining.begin() + static_cast<std::ptrdiff_t>(i % count));
+        } else {
+            ++i;
+        }
+    }
+    if (remaining.size() == 3) {
+        out.insert(out.end(), {polygon[remaining[0]], polygon[remaining[1]], polygon[remaining[2]]});
+    } else {
+        // Self-intersecting or degenerate outline: fall back to a fan over what is left.
+        for (size_t i = 1; i + 1 < remaining.size(); ++i) {
+            out.insert(out.end(), {polygon[remaining[0]], polygon[remaining[i]], polygon[remaining[i + 1]]});
+        }
+    }
+}
+
+// --- Stitching -------------------------------------------------------------
+
+struct FaceRun {
+    uint32_t chunk = 0;
+    uint32_t firstFace = 0;
+    uint32_t endFace = 0;
+};
+
+// Splits the text into about `count` slices ending on line boundaries.
+std::vector<Chunk> splitChunks(std::string_view text, size_t count) {
+    std::vector<Chunk> chunks;
+    chunks.reserve(count);
+    size_t begin = 0;
+    for (size_t i = 1; i <= count && begin < text.size(); ++i) {
+        size_t end = i == count ? text.size() : std::max(begin, text.size() * i / count);
+        if (end < text.size()) {
+            const size_t newline = text.find('\n', end);
+            end = newline == std::string_view::npos ? text.size() : newline + 1;
+        }
+        if (end > begin) {
+            chunks.emplace_back();
+            chunks.back().text = text.substr(begin, end - begin);
+        }
+        begin = end;
+    }
+    return chunks;
+}
+
+bool resolve(int32_t& index, bool relative, int64_t offset, size_t total) {
+    if (index == kAbsent) return true;
+    const int64_t global = relative ? offset + index : index;
+    if (global < 0 || global >= static_cast<int64_t>(total)) return false;
+    index = static_cast<int32_t>(global);
+    return true;
+}
+
+} // namespace
+
+std::optional<ObjMesh> ObjImporter::importText(std::string_view text, const ObjImportOptions& options, ObjImportStats* stats) {
+    const auto begin = ImportClock::now();
+    const unsigned available = options.pool ? static_cast<unsigned>(options.pool->workerCount()) + 1
+                                            : std::max(1u, std::thread::hardware_concurrency());
+    const unsigned threads = options.threadCount ? options.threadCount : available;
+    const size_t chunkTarget = std::clamp<size_t>(text.size() / std::max<size_t>(1, options.minChunkBytes), 1, size_t{threads} * 4);
+
+    // Parse: workers pull chunks until none are left; the calling thread is one of them. Pool
+    // helpers may start after the caller has parsed everything, so the chunks live in shared state
+    // and the caller waits on the finished count rather than on the helper tasks.
+    struct ParseState {
+        std::vector<Chunk> chunks;
+        std::atomic<size_t> next{0};
+        std::atomic<size_t> done{0};
+    };
+    const auto state = std::make_shared<ParseState>();
+    state->chunks = splitChunks(text, chunkTarget);
+    const auto worker = [](ParseState& parse) {
+        size_t parsed = 0;
+        for (size_t i = parse.next++; i < parse.chunks.size(); i = parse.next++, ++parsed) parseChunk(parse.chunks[i]);
+        if (parsed != 0 && parse.done.fetch_add(parsed) + parsed == parse.chunks.size()) parse.done.notify_all();
+    };
+    std::vector<Chunk>& chunks = state->chunks;
+    const unsigned workerCount = static_cast<unsigned>(std::min<size_t>(threads, chunks.size()));
+    if (options.pool) {
+        for (unsigned i = 1; i < workerCount; ++i) options.pool->submit([state, worker] { worker(*state); });
+        worker(*state);
+        for (size_t done = state->done.load(); done < chunks.size(); done = state->done.load()) state->done.wait(done);
+    } else {
+        std::vector<std::thread> helpers;
+        helpers.reserve(workerCount > 0 ? workerCount - 1 : 0);
+        for (unsigned i = 1; i < workerCount; ++i) helpers.emplace_back([&] { worker(*state); });
+        worker(*state);
+        for (std::thread& helper : helpers) helper.join();
+    }
+    const auto parsed = ImportClock::now();
+
+    size_t textOffset = 0;
+    for (const Chunk& chunk : chunks) {
+        if (chunk.errorOffset != std::string_view::npos) {
+            const size_t at = textOffset + chunk.errorOffset;
+            const size_t line = 1 + static_cast<size_t>(std::count(text.begin(), text.begin() + static_cast<std::ptrdiff_t>(at), '\n'));
+            Logger::error("OBJ parse error at line {}", line);
+            return std::nullopt;
+        }
+        textOffset += chunk.text.size();
+    }
+
+    // Stitch attribute streams and resolve indices to global positions.
+    std::vector<Vec3> positions;
+    std::vector<Vec3> normals;
+    std::vector<Vec2> texCoords;
+    std::vector<int64_t> positionBase, normalBase, texCoordBase;
+    size_t cornerCount = 0;
+    size_t faceCount = 0;
+    for (const Chunk& chunk : chunks) {
+        positionBase.push_back(static_cast<int64_t>(positions.size()));
+        normalBase.push_back(static_cast<int64_t>(normals.size()));
+        texCoordBase.push_back(static_cast<int64_t>(texCoords.size()));
+        positions.insert(positions.end(), chunk.positions.begin(), chunk.positions.end());
+        normals.insert(normals.end(), chunk.normals.begin(), chunk.normals.end());
+        texCoords.insert(texCoords.end(), chunk.texCoords.begin(), chunk.texCoords.end());
+        cornerCount += chunk.corners.size();
+        faceCount += chunk.faceCount();
+    }
+    for (size_t c = 0; c < chunks.size(); ++c) {
+        for (Corner& corner : chunks[c].corners) {
+            if (!resolve(corner.v, corner.relative & kRelativeV, positionBase[c], positions.size()) ||
+                !resolve(corner.vt, corner.relative & kRelativeVt, texCoordBase[c], texCoords.size()) ||
+                !resolve(corner.vn, corner.relative & kRelativeVn, normalBase[c], normals.size())) {
+                Logger::error("OBJ face index out of range");
+                return std::nullopt;
+            }
+        }
+    }
+
+    // Group face runs by (group, material) in order of first use.
+    ObjMesh mesh;
+    std::vector<std::vector<FaceRun>> runs;
+    std::unordered_map<std::string, uint32_t> submeshIds;
+    std::string group;
+    std::string material;
+    uint32_t current = UINT32_MAX;
+    const auto select = [&] {
+        auto [it, inserted] = submeshIds.try_emplace(group + '\0' + material, static_cast<uint32_t>(runs.size()));
+        if (inserted) {
+            runs.emplace_back();
+            mesh.submeshes.push_back({group, material, 0, 0});
+        }
+        current = it->second;
+    };
+    for (uint32_t c = 0; c < chunks.size(); ++c) {
+        const Chunk& chunk = chunks[c];
+        mesh.materialLibraries.insert(mesh.materialLibraries.end(), chunk.materialLibraries.begin(), chunk.materialLibraries.end());
+        uint32_t face = 0;
+        const auto flush = [&](uint32_t endFace) {
+            if (endFace == face) return;
+            if (current == UINT32_MAX) select();
+            runs[current].push_back({c, face, endFace});
+            face = endFace;
+        };
+        for (const Marker& marker : chunk.markers) {
+            flush(marker.face);
+            (marker.kind == Marker::Kind::Group ? group : material) = marker.name;
+            current = UINT32_MAX;
+        }
+        flush(chunk.faceCount());
+    }
+
+    // Emit submesh by submesh, deduplicating corners and triangulating polygons.
+    mesh.vertices.reserve(std::min(cornerCount, positions.size() * 2));
+    mesh.indices.reserve(cornerCount * 3 / 2);
+    CornerMap unique(std::min(cornerCount, positions.size() * 2));
+    std::vector<uint32_t> polygon;
+    std::vector<Vec2> projected;
+    std::vector<uint32_t> remaining;
+    for (size_t s = 0; s < runs.size(); ++s) {
+        mesh.submeshes[s].firstIndex = static_cast<uint32_t>(mesh.indices.size());
+        for (const FaceRun& run : runs[s]) {
+            const Chunk& chunk = chunks[run.chunk];
+            for (uint32_t f = run.firstFace; f < run.endFace; ++f) {
+                polygon.clear();
+                for (uint32_t k = chunk.faceStart[f]; k < chunk.faceStart[f + 1]; ++k) {
+                    const Corner& corner = chunk.corners[k];
+                    const uint32_t next = static_cast<uint32_t>(mesh.vertices.size());
+                    const uint32_t vertex = unique.findOrInsert(corner.v, corner.vt, corner.vn, next);
+                    if (vertex == next) {
+                        Vertex out{};
+                        out.position = positions[static_cast<size_t>(corner.v)];
+                        if (corner.vn != kAbsent) out.normal = normals[static_cast<size_t>(corner.vn)];
+                        if (corner.vt != kAbsent) out.texCoords = texCoords[static_cast<size_t>(corner.vt)];
+                        mesh.vertices.push_back(out);
+                    }
+                    polygon.push_back(vertex);
+                }
+                triangulate(polygon, mesh.vertices, projected, remaining, mesh.indices);
+            }
+        }
+        mesh.submeshes[s].indexCount = static_cast<uint32_t>(mesh.indices.size()) - mesh.submeshes[s].firstIndex;
+    }
+    const auto built = ImportClock::now();
+
+    if (stats) {
+        stats->bytes = text.size();
+        stats->chunks = static_cast<uint32_t>(chunks.size());
+        stats->threads = workerCount;
+        stats->faces = faceCount;
+        stats->faceCorners = cornerCount;
+        stats->triangles = mesh.indices.size() / 3;
+        stats->vertices = mesh.vertices.size();
+        stats->parseMs = elapsedMs(begin, parsed);
+        stats->buildMs = elapsedMs(parsed, built);
+        stats->totalMs = elapsedMs(begin, built);
+    }
+    return mesh;
+}
+
+std::optional<ObjMesh> ObjImporter::importFile(const std::string& path, const ObjImportOptions& options, ObjImportStats* stats) {
+    const auto begin = ImportClock::now();
+    const core::platform::VfsFile file = core::platform::VirtualFileSystem::instance().open(path);
+    if (!file.valid()) {
+        Logger::error("Failed to open model file: {}", path);
+        return std::nullopt;
+    }
+    file.prefetch();
+    const std::span<const std::byte> bytes = file.bytes();
+    ObjImportStats local{};
+    auto mesh = importText({reinterpret_cast<const char*>(bytes.data()), bytes.size()}, options, &local);
+    if (!mesh) {
+        Logger::error("Failed to parse model file: {}", path);
+        return std::nullopt;
+    }
+    local.totalMs = elapsedMs(begin, ImportClock::now());
+    REX_LOG_TRACE("Imported {}: {:.1f} MB in {:.1f} ms ({:.0f} MB/s, {} threads), {} triangles, {} vertices from {} corners",
+                  path, static_cast<double>(local.bytes) / (1024.0 * 1024.0), local.totalMs, local.megabytesPerSecond(),
+                  local.threads, local.triangles, local.vertices, local.faceCorners);
+    if (stats) *stats = local;
+    return mesh;
+}
+
+}
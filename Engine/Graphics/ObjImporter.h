@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Mesh.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace rex::core::job {
+class ThreadPool;
+}
+
+namespace rex::gfx {
+
+struct ObjImportOptions {
+    // Parsers including the calling thread; 0 uses the pool's workers plus the caller, or the
+    // hardware concurrency without a pool.
+    unsigned threadCount = 0;
+    // When set, helpers are pool tasks instead of new threads. The caller parses too and never
+    // waits for a helper to start, so importing from one of the pool's own jobs cannot deadlock.
+    core::job::ThreadPool* pool = nullptr;
+    // Smallest slice of the file handed to one parser task. Small files parse on one thread.
+    size_t minChunkBytes = 256 * 1024;
+};
+
+// One (group, material) pair. Faces are emitted grouped by submesh, in order of first use,
+// so every submesh is a single contiguous index range.
+struct ObjSubmesh {
+    std::string group;
+    std::string material;
+    uint32_t firstIndex = 0;
+    uint32_t indexCount = 0;
+};
+
+struct ObjMesh {
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    std::vector<ObjSubmesh> submeshes;
+    // `mtllib` names in file order, as written (relative to the OBJ).
+    std::vector<std::string> materialLibraries;
+};
+
+struct ObjImportStats {
+    size_t bytes = 0;
+    uint32_t chunks = 0;
+    uint32_t threads = 0;
+    uint64_t faces = 0;
+    uint64_t faceCorners = 0;
+    uint64_t triangles = 0;
+    // Unique (v, vt, vn) triples after deduplication.
+    uint64_t vertices = 0;
+    double parseMs = 0.0;
+    double buildMs = 0.0;
+    double totalMs = 0.0;
+
+    double megabytesPerSecond() const {
+        return totalMs > 0.0 ? static_cast<double>(bytes) / (1024.0 * 1024.0) / (totalMs / 1000.0) : 0.0;
+    }
+};
+
+// Wavefront OBJ importer. The file is mapped and split at line boundaries into chunks that are
+// parsed in parallel; the chunks are then stitched (relative indices resolved), faces are
+// triangulated (fan for convex polygons, ear clipping otherwise), and face corners are
+// deduplicated on their (v, vt, vn) triple so shared corners share one vertex.
+// Missing normals or texture coordinates are left zero.
+class ObjImporter {
+public:
+    static std::optional<ObjMesh> importFile(const std::string& path,
+                                             const ObjImportOptions& options = {},
+                                             ObjImportStats* stats = nullptr);
+    static std::optional<ObjMesh> importText(std::string_view text,
+                                             const ObjImportOptions& options = {},
+                                             ObjImportStats* stats = nullptr);
+};
+
+}
@@ -1,7 +1,7 @@
 #include "DeferredPipeline.h"
 
 #include "../Core/RenderDevice.h"
-#include "../Model.h"
+#include "../../Core/Logger.h"
 
 #include <algorithm>
 #include <cmath>
@@ -50,6 +50,7 @@ DeferredPipeline::DeferredPipeline()
     , m_lightingPass(*this)
     , m_postProcessPass(*this)
     , m_uiPass(*this) {
+    m_graph.setProfiler(&m_passProfiler);
     initScreenTriangle();
     initShaders();
 
@@ -80,7 +81,7 @@ void DeferredPipeline::initScreenTriangle() {
     glGenBuffers(1, &m_screenVBO);
     glBindVertexArray(m_screenVAO);
     glBindBuffer(GL_ARRAY_BUFFER, m_screenVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(verts), verts, GL_STATIC_DRAW);
+    RenderDevice::bufferData(GL_ARRAY_BUFFER, sizeof(verts), verts, GL_STATIC_DRAW);
     glEnableVertexAttribArray(0);
     glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
     glEnableVertexAttribArray(1);
@@ -98,14 +99,24 @@ void DeferredPipeline::initShaders() {
         uniform mat4 model;
         uniform mat4 view;
         uniform mat4 proj;
+        // Packed meshes store normals octahedrally in aNormal.xy.
+        uniform int uOctNormals;
 
         out vec3 vWorldPos;
         out vec3 vNormal;
 
+        vec3 octDecode(vec2 e) {
+            vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+            float t = max(-n.z, 0.0);
+            n.xy += vec2(n.x >= 0.0 ? -t : t, n.y >= 0.0 ? -t : t);
+            return normalize(n);
+        }
+
         void main() {
             vec4 world = model * vec4(aPos, 1.0);
             vWorldPos = world.xyz;
-            vNormal = mat3(transpose(inverse(model))) * aNormal;
+            vec3 normal = uOctNormals != 0 ? octDecode(aNormal.xy) : aNormal;
+            vNormal = mat3(transpose(inverse(model))) * normal;
             gl_Position = proj * view * world;
         }
     )";
@@ -349,6 +360,31 @@ void DeferredPipeline::initShaders() {
     m_lightingShader = std::make_unique<Shader>(lightingVS, lightingFS);
 }
 
+bool DeferredPipeline::replaceShader(const std::string& name, std::string vertexSrc, std::string fragmentSrc) {
+    if (name != "gbuffer" && name != "lighting") return false;
+    std::lock_guard<std::mutex> lock(m_pendingShaderMutex);
+    m_pendingShaders.push_back({name, std::move(vertexSrc), std::move(fragmentSrc)});
+    return true;
+}
+
+void DeferredPipeline::applyPendingShaders() {
+    std::vector<PendingShader> pending;
+    {
+        std::lock_guard<std::mutex> lock(m_pendingShaderMutex);
+        if (m_pendingShaders.empty()) return;
+        pending.swap(m_pendingShaders);
+    }
+    for (PendingShader& entry : pending) {
+        auto shader = std::make_unique<Shader>(entry.vertexSrc, entry.fragmentSrc);
+        if (!shader->isLinked()) {
+            Logger::warn("Keeping the previous {} program", entry.name);
+            continue;
+        }
+        (entry.name == "gbuffer" ? m_gbufferShader : m_lightingShader) = std::move(shader);
+        Logger::info("Reloaded {} program", entry.name);
+    }
+}
+
 void DeferredPipeline::ensureResources(int width, int height) {
     if (width <= 0 || height <= 0) return;
 
@@ -408,18 +444,27 @@ Vec3 DeferredPipeline::cameraForward(const Mat4& viewMatrix) const {
 void DeferredPipeline::render(RenderFrameContext& ctx) {
     if (ctx.targetWidth <= 0 || ctx.targetHeight <= 0) return;
 
+    applyPendingShaders();
     ensureResources(ctx.targetWidth, ctx.targetHeight);
 
+    // Release last frame's lists before rewinding the memory they point into.
+    const std::size_t lastVisibleCount = m_visible.size();
+    m_visible = VisibleList(m_frameMemory.resource());
+    m_activeLights = LightList(m_frameMemory.resource());
+    m_frameMemory.beginFrame();
+    m_visible.reserve(lastVisibleCount);
+
     m_lightManager.gatherFromScene(ctx.scene);
-    m_activeLights = m_lightCuller.cullForView(m_lightManager.lights(), ctx.viewPos, kMaxShaderLights);
+    m_lightCuller.cullForView(m_lightManager.lights(), ctx.viewPos, kMaxShaderLights, m_activeLights);
 
-    m_visible = m_frustumCuller.collectVisible(ctx.scene,
-                                               ctx.viewPos,
-                                               cameraForward(ctx.viewMatrix),
-                                               ctx.camera.fov,
-                                               ctx.camera.aspect,
-                                               ctx.camera.nearPlane,
-                                               ctx.camera.farPlane);
+    m_frustumCuller.collectVisible(ctx.scene,
+                                   ctx.viewPos,
+                                   cameraForward(ctx.viewMatrix),
+                                   ctx.camera.fov,
+                                   ctx.camera.aspect,
+                                   ctx.camera.nearPlane,
+                                   ctx.camera.farPlane,
+                                   m_visible);
 
     m_graph.clear();
     m_graph.addPass(m_shadowPass);
@@ -452,9 +497,18 @@ void DeferredPipeline::executeGBufferPass(RenderFrameContext& ctx) {
     m_gbufferShader->bind();
     m_gbufferShader->setUniform("view", ctx.viewMatrix);
     m_gbufferShader->setUniform("proj", ctx.projMatrix);
+    int octNormals = 0;
+    m_gbufferShader->setUniform("uOctNormals", octNormals);
 
     for (const auto& item : m_visible) {
-        if (!item.transform || !item.renderer) continue;
+        if (!item.transform || !item.renderer || !item.mesh) continue;
+
+        const VertexFormat format = item.mesh->vertexFormat();
+        const int wantOctNormals = format == VertexFormat::Float32 ? 0 : 1;
+        if (wantOctNormals != octNormals) {
+            octNormals = wantOctNormals;
+            m_gbufferShader->setUniform("uOctNormals", octNormals);
+        }
 
         const Mat4 model = item.transform->getMatrix();
         m_gbufferShader->setUniform("model", model);
@@ -463,17 +517,13 @@ void DeferredPipeline::executeGBufferPass(RenderFrameContext& ctx) {
         m_gbufferShader->setUniform("uMetallic", item.renderer->metallic);
         m_gbufferShader->setUniform("uAO", item.renderer->ao);
 
-        if (item.renderer->model) {
-            item.renderer->model->draw();
-        } else if (item.renderer->mesh) {
-            item.renderer->mesh->draw();
-        }
+        item.mesh->draw(item.lod);
     }
 
     RenderDevice::setCullFace(false);
 }
 
-void DeferredPipeline::bindLightUniforms(const std::vector<RuntimeLight>& lights,
+void DeferredPipeline::bindLightUniforms(const LightList& lights,
                                          const std::array<Mat4, ShadowSystem::kMaxCascades>& cascadeMatrices,
                                          const std::array<Vec4, ShadowSystem::kMaxCascades>& cascadeRects,
                                          const std::array<float, ShadowSystem::kMaxCascades>& cascadeSplits,
@@ -534,18 +584,12 @@ void DeferredPipeline::executeLightingPass(RenderFrameContext& ctx) {
     m_lightingShader->setUniform("uShadowAtlas", 5);
     m_lightingShader->setUniform("uUseSSAO", m_ssaoTexture ? 1 : 0);
 
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, m_gbuffer.colorTexture(0));
-    glActiveTexture(GL_TEXTURE1);
-    glBindTexture(GL_TEXTURE_2D, m_gbuffer.colorTexture(1));
-    glActiveTexture(GL_TEXTURE2);
-    glBindTexture(GL_TEXTURE_2D, m_gbuffer.colorTexture(2));
-    glActiveTexture(GL_TEXTURE3);
-    glBindTexture(GL_TEXTURE_2D, m_gbuffer.colorTexture(3));
-    glActiveTexture(GL_TEXTURE4);
-    glBindTexture(GL_TEXTURE_2D, m_ssaoTexture ? m_ssaoTexture : m_whiteTexture);
-    glActiveTexture(GL_TEXTURE5);
-    glBindTexture(GL_TEXTURE_2D, m_shadowSystem.shadowAtlasTexture() ? m_shadowSystem.shadowAtlasTexture() : m_whiteTexture);
+    RenderDevice::bindTexture(0, m_gbuffer.colorTexture(0));
+    RenderDevice::bindTexture(1, m_gbuffer.colorTexture(1));
+    RenderDevice::bindTexture(2, m_gbuffer.colorTexture(2));
+    RenderDevice::bindTexture(3, m_gbuffer.colorTexture(3));
+    RenderDevice::bindTexture(4, m_ssaoTexture ? m_ssaoTexture : m_whiteTexture);
+    RenderDevice::bindTexture(5, m_shadowSystem.shadowAtlasTexture() ? m_shadowSystem.shadowAtlasTexture() : m_whiteTexture);
 
     bindLightUniforms(m_activeLights,
                       m_shadowSystem.cascadeMatrices(),
@@ -554,9 +598,9 @@ void DeferredPipeline::executeLightingPass(RenderFrameContext& ctx) {
                       static_cast<float>(m_shadowSystem.atlasResolution()),
                       ctx.viewPos);
 
-    glBindVertexArray(m_screenVAO);
-    glDrawArrays(GL_TRIANGLES, 0, 3);
-    glBindVertexArray(0);
+    RenderDevice::bindVertexArray(m_screenVAO);
+    RenderDevice::drawArrays(GL_TRIANGLES, 0, 3);
+    RenderDevice::bindVertexArray(0);
 
     if (ctx.extraDraw) {
         ctx.extraDraw(ctx.viewMatrix, ctx.projMatrix);
@@ -1,6 +1,8 @@
 #pragma once
 
+#include "../../Core/Memory/MemoryResource.h"
 #include "../Core/RenderGraph.h"
+#include "../Core/RenderPassProfiler.h"
 #include "../Core/FrameBuffer.h"
 #include "../Culling/FrustumCuller.h"
 #include "../Culling/LightCuller.h"
@@ -12,6 +14,8 @@
 
 #include <array>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <vector>
 
 namespace rex::gfx {
@@ -23,9 +27,27 @@ public:
 
     void render(RenderFrameContext& ctx);
 
+    // Library that MeshRenderer::meshHandle refers to; handles draw nothing (or their placeholder)
+    // without one.
+    void setMeshLibrary(const MeshLibrary* meshes) {
+        m_frustumCuller.setMeshLibrary(meshes);
+        m_shadowSystem.setMeshLibrary(meshes);
+    }
+
+    // Hot reload: queues new sources for the "gbuffer" or "lighting" program. Safe from any thread;
+    // the GL thread compiles them at the start of the next render and swaps the program only if it
+    // links. False for any other name.
+    bool replaceShader(const std::string& name, std::string vertexSrc, std::string fragmentSrc);
+
     PostProcessPipeline& postProcess() { return m_postProcess; }
     const PostProcessPipeline& postProcess() const { return m_postProcess; }
 
+    // Per-pass CPU/GPU timings; GPU results trail rendering by a few frames.
+    RenderPassProfiler& passProfiler() { return m_passProfiler; }
+    const RenderPassProfiler& passProfiler() const { return m_passProfiler; }
+    // Culling/light lists of the last frame; read on the render thread or while it is idle.
+    const core::memory::FrameMemoryResource& frameMemory() const { return m_frameMemory; }
+
 private:
     class ShadowPass : public RenderPass {
     public:
@@ -89,6 +111,7 @@ private:
 
     void ensureResources(int width, int height);
     void initShaders();
+    void applyPendingShaders();
     void initScreenTriangle();
 
     Vec3 cameraForward(const Mat4& viewMatrix) const;
@@ -99,7 +122,7 @@ private:
     void executePostProcessPass(RenderFrameContext& ctx);
     void executeUiPass(RenderFrameContext& ctx);
 
-    void bindLightUniforms(const std::vector<RuntimeLight>& lights,
+    void bindLightUniforms(const LightList& lights,
                            const std::array<Mat4, ShadowSystem::kMaxCascades>& cascadeMatrices,
                            const std::array<Vec4, ShadowSystem::kMaxCascades>& cascadeRects,
                            const std::array<float, ShadowSystem::kMaxCascades>& cascadeSplits,
@@ -107,6 +130,7 @@ private:
                            const Vec3& viewPos);
 
     RenderGraph m_graph;
+    RenderPassProfiler m_passProfiler;
 
     LightManager m_lightManager;
     LightCuller m_lightCuller;
@@ -122,6 +146,14 @@ private:
     std::unique_ptr<Shader> m_gbufferShader;
     std::unique_ptr<Shader> m_lightingShader;
 
+    struct PendingShader {
+        std::string name;
+        std::string vertexSrc;
+        std::string fragmentSrc;
+    };
+    std::mutex m_pendingShaderMutex;
+    std::vector<PendingShader> m_pendingShaders;
+
     uint32_t m_screenVAO = 0;
     uint32_t m_screenVBO = 0;
 
@@ -132,8 +164,11 @@ private:
     int m_width = 0;
     int m_height = 0;
 
-    std::vector<VisibleRenderable> m_visible;
-    std::vector<RuntimeLight> m_activeLights;
+    // Per-frame lists live in frame memory; declared first so it outlives them.
+    static constexpr std::size_t kFrameMemoryBytes = 2 * 1024 * 1024;
+    core::memory::FrameMemoryResource m_frameMemory{kFrameMemoryBytes};
+    VisibleList m_visible{m_frameMemory.resource()};
+    LightList m_activeLights{m_frameMemory.resource()};
 
     ShadowPass m_shadowPass;
     GBufferPass m_gbufferPass;
@@ -1,5 +1,7 @@
 #include "BloomPass.h"
 
+#include "../Core/RenderDevice.h"
+
 #include <algorithm>
 
 namespace rex::gfx {
@@ -92,7 +94,7 @@ uint32_t BloomPass::execute(uint32_t hdrTexture, uint32_t screenVAO) {
 
     glDisable(GL_DEPTH_TEST);
 
-    glBindFramebuffer(GL_FRAMEBUFFER, m_brightPass.id());
+    RenderDevice::bindFramebuffer(m_brightPass.id());
     glViewport(0, 0, bloomW, bloomH);
     glClearColor(0, 0, 0, 1);
     glClear(GL_COLOR_BUFFER_BIT);
@@ -100,11 +102,10 @@ uint32_t BloomPass::execute(uint32_t hdrTexture, uint32_t screenVAO) {
     m_extractShader->bind();
     m_extractShader->setUniform("uSource", 0);
     m_extractShader->setUniform("uThreshold", 1.0f);
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, hdrTexture);
+    RenderDevice::bindTexture(0, hdrTexture);
 
-    glBindVertexArray(screenVAO);
-    glDrawArrays(GL_TRIANGLES, 0, 3);
+    RenderDevice::bindVertexArray(screenVAO);
+    RenderDevice::drawArrays(GL_TRIANGLES, 0, 3);
 
     bool horizontal = true;
     uint32_t source = m_brightPass.colorTexture(0);
@@ -113,7 +114,7 @@ uint32_t BloomPass::execute(uint32_t hdrTexture, uint32_t screenVAO) {
     for (int i = 0; i < blurPasses; ++i) {
         FrameBuffer& target = horizontal ? m_ping : m_pong;
 
-        glBindFramebuffer(GL_FRAMEBUFFER, target.id());
+        RenderDevice::bindFramebuffer(target.id());
         glViewport(0, 0, bloomW, bloomH);
 
         m_blurShader->bind();
@@ -121,16 +122,15 @@ uint32_t BloomPass::execute(uint32_t hdrTexture, uint32_t screenVAO) {
         m_blurShader->setUniform("uHorizontal", horizontal ? 1 : 0);
         m_blurShader->setUniform("uTexelSize", Vec3{1.0f / float(bloomW), 1.0f / float(bloomH), 0.0f});
 
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, source);
+        RenderDevice::bindTexture(0, source);
 
-        glDrawArrays(GL_TRIANGLES, 0, 3);
+        RenderDevice::drawArrays(GL_TRIANGLES, 0, 3);
 
         source = target.colorTexture(0);
         horizontal = !horizontal;
     }
 
-    glBindVertexArray(0);
+    RenderDevice::bindVertexArray(0);
     return source;
 }
 
@@ -1,5 +1,7 @@
 #include "SSAOPass.h"
 
+#include "../Core/RenderDevice.h"
+
 #include <algorithm>
 #include <cmath>
 #include <random>
@@ -186,7 +188,7 @@ uint32_t SSAOPass::execute(uint32_t gPosition,
 
     glDisable(GL_DEPTH_TEST);
 
-    glBindFramebuffer(GL_FRAMEBUFFER, m_ssaoBuffer.id());
+    RenderDevice::bindFramebuffer(m_ssaoBuffer.id());
     glViewport(0, 0, width, height);
     glClearColor(1, 1, 1, 1);
     glClear(GL_COLOR_BUFFER_BIT);
@@ -203,17 +205,14 @@ uint32_t SSAOPass::execute(uint32_t gPosition,
         m_ssaoShader->setUniform(name, m_kernel[i]);
     }
 
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, gPosition);
-    glActiveTexture(GL_TEXTURE1);
-    glBindTexture(GL_TEXTURE_2D, gNormal);
-    glActiveTexture(GL_TEXTURE2);
-    glBindTexture(GL_TEXTURE_2D, m_noiseTex);
+    RenderDevice::bindTexture(0, gPosition);
+    RenderDevice::bindTexture(1, gNormal);
+    RenderDevice::bindTexture(2, m_noiseTex);
 
-    glBindVertexArray(screenVAO);
-    glDrawArrays(GL_TRIANGLES, 0, 3);
+    RenderDevice::bindVertexArray(screenVAO);
+    RenderDevice::drawArrays(GL_TRIANGLES, 0, 3);
 
-    glBindFramebuffer(GL_FRAMEBUFFER, m_blurBuffer.id());
+    RenderDevice::bindFramebuffer(m_blurBuffer.id());
     glViewport(0, 0, width, height);
     glClear(GL_COLOR_BUFFER_BIT);
 
@@ -221,11 +220,10 @@ uint32_t SSAOPass::execute(uint32_t gPosition,
     m_blurShader->setUniform("uAO", 0);
     m_blurShader->setUniform("uTexel", Vec3{1.0f / float(width), 1.0f / float(height), 0.0f});
 
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, m_ssaoBuffer.colorTexture(0));
+    RenderDevice::bindTexture(0, m_ssaoBuffer.colorTexture(0));
 
-    glDrawArrays(GL_TRIANGLES, 0, 3);
-    glBindVertexArray(0);
+    RenderDevice::drawArrays(GL_TRIANGLES, 0, 3);
+    RenderDevice::bindVertexArray(0);
 
     return m_blurBuffer.colorTexture(0);
 }
@@ -1,5 +1,7 @@
 #include "ToneMappingPass.h"
 
+#include "../Core/RenderDevice.h"
+
 namespace rex::gfx {
 
 ToneMappingPass::ToneMappingPass() {
@@ -67,7 +69,7 @@ void ToneMappingPass::execute(uint32_t hdrTexture,
                               float exposure,
                               float bloomStrength,
                               uint32_t colorLUT) {
-    glBindFramebuffer(GL_FRAMEBUFFER, targetFBO);
+    RenderDevice::bindFramebuffer(targetFBO);
     glViewport(0, 0, width, height);
     glDisable(GL_DEPTH_TEST);
 
@@ -79,18 +81,13 @@ void ToneMappingPass::execute(uint32_t hdrTexture,
     m_shader->setUniform("uColorLUT", 2);
     m_shader->setUniform("uUseLUT", colorLUT ? 1 : 0);
 
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, hdrTexture);
-
-    glActiveTexture(GL_TEXTURE1);
-    glBindTexture(GL_TEXTURE_2D, bloomTexture);
-
-    glActiveTexture(GL_TEXTURE2);
-    glBindTexture(GL_TEXTURE_2D, colorLUT ? colorLUT : bloomTexture);
+    RenderDevice::bindTexture(0, hdrTexture);
+    RenderDevice::bindTexture(1, bloomTexture);
+    RenderDevice::bindTexture(2, colorLUT ? colorLUT : bloomTexture);
 
-    glBindVertexArray(screenVAO);
-    glDrawArrays(GL_TRIANGLES, 0, 3);
-    glBindVertexArray(0);
+    RenderDevice::bindVertexArray(screenVAO);
+    RenderDevice::drawArrays(GL_TRIANGLES, 0, 3);
+    RenderDevice::bindVertexArray(0);
 }
 
 } // namespace rex::gfx
@@ -1,5 +1,7 @@
 #include "Renderer.h"
 
+#include "Core/RenderDevice.h"
+
 namespace rex {
 
 Renderer::Renderer() {
@@ -31,6 +33,7 @@ void Renderer::render(Scene& scene,
     };
 
     m_deferred->render(ctx);
+    gfx::RenderDevice::endFrame();
 }
 
 } // namespace rex
@@ -1,4 +1,5 @@
 #include "Shader.h"
+#include "Core/RenderDevice.h"
 #include "../Core/Logger.h"
 #include <vector>
 
@@ -15,6 +16,7 @@ Shader::Shader(const std::string& v, const std::string& f) {
     
     int success;
     glGetProgramiv(m_id, GL_LINK_STATUS, &success);
+    m_linked = success != 0;
     if (!success) {
         char info[512];
         glGetProgramInfoLog(m_id, 512, nullptr, info);
@@ -27,14 +29,14 @@ Shader::Shader(const std::string& v, const std::string& f) {
 
 Shader::~Shader() { glDeleteProgram(m_id); }
 
-void Shader::bind() const { glUseProgram(m_id); }
-void Shader::unbind() const { glUseProgram(0); }
+void Shader::bind() const { gfx::RenderDevice::useProgram(m_id); }
+void Shader::unbind() const { gfx::RenderDevice::useProgram(0); }
 
-void Shader::setUniform(const std::string& n, int v) { glUniform1i(glGetUniformLocation(m_id, n.c_str()), v); }
-void Shader::setUniform(const std::string& n, float v) { glUniform1f(glGetUniformLocation(m_id, n.c_str()), v); }
-void Shader::setUniform(const std::string& n, const Vec3& v) { glUniform3f(glGetUniformLocation(m_id, n.c_str()), v.x, v.y, v.z); }
-void Shader::setUniform(const std::string& n, const Vec4& v) { glUniform4f(glGetUniformLocation(m_id, n.c_str()), v.x, v.y, v.z, v.w); }
-void Shader::setUniform(const std::string& n, const Mat4& v) { glUniformMatrix4fv(glGetUniformLocation(m_id, n.c_str()), 1, GL_FALSE, v.m); }
+void Shader::setUniform(const std::string& n, int v) { gfx::RenderDevice::setUniform(glGetUniformLocation(m_id, n.c_str()), v); }
+void Shader::setUniform(const std::string& n, float v) { gfx::RenderDevice::setUniform(glGetUniformLocation(m_id, n.c_str()), v); }
+void Shader::setUniform(const std::string& n, const Vec3& v) { gfx::RenderDevice::setUniform(glGetUniformLocation(m_id, n.c_str()), v.x, v.y, v.z); }
+void Shader::setUniform(const std::string& n, const Vec4& v) { gfx::RenderDevice::setUniform(glGetUniformLocation(m_id, n.c_str()), v.x, v.y, v.z, v.w); }
+void Shader::setUniform(const std::string& n, const Mat4& v) { gfx::RenderDevice::setUniformMatrix4(glGetUniformLocation(m_id, n.c_str()), v.m); }
 
 uint32_t Shader::compileShader(uint32_t type, const std::string& src) {
     uint32_t id = glCreateShader(type);
@@ -10,6 +10,9 @@ public:
     Shader(const std::string& vertexSrc, const std::string& fragmentSrc);
     ~Shader();
 
+    // False if the program failed to compile or link (the errors are logged).
+    bool isLinked() const { return m_linked; }
+
     void bind() const;
     void unbind() const;
 
@@ -21,6 +24,7 @@ public:
 
 private:
     uint32_t m_id;
+    bool m_linked = false;
     uint32_t compileShader(uint32_t type, const std::string& src);
 };
 
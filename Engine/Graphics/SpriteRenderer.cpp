@@ -1,4 +1,5 @@
 #include "SpriteRenderer.h"
+#include "Core/RenderDevice.h"
 
 namespace rex {
 
@@ -26,7 +27,7 @@ void SpriteRenderer::initRenderData() {
     glGenBuffers(1, &VBO);
 
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    gfx::RenderDevice::bufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
     glBindVertexArray(m_quadVAO);
     glEnableVertexAttribArray(0);
@@ -36,9 +37,9 @@ void SpriteRenderer::initRenderData() {
 }
 
 void SpriteRenderer::draw(uint32_t textureId, Vec2 pos, Vec2 size, float rot, Vec3 col) {
-    glBindVertexArray(m_quadVAO);
-    glDrawArrays(GL_TRIANGLES, 0, 6);
-    glBindVertexArray(0);
+    gfx::RenderDevice::bindVertexArray(m_quadVAO);
+    gfx::RenderDevice::drawArrays(GL_TRIANGLES, 0, 6);
+    gfx::RenderDevice::bindVertexArray(0);
 }
 
 }
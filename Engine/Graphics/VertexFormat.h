@@ -0,0 +1,150 @@
+#pragma once
+
+#include "../Core/RexMath.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace rex {
+
+struct Vertex {
+    Vec3 position;
+    Vec3 normal;
+    Vec2 texCoords;
+};
+
+// 16-byte vertex: half-float position, octahedral normal in two snorm16, and 16-bit UVs
+// (unorm16 when every UV lies in [0, 1], half-float otherwise).
+struct PackedVertex {
+    uint16_t position[3];
+    uint16_t padding;
+    int16_t normal[2];
+    uint16_t texCoords[2];
+};
+
+static_assert(sizeof(Vertex) == 32);
+static_assert(sizeof(PackedVertex) == 16);
+
+enum class VertexFormat : uint32_t {
+    Float32 = 0,     // Vertex
+    Packed = 1,      // PackedVertex, unorm16 UVs
+    PackedWideUV = 2 // PackedVertex, half-float UVs (tiling or negative UVs)
+};
+
+inline size_t vertexStride(VertexFormat format) {
+    return format == VertexFormat::Float32 ? sizeof(Vertex) : sizeof(PackedVertex);
+}
+
+inline bool isValidVertexFormat(uint32_t format) {
+    return format <= static_cast<uint32_t>(VertexFormat::PackedWideUV);
+}
+
+// IEEE 754 binary16 with round-to-nearest-even; overflow saturates to infinity.
+inline uint16_t floatToHalf(float value) {
+    const uint32_t bits = std::bit_cast<uint32_t>(value);
+    const uint32_t sign = (bits >> 16) & 0x8000u;
+    const uint32_t magnitude = bits & 0x7FFFFFFFu;
+    if (magnitude >= 0x7F800000u) {
+        return static_cast<uint16_t>(sign | 0x7C00u | (magnitude > 0x7F800000u ? 0x200u : 0u));
+    }
+    if (magnitude >= 0x477FF000u) return static_cast<uint16_t>(sign | 0x7C00u);
+    if (magnitude < 0x38800000u) {
+        // Subnormal half: shift the implicit-one mantissa into place, rounding to nearest even.
+        if (magnitude < 0x33000000u) return static_cast<uint16_t>(sign);
+        const uint32_t exponent = magnitude >> 23;
+        const uint32_t mantissa = (magnitude & 0x7FFFFFu) | 0x800000u;
+        const uint32_t shift = 126 - exponent;
+        uint32_t half = mantissa >> shift;
+        const uint32_t rest = mantissa & ((1u << shift) - 1);
+        const uint32_t halfway = 1u << (shift - 1);
+        if (rest > halfway || (rest == halfway && (half & 1u))) ++half;
+        return static_cast<uint16_t>(sign | half);
+    }
+    uint32_t half = (magnitude - 0x38000000u) >> 13;
+    const uint32_t rest = magnitude & 0x1FFFu;
+    if (rest > 0x1000u || (rest == 0x1000u && (half & 1u))) ++half;
+    return static_cast<uint16_t>(sign | half);
+}
+
+inline float halfToFloat(uint16_t half) {
+    const uint32_t sign = static_cast<uint32_t>(half & 0x8000u) << 16;
+    const uint32_t exponent = (half >> 10) & 0x1Fu;
+    const uint32_t mantissa = half & 0x3FFu;
+    if (exponent == 0) {
+        const float value = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign ? -value : value;
+    }
+    if (exponent == 31) return std::bit_cast<float>(sign | 0x7F800000u | (mantissa << 13));
+    return std::bit_cast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+}
+
+inline int16_t toSnorm16(float value) {
+    return static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+}
+
+inline uint16_t toUnorm16(float value) {
+    return static_cast<uint16_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 65535.0f));
+}
+
+// Octahedral mapping of a unit vector onto [-1, 1]^2 (the lower hemisphere is folded over
+// the diagonals). A zero vector encodes as +Z.
+inline void encodeOctahedral(const Vec3& n, int16_t out[2]) {
+    const float l1 = std::fabs(n.x) + std::fabs(n.y) + std::fabs(n.z);
+    if (l1 <= 0.0f) {
+        out[0] = out[1] = 0;
+        return;
+    }
+    float x = n.x / l1;
+    float y = n.y / l1;
+    if (n.z < 0.0f) {
+        const float fx = (1.0f - std::fabs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+        const float fy = (1.0f - std::fabs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+        x = fx;
+        y = fy;
+    }
+    out[0] = toSnorm16(x);
+    out[1] = toSnorm16(y);
+}
+
+inline Vec3 decodeOctahedral(const int16_t in[2]) {
+    const float x = std::max(in[0] / 32767.0f, -1.0f);
+    const float y = std::max(in[1] / 32767.0f, -1.0f);
+    Vec3 n{x, y, 1.0f - std::fabs(x) - std::fabs(y)};
+    const float t = std::max(-n.z, 0.0f);
+    n.x += n.x >= 0.0f ? -t : t;
+    n.y += n.y >= 0.0f ? -t : t;
+    return normalize(n);
+}
+
+inline PackedVertex packVertex(const Vertex& v, VertexFormat format) {
+    PackedVertex out{};
+    out.position[0] = floatToHalf(v.position.x);
+    out.position[1] = floatToHalf(v.position.y);
+    out.position[2] = floatToHalf(v.position.z);
+    encodeOctahedral(v.normal, out.normal);
+    if (format == VertexFormat::Packed) {
+        out.texCoords[0] = toUnorm16(v.texCoords.x);
+        out.texCoords[1] = toUnorm16(v.texCoords.y);
+    } else {
+        out.texCoords[0] = floatToHalf(v.texCoords.x);
+        out.texCoords[1] = floatToHalf(v.texCoords.y);
+    }
+    return out;
+}
+
+inline Vertex unpackVertex(const PackedVertex& v, VertexFormat format) {
+    Vertex out{};
+    out.position = {halfToFloat(v.position[0]), halfToFloat(v.position[1]), halfToFloat(v.position[2])};
+    out.normal = decodeOctahedral(v.normal);
+    if (format == VertexFormat::Packed) {
+        out.texCoords = {v.texCoords[0] / 65535.0f, v.texCoords[1] / 65535.0f};
+    } else {
+        out.texCoords = {halfToFloat(v.texCoords[0]), halfToFloat(v.texCoords[1])};
+    }
+    return out;
+}
+
+}
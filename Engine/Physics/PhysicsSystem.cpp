@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <memory_resource>
 #include <unordered_set>
 
 namespace rex {
@@ -175,6 +176,7 @@ void PhysicsSystem::step(float dt) {
         simulate(FIXED_STEP);
         m_accumulator -= FIXED_STEP;
         ++fixedSteps;
+        ++m_stepCount;
     }
 
     if (fixedSteps == maxFixedStepsPerFrame) {
@@ -185,16 +187,20 @@ void PhysicsSystem::step(float dt) {
 void PhysicsSystem::simulate(float dt) {
     if (!m_rustWorld || dt <= 0.0f) return;
 
-    std::vector<RigidBody*> activeBodies;
+    // Substeps reuse the same frame bytes; the scope outlives the containers below.
+    core::memory::FrameMemoryScope scratchScope(m_frameMemory);
+    std::pmr::memory_resource* scratch = m_frameMemory.resource();
+
+    std::pmr::vector<RigidBody*> activeBodies(scratch);
     activeBodies.reserve(m_bodyPool.size());
     for (auto& [_, body] : m_bodyPool) {
         if (body) activeBodies.push_back(body.get());
     }
     if (activeBodies.empty()) return;
 
-    std::vector<ffi::RexPhysicsBody> ffiBodies;
+    std::pmr::vector<ffi::RexPhysicsBody> ffiBodies(scratch);
     ffiBodies.reserve(activeBodies.size());
-    std::unordered_map<uint64_t, std::size_t> bodyIndices;
+    std::pmr::unordered_map<uint64_t, std::size_t> bodyIndices(scratch);
     bodyIndices.reserve(activeBodies.size());
 
     for (std::size_t i = 0; i < activeBodies.size(); ++i) {
@@ -203,7 +209,7 @@ void PhysicsSystem::simulate(float dt) {
         bodyIndices.emplace(bodyId(body), i);
     }
 
-    std::vector<ffi::RexDistanceJoint> ffiJoints;
+    std::pmr::vector<ffi::RexDistanceJoint> ffiJoints(scratch);
     ffiJoints.reserve(m_joints.size());
     for (const auto& joint : m_joints) {
         if (!joint.a || !joint.b) continue;
@@ -286,7 +292,10 @@ void PhysicsSystem::update(Scene& scene, float dt) {
     constexpr float DEG2RAD = 0.01745329251994329577f;
     constexpr float RAD2DEG = 57.295779513082320876f;
 
-    std::unordered_set<EntityId> activeEntities;
+    // Nothing from the previous update is still alive, so the frame memory can be rewound.
+    m_frameMemory.beginFrame();
+    std::pmr::unordered_set<EntityId> activeEntities(m_frameMemory.resource());
+    activeEntities.reserve(m_bodyPool.size());
 
     scene.each<RigidBodyComponent>([&](EntityId id, RigidBodyComponent& rb) {
         activeEntities.insert(id);
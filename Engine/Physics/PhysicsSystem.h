@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../Core/Components.h"
+#include "../Core/Memory/MemoryResource.h"
 #include "../Core/Scene.h"
 #include "RigidBody.h"
 #include "RustPhysicsFFI.h"
@@ -50,6 +51,14 @@ public:
 
     RaycastHit raycast(const Vec3& origin, const Vec3& direction, float maxDist);
 
+    // Fraction of a fixed step left in the accumulator; blend the previous and
+    // current simulated poses by this for presentation.
+    float interpolationAlpha() const { return m_accumulator / FIXED_STEP; }
+    // Number of fixed steps simulated so far.
+    uint64_t stepCount() const { return m_stepCount; }
+    // Scratch memory of the last update.
+    const core::memory::FrameMemoryResource& frameMemory() const { return m_frameMemory; }
+
 private:
     struct DistanceJointState {
         int id = 0;
@@ -65,6 +74,10 @@ private:
     void step(float dt);
     void simulate(float dt);
 
+    // Scratch for update/simulate; rewound at the start of every update.
+    static constexpr std::size_t kFrameMemoryBytes = 4 * 1024 * 1024;
+    core::memory::FrameMemoryResource m_frameMemory{kFrameMemoryBytes};
+
     std::unordered_map<EntityId, std::unique_ptr<RigidBody>> m_bodyPool;
     std::vector<DistanceJointState> m_joints;
 
@@ -77,6 +90,7 @@ private:
 
     const float FIXED_STEP = 1.0f / 60.0f;
     float m_accumulator = 0.0f;
+    uint64_t m_stepCount = 0;
     float m_maxFrameStep = 0.1f;
     int m_nextJointId = 1;
 };
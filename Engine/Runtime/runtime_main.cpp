@@ -1,17 +1,47 @@
 #include "../Core/Components.h"
+#include "../Core/Execution/EngineLoop.h"
+#include "../Core/Execution/RenderSnapshot.h"
+#include "../Core/Diagnostics/FrameWatchdog.h"
+#include "../Core/Diagnostics/ProfilerHooks.h"
+#include "../Core/Event/AsyncEventQueue.h"
+#include "../Core/Event/EventBus.h"
+#include "../Core/Execution/RenderThread.h"
 #include "../Core/Logger.h"
+#include "../Core/Platform/FileSystem.h"
+#include "../Core/Platform/Vfs.h"
+#include "../Core/Time/FramePacer.h"
+#include "../Core/Time/FrameTimeHistogram.h"
 #include "../Core/Scene.h"
 #include "../Core/Window.h"
+#include "../Editor/Asset/DependencyGraph.h"
+#include "../Editor/Asset/HotReloadAssets.h"
+#include "../Editor/Asset/HotReloadService.h"
+#include "../Editor/Asset/ImportPipeline.h"
+#include "../Graphics/Core/RenderDevice.h"
 #include "../Graphics/Mesh.h"
+#include "../Graphics/MeshFile.h"
+#include "../Graphics/MeshLibrary.h"
+#include "../Graphics/MeshLod.h"
+#include "../Graphics/MeshOptimizer.h"
 #include "../Graphics/Renderer.h"
 #include "../Physics/PhysicsSystem.h"
 
 #include <SDL2/SDL.h>
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <csignal>
 #include <cstdint>
+#include <cstdlib>
+#include <filesystem>
 #include <limits>
+#include <memory>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
 #include <unordered_map>
 #include <vector>
 
@@ -233,7 +263,7 @@ bool spawnBlock(Scene& scene,
     Transform& t = scene.addComponent<Transform>(e, toWorldPos(cell));
     t.scale = {1.0f, 1.0f, 1.0f};
 
-    scene.addComponent<MeshRenderer>(e, nullptr, cube, visual.color, visual.metallic, visual.roughness, visual.ao);
+    scene.addComponent<MeshRenderer>(e, cube, visual.color, visual.metallic, visual.roughness, visual.ao);
 
     blocks.emplace(cell, e);
     entityToCell.emplace(e, cell);
@@ -264,7 +294,7 @@ EntityId spawnDynamicProp(Scene& scene,
     Transform& t = scene.addComponent<Transform>(e, pos);
     t.scale = {1.0f, 1.0f, 1.0f};
 
-    scene.addComponent<MeshRenderer>(e, nullptr, cube, visual.color, visual.metallic, visual.roughness, visual.ao);
+    scene.addComponent<MeshRenderer>(e, cube, visual.color, visual.metallic, visual.roughness, visual.ao);
 
     RigidBodyComponent& rb = scene.addComponent<RigidBodyComponent>(e, BodyType::Dynamic, 1.0f);
     rb.velocity = vel;
@@ -279,20 +309,616 @@ EntityId spawnDynamicProp(Scene& scene,
     return e;
 }
 
+constexpr int kWorldHalf = 14;
+
+struct SandboxLights {
+    EntityId sun = 0;
+    EntityId skyFill = 0;
+};
+
+SandboxLights createSandboxLights(Scene& scene) {
+    SandboxLights out{};
+
+    out.sun = scene.createEntity();
+    scene.addComponent<Transform>(out.sun, Vec3{0.0f, 80.0f, 0.0f}).rotation = {-54.0f, 22.0f, 0.0f};
+    Light& sunLight = scene.addComponent<Light>(out.sun, Vec3{1.0f, 0.97f, 0.93f}, 4.6f, Light::Directional);
+    sunLight.castShadows = true;
+    sunLight.volumetric = false;
+
+    out.skyFill = scene.createEntity();
+    scene.addComponent<Transform>(out.skyFill, Vec3{0.0f, 40.0f, 0.0f}).rotation = {32.0f, -140.0f, 0.0f};
+    Light& fill = scene.addComponent<Light>(out.skyFill, Vec3{0.42f, 0.50f, 0.62f}, 0.8f, Light::Directional);
+    fill.castShadows = false;
+
+    return out;
+}
+
+// Terrain plus a few stone towers. cube may be null when nothing will be drawn.
+int buildSandboxWorld(Scene& scene, Mesh* cube, BlockMap& blocks, CellMap& entityToCell) {
+    const int worldHalf = kWorldHalf;
+    int spawnedBlocks = 0;
+
+    for (int x = -worldHalf; x <= worldHalf; ++x) {
+        for (int z = -worldHalf; z <= worldHalf; ++z) {
+            const int h = terrainHeight(x, z);
+            for (int y = 0; y <= h; ++y) {
+                BlockKind kind = BlockKind::Stone;
+                if (y == 0) {
+                    kind = BlockKind::Bedrock;
+                } else if (y == h) {
+                    kind = (h <= 3) ? BlockKind::Sand : BlockKind::Grass;
+                } else if (y >= h - 2) {
+                    kind = BlockKind::Dirt;
+                }
+
+                if (spawnBlock(scene, cube, {x, y, z}, kind, blocks, entityToCell)) {
+                    ++spawnedBlocks;
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < 14; ++i) {
+        const int x = -worldHalf + 2 + (i * 7) % (worldHalf * 2 - 3);
+        const int z = -worldHalf + 2 + (i * 11) % (worldHalf * 2 - 3);
+        const int baseH = terrainHeight(x, z);
+        const int towerH = 3 + (i % 4);
+        for (int y = baseH + 1; y <= baseH + towerH; ++y) {
+            if (spawnBlock(scene, cube, {x, y, z}, BlockKind::Stone, blocks, entityToCell)) {
+                ++spawnedBlocks;
+            }
+        }
+    }
+
+    return spawnedBlocks;
+}
+
+// Everything the renderer reads for one frame. In pipelined mode the render
+// thread draws the front copy while the main thread fills the back one.
+struct RenderSnapshot {
+    Scene scene;
+    Camera camera;
+    Mat4 view = Mat4::identity();
+    Vec3 viewPos{0.0f, 0.0f, 0.0f};
+    gfx::PostProcessSettings post{};
+    int width = 1;
+    int height = 1;
+};
+
+inline Vec3 lerpVec3(const Vec3& a, const Vec3& b, float t) {
+    return a + (b - a) * t;
+}
+
+inline Vec3 lerpEulerDeg(const Vec3& a, const Vec3& b, float t) {
+    constexpr float RAD2DEG = 57.295779513082320876f;
+    const Quat qa = Quat::fromEulerXYZ(a * DEG2RAD);
+    Quat qb = Quat::fromEulerXYZ(b * DEG2RAD);
+    if (qa.x * qb.x + qa.y * qb.y + qa.z * qb.z + qa.w * qb.w < 0.0f) {
+        qb = qb * -1.0f;
+    }
+    return normalize(qa * (1.0f - t) + qb * t).toEulerXYZ() * RAD2DEG;
+}
+
+// Mirrors the components the renderer reads (Transform/MeshRenderer/Light) into
+// a render-only scene. Dynamic bodies are blended between their last two
+// simulated poses so motion stays smooth when render and physics rates differ.
+class RenderSnapshotBuilder {
+public:
+    void build(const Scene& sim, const PhysicsSystem& physics, float alpha, RenderSnapshot& out) {
+        const bool stepped = physics.stepCount() != m_lastStep;
+        m_lastStep = physics.stepCount();
+        alpha = clampf(alpha, 0.0f, 1.0f);
+
+        m_scratch.clear();
+        out.scene.each<Transform>([&](EntityId id, const Transform&) {
+            if (!sim.world().isAlive(id)) m_scratch.push_back(id);
+        });
+        for (const EntityId id : m_scratch) {
+            out.scene.destroyEntity(id);
+            m_poses.erase(id);
+        }
+        pruneMissing<MeshRenderer>(sim, out.scene);
+        pruneMissing<Light>(sim, out.scene);
+
+        sim.each<MeshRenderer>([&](EntityId id, const MeshRenderer& renderer) {
+            const Transform* transform = sim.getComponent<Transform>(id);
+            if (!transform) return;
+            out.scene.addComponent<MeshRenderer>(id, renderer);
+            out.scene.addComponent<Transform>(id, present(sim, id, *transform, stepped, alpha));
+        });
+
+        sim.each<Light>([&](EntityId id, const Light& light) {
+            out.scene.addComponent<Light>(id, light);
+            if (const Transform* transform = sim.getComponent<Transform>(id)) {
+                out.scene.addComponent<Transform>(id, *transform);
+            }
+        });
+    }
+
+private:
+    struct BodyPose {
+        Transform previous;
+        Transform current;
+    };
+
+    template <typename T>
+    void pruneMissing(const Scene& sim, Scene& dst) {
+        m_scratch.clear();
+        dst.each<T>([&](EntityId id, const T&) {
+            if (!sim.hasComponent<T>(id)) m_scratch.push_back(id);
+        });
+        for (const EntityId id : m_scratch) {
+            dst.removeComponent<T>(id);
+        }
+    }
+
+    Transform present(const Scene& sim, EntityId id, const Transform& transform, bool stepped, float alpha) {
+        const RigidBodyComponent* rb = sim.getComponent<RigidBodyComponent>(id);
+        if (!rb || rb->type != BodyType::Dynamic) return transform;
+
+        auto [it, inserted] = m_poses.try_emplace(id, BodyPose{transform, transform});
+        BodyPose& pose = it->second;
+        if (!inserted && stepped) {
+            pose.previous = pose.current;
+            pose.current = transform;
+        }
+
+        Transform out = pose.current;
+        out.position = lerpVec3(pose.previous.position, pose.current.position, alpha);
+        out.rotation = lerpEulerDeg(pose.previous.rotation, pose.current.rotation, alpha);
+        return out;
+    }
+
+    std::unordered_map<EntityId, BodyPose> m_poses;
+    std::vector<EntityId> m_scratch;
+    uint64_t m_lastStep = 0;
+};
+
+struct RuntimeOptions {
+    // Render frame N on a dedicated thread while frame N+1 simulates.
+    bool pipelined = false;
+    // No window or GL; fixed steps only.
+    bool headless = false;
+    // Headless step limit; 0 runs until the script quits or the process is interrupted.
+    uint64_t steps = 0;
+    // Headless step rate; 0 runs uncapped.
+    double rateHz = 0.0;
+    std::string scriptPath;
+    // Windowed frame-rate target for the frame pacer; 0 leaves pacing to vsync.
+    double targetFps = 0.0;
+    bool vsync = true;
+    // Chrome/Perfetto trace written on exit; empty disables tracing.
+    std::string tracePath;
+    // Rotating log file in addition to the console.
+    std::string logPath;
+    // Hitch capture: frames over the budget or the p99 multiplier dump the preceding window.
+    core::diagnostics::FrameWatchdogConfig watchdog;
+    // Mesh (.rexmesh, or OBJ) streamed in the background and shown in place of a cube once uploaded.
+    std::string modelPath;
+    // Offline conversion: cook this OBJ into cookMeshOutput (.rexmesh) and exit.
+    std::string cookMeshInput;
+    std::string cookMeshOutput;
+    // Cooking builds a LOD chain and reorders for the vertex cache, overdraw and fetch unless
+    // disabled; --quantize additionally packs vertices into 16 bytes.
+    bool cookMeshLods = true;
+    bool cookMeshOptimize = true;
+    bool cookMeshQuantize = false;
+    // Mesh bytes uploaded to the GPU per frame.
+    size_t uploadBudgetBytes = 8u * 1024u * 1024u;
+    // Directories and .rexpak archives mounted into the VFS in order (later ones win).
+    std::vector<std::string> mounts;
+    // Offline packing: write every file under packInput into packOutput (.rexpak) and exit.
+    std::string packInput;
+    std::string packOutput;
+    // Hot reload: OBJ and shader (.vert/.frag) changes under this directory are reimported in the
+    // background and swapped in at a frame boundary.
+    std::string watchDirectory;
+};
+
+RuntimeOptions parseOptions(int argc, char** argv) {
+    RuntimeOptions options{};
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--pipelined") {
+            options.pipelined = true;
+        } else if (arg == "--headless") {
+            options.headless = true;
+        } else if (arg == "--steps" && hasValue) {
+            options.steps = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--rate" && hasValue) {
+            options.rateHz = std::max(0.0, std::strtod(argv[++i], nullptr));
+        } else if (arg == "--script" && hasValue) {
+            options.scriptPath = argv[++i];
+        } else if (arg == "--fps" && hasValue) {
+            options.targetFps = std::max(0.0, std::strtod(argv[++i], nullptr));
+        } else if (arg == "--no-vsync") {
+            options.vsync = false;
+        } else if (arg == "--trace" && hasValue) {
+            options.tracePath = argv[++i];
+        } else if (arg == "--log-file" && hasValue) {
+            options.logPath = argv[++i];
+        } else if (arg == "--watchdog" && hasValue) {
+            options.watchdog.budgetMs = std::max(0.0, std::strtod(argv[++i], nullptr));
+        } else if (arg == "--watchdog-p99" && hasValue) {
+            options.watchdog.p99Multiplier = std::max(0.0, std::strtod(argv[++i], nullptr));
+        } else if (arg == "--watchdog-frames" && hasValue) {
+            options.watchdog.windowFrames = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--watchdog-dir" && hasValue) {
+            options.watchdog.outputDirectory = argv[++i];
+        } else if (arg == "--model" && hasValue) {
+            options.modelPath = argv[++i];
+        } else if (arg == "--cook-mesh" && i + 2 < argc) {
+            options.cookMeshInput = argv[++i];
+            options.cookMeshOutput = argv[++i];
+        } else if (arg == "--no-lods") {
+            options.cookMeshLods = false;
+        } else if (arg == "--no-optimize") {
+            options.cookMeshOptimize = false;
+        } else if (arg == "--quantize") {
+            options.cookMeshQuantize = true;
+        } else if (arg == "--mount" && hasValue) {
+            options.mounts.emplace_back(argv[++i]);
+        } else if (arg == "--pack" && i + 2 < argc) {
+            options.packInput = argv[++i];
+            options.packOutput = argv[++i];
+        } else if (arg == "--upload-budget" && hasValue) {
+            options.uploadBudgetBytes = std::max<size_t>(1, std::strtoull(argv[++i], nullptr, 10)) * 1024u;
+        } else if (arg == "--watch" && hasValue) {
+            options.watchDirectory = argv[++i];
+        } else {
+            Logger::warn("Unknown argument: {}", arg);
+        }
+    }
+    return options;
+}
+
+void startTracing(const RuntimeOptions& options) {
+    if (options.tracePath.empty()) return;
+#if REX_ENABLE_TRACING
+    core::diagnostics::TraceRecorder::instance().start();
+    REX_TRACE_THREAD_NAME("Main");
+    Logger::info("Tracing to {}", options.tracePath);
+#else
+    Logger::warn("--trace ignored: tracing is compiled out of this build");
+#endif
+}
+
+void finishTracing(const RuntimeOptions& options) {
+#if REX_ENABLE_TRACING
+    if (options.tracePath.empty()) return;
+    auto& recorder = core::diagnostics::TraceRecorder::instance();
+    recorder.stop();
+    if (!recorder.exportChromeTrace(options.tracePath)) {
+        Logger::error("Failed to write trace: {}", options.tracePath);
+        return;
+    }
+    Logger::info("Trace written: {} ({} threads, {} events dropped)",
+                 options.tracePath,
+                 recorder.threadCount(),
+                 recorder.droppedEvents());
+#else
+    (void)options;
+#endif
+}
+
+void startWatchdog(const RuntimeOptions& options, core::diagnostics::FrameWatchdog& watchdog) {
+    watchdog.configure(options.watchdog);
+    if (!watchdog.enabled()) return;
+    Logger::info("Frame watchdog: budget {:.2f} ms, p99 x{:.2f}, {} frame window -> {}",
+                 options.watchdog.budgetMs, options.watchdog.p99Multiplier,
+                 watchdog.config().windowFrames, options.watchdog.outputDirectory.string());
+}
+
+void recordFrameMemory(core::diagnostics::FrameWatchdog& watchdog,
+                       core::diagnostics::TraceName highWaterKb,
+                       core::diagnostics::TraceName overflows,
+                       const core::memory::FrameMemoryResource& memory) {
+    watchdog.setCounter(highWaterKb, static_cast<double>(memory.highWaterBytes()) / 1024.0);
+    watchdog.setCounter(overflows, static_cast<double>(memory.overflowAllocations()));
+}
+
+void recordRenderCounters(core::diagnostics::FrameWatchdog& watchdog, const gfx::RenderStats& render) {
+    watchdog.setCounter("Draw calls", render.drawCalls);
+    watchdog.setCounter("Triangles", static_cast<double>(render.triangles));
+    watchdog.setCounter("Program binds", render.programBinds);
+    watchdog.setCounter("VAO binds", render.vertexArrayBinds);
+    watchdog.setCounter("FBO binds", render.framebufferBinds);
+    watchdog.setCounter("Texture binds", render.textureBinds);
+    watchdog.setCounter("Uniform updates", render.uniformUpdates);
+    watchdog.setCounter("Upload KB", static_cast<double>(render.uploadBytes) / 1024.0);
+}
+
+// One line of a headless input script: "<step> <command> [args...]".
+struct ScriptCommand {
+    uint64_t step = 0;
+    std::vector<std::string> tokens;
+};
+
+bool loadInputScript(const std::string& path, std::vector<ScriptCommand>& out) {
+    const auto text = core::platform::VirtualFileSystem::instance().readText(path);
+    if (!text) {
+        Logger::error("Failed to read input script: {}", path);
+        return false;
+    }
+
+    std::istringstream lines(*text);
+    std::string line;
+    while (std::getline(lines, line)) {
+        const auto comment = line.find('#');
+        if (comment != std::string::npos) line.resize(comment);
+
+        std::istringstream fields(line);
+        ScriptCommand cmd{};
+        if (!(fields >> cmd.step)) continue;
+        for (std::string token; fields >> token;) {
+            cmd.tokens.push_back(std::move(token));
+        }
+        if (!cmd.tokens.empty()) out.push_back(std::move(cmd));
+    }
+
+    std::stable_sort(out.begin(), out.end(), [](const ScriptCommand& a, const ScriptCommand& b) {
+        return a.step < b.step;
+    });
+    return true;
+}
+
+void logFrameStats(const core::time::FrameTimingStats& stats, const gfx::RenderStats& render) {
+    const auto frame = stats.frame().summary();
+    const auto cpu = stats.cpu().summary();
+    Logger::info("Frame ms p50 {:.2f} p95 {:.2f} p99 {:.2f} max {:.2f} | CPU ms p50 {:.2f} p95 {:.2f} p99 {:.2f}",
+                 frame.p50, frame.p95, frame.p99, frame.max, cpu.p50, cpu.p95, cpu.p99);
+    if (stats.gpu().count() > 0) {
+        const auto gpu = stats.gpu().summary();
+        Logger::info("GPU ms p50 {:.2f} p95 {:.2f} p99 {:.2f}", gpu.p50, gpu.p95, gpu.p99);
+    }
+    for (const auto& pass : stats.passes()) {
+        const auto passGpu = pass.gpu.summary();
+        const auto passCpu = pass.cpu.summary();
+        Logger::info("  {}: GPU ms p50 {:.2f} p95 {:.2f} | CPU ms p50 {:.2f} p95 {:.2f}",
+                     pass.name, passGpu.p50, passGpu.p95, passCpu.p50, passCpu.p95);
+    }
+    Logger::info("Render: {} draws, {} tris | binds program {} vao {} fbo {} texture {} | {} uniforms | {:.1f} KB uploaded",
+                 render.drawCalls, render.triangles, render.programBinds, render.vertexArrayBinds,
+                 render.framebufferBinds, render.textureBinds, render.uniformUpdates,
+                 static_cast<double>(render.uploadBytes) / 1024.0);
+}
+
+volatile std::sig_atomic_t g_interrupted = 0;
+
+void onInterrupt(int) {
+    g_interrupted = 1;
+}
+
+class HeadlessSandbox final : public core::execution::IEngineLoopDelegate {
+public:
+    bool onInit() override { return true; }
+    void onShutdown() override {}
+    bool shouldClose() const override { return quitRequested || g_interrupted != 0; }
+
+    bool quitRequested = false;
+};
+
+// OBJ stays an interchange format: it is parsed once here and the runtime loads the mapped
+// .rexmesh from then on.
+int cookMesh(const RuntimeOptions& options) {
+    gfx::ObjImportStats stats{};
+    // Offline step on the main thread: let the parse use every core.
+    auto mesh = gfx::MeshLibrary::loadObj(options.cookMeshInput, &stats, gfx::ObjImportOptions{});
+    if (!mesh) return 1;
+    if (options.cookMeshLods) {
+        const auto lods = gfx::buildLodChain(mesh->vertices, mesh->indices, mesh->submeshes, mesh->lods);
+        for (size_t i = 1; i < mesh->lods.size(); ++i) {
+            Logger::info("LOD {}: {} triangles, error {:.5f}, used below screen size {:.3f}", i,
+                         lods.indexCounts[i] / 3, lods.errors[i], mesh->lods[i].screenSize);
+        }
+        Logger::info("Built {} LODs in {:.1f} ms", mesh->lods.size(), lods.milliseconds);
+    }
+    if (options.cookMeshOptimize) {
+        const auto report = gfx::optimizeMesh(mesh->vertices, mesh->indices, mesh->submeshes);
+        Logger::info("Optimized in {:.1f} ms: ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}, overdraw order kept for {}/{} submeshes",
+                     report.milliseconds, report.before.acmr, report.after.acmr, report.before.atvr, report.after.atvr,
+                     report.overdrawRanges, std::max<size_t>(mesh->submeshes.size(), 1));
+    }
+    gfx::MeshFileContents contents{mesh->vertices, mesh->indices, mesh->submeshes, mesh->lods};
+    std::vector<PackedVertex> packed;
+    if (options.cookMeshQuantize) {
+        float maxError = 0.0f;
+        contents.packedFormat = gfx::quantizeVertices(mesh->vertices, packed, &maxError);
+        contents.packedVertices = packed;
+        Logger::info("Quantized to {} bytes/vertex ({} UVs), max position error {:.5f}", sizeof(PackedVertex),
+                     contents.packedFormat == VertexFormat::Packed ? "unorm16" : "half", maxError);
+    }
+    if (!gfx::saveMeshFile(options.cookMeshOutput, contents)) return 1;
+    Logger::info("Cooked {} -> {}: {} triangles, {} vertices ({} corners), {} submeshes", options.cookMeshInput,
+                 options.cookMeshOutput, stats.triangles, stats.vertices, stats.faceCorners, mesh->submeshes.size());
+    Logger::info("OBJ import: {:.1f} MB in {:.1f} ms ({:.0f} MB/s on {} threads)",
+                 static_cast<double>(stats.bytes) / (1024.0 * 1024.0), stats.totalMs, stats.megabytesPerSecond(), stats.threads);
+    return 0;
+}
+
+// Cooked meshes stay uncompressed so the runtime maps them straight out of the archive.
+int packAssets(const RuntimeOptions& options) {
+    const auto begin = std::chrono::steady_clock::now();
+    const std::string_view keepMapped[] = {gfx::kMeshFileExtension};
+    const auto files = core::platform::VirtualFileSystem::packDirectory(options.packInput, options.packOutput, keepMapped);
+    if (!files) {
+        Logger::error("Failed to pack {} into {}", options.packInput, options.packOutput);
+        return 1;
+    }
+    std::error_code ec;
+    const auto bytes = std::filesystem::file_size(options.packOutput, ec);
+    Logger::info("Packed {} files from {} into {} ({:.1f} MB) in {:.1f} ms", *files, options.packInput, options.packOutput,
+                 static_cast<double>(ec ? 0 : bytes) / (1024.0 * 1024.0),
+                 std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count());
+    return 0;
+}
+
+void mountAssets(const RuntimeOptions& options) {
+    for (const std::string& source : options.mounts) {
+        core::platform::VirtualFileSystem::instance().mount(source);
+    }
+}
+
+int runHeadless(const RuntimeOptions& options) {
+    using namespace core::execution;
+
+    std::vector<ScriptCommand> script;
+    if (!options.scriptPath.empty() && !loadInputScript(options.scriptPath, script)) {
+        return 1;
+    }
+
+    PhysicsSystem physics;
+    physics.setSolverIterations(12, 6);
+    physics.setMaxSubSteps(8);
+    physics.setGravity({0.0f, -9.81f, 0.0f});
+
+    Scene scene;
+    BlockMap blocks;
+    CellMap entityToCell;
+    std::vector<EntityId> dynamicProps;
+    bool paused = false;
+
+    const int spawnedBlocks = buildSandboxWorld(scene, nullptr, blocks, entityToCell);
+    Logger::info("Rex headless sandbox ready. spawned blocks: {}, script commands: {}", spawnedBlocks, script.size());
+
+    HeadlessSandbox sandbox;
+    std::signal(SIGINT, onInterrupt);
+    std::signal(SIGTERM, onInterrupt);
+
+    auto argOr = [](const ScriptCommand& cmd, std::size_t index, float fallback) {
+        return index < cmd.tokens.size() ? std::strtof(cmd.tokens[index].c_str(), nullptr) : fallback;
+    };
+    auto cellArg = [&](const ScriptCommand& cmd) {
+        return GridPos{int(argOr(cmd, 1, 0.0f)), int(argOr(cmd, 2, 0.0f)), int(argOr(cmd, 3, 0.0f))};
+    };
+    auto flagArg = [](const ScriptCommand& cmd) {
+        return cmd.tokens.size() < 2 || cmd.tokens[1] == "on";
+    };
+
+    auto apply = [&](const ScriptCommand& cmd) {
+        const std::string& op = cmd.tokens[0];
+        if (op == "throw") {
+            const Vec3 pos{argOr(cmd, 1, 0.0f), argOr(cmd, 2, 12.0f), argOr(cmd, 3, 0.0f)};
+            const Vec3 vel{argOr(cmd, 4, 0.0f), argOr(cmd, 5, 0.0f), argOr(cmd, 6, 0.0f)};
+            dynamicProps.push_back(spawnDynamicProp(scene, nullptr, pos, vel, BlockKind::Stone));
+        } else if (op == "break") {
+            const GridPos cell = cellArg(cmd);
+            auto it = blocks.find(cell);
+            if (cell.y > 0 && it != blocks.end()) {
+                removeBlock(scene, it->second, blocks, entityToCell);
+            }
+        } else if (op == "place") {
+            const std::string kind = cmd.tokens.size() > 4 ? cmd.tokens[4] : "stone";
+            BlockKind block = BlockKind::Stone;
+            if (kind == "grass") block = BlockKind::Grass;
+            else if (kind == "dirt") block = BlockKind::Dirt;
+            else if (kind == "sand") block = BlockKind::Sand;
+            spawnBlock(scene, nullptr, cellArg(cmd), block, blocks, entityToCell);
+        } else if (op == "delete") {
+            if (!dynamicProps.empty()) {
+                scene.destroyEntity(dynamicProps.back());
+                dynamicProps.pop_back();
+            }
+        } else if (op == "gravity") {
+            physics.setGravity(flagArg(cmd) ? Vec3{0.0f, -9.81f, 0.0f} : Vec3{0.0f, 0.0f, 0.0f});
+        } else if (op == "pause") {
+            paused = flagArg(cmd);
+        } else if (op == "quit") {
+            sandbox.quitRequested = true;
+        } else {
+            Logger::warn("Unknown script command at step {}: {}", cmd.step, op);
+        }
+    };
+
+    PhaseCallbackDesc physicsDesc{};
+    physicsDesc.name = "physics";
+
+    core::diagnostics::FrameWatchdog watchdog;
+    startWatchdog(options, watchdog);
+
+    PhaseScheduler scheduler;
+    scheduler.registerPhaseCallback(FramePhase::Update, std::move(physicsDesc), [&](const FrameContext& ctx) {
+        physics.update(scene, paused ? 0.0f : ctx.fixedDeltaTime);
+        recordFrameMemory(watchdog, "Physics scratch KB", "Physics scratch overflows", physics.frameMemory());
+    });
+
+    EngineLoopConfig loopConfig{};
+    loopConfig.headless = true;
+    EngineLoop loop(loopConfig);
+    loop.setWatchdog(&watchdog);
+
+    std::size_t nextCommand = 0;
+    HeadlessRunConfig run{};
+    run.maxSteps = options.steps;
+    run.stepRateHz = options.rateHz;
+    run.input = [&](uint64_t step, const FrameContext&) {
+        while (nextCommand < script.size() && script[nextCommand].step <= step) {
+            apply(script[nextCommand++]);
+        }
+    };
+    run.reportIntervalSeconds = 5.0;
+    run.onReport = [](const HeadlessRunReport& report) {
+        Logger::info("headless: {} steps, {:.1f} steps/s", report.steps, report.stepsPerSecond);
+    };
+
+    if (options.steps == 0 && script.empty()) {
+        Logger::info("Running until interrupted (Ctrl+C)");
+    }
+
+    const HeadlessRunReport report = loop.runHeadless(sandbox, scheduler, run);
+    loop.shutdown(sandbox);
+
+    Logger::info("Headless run finished: {} steps in {:.3f}s ({:.1f} steps/s, {:.1f}x realtime)",
+                 report.steps,
+                 report.wallSeconds,
+                 report.stepsPerSecond,
+                 // Every step simulates one fixed step of the loop, whatever its rate.
+                 report.stepsPerSecond * loopConfig.fixedDeltaTime);
+    static constexpr const char* kPhaseNames[] = {"PreUpdate", "Update", "PostUpdate"};
+    for (std::size_t i = 0; i < report.phaseSeconds.size(); ++i) {
+        if (report.phaseSeconds[i] <= 0.0) continue;
+        Logger::info("  {}: {:.3f}s total, {:.1f} steps/s", kPhaseNames[i], report.phaseSeconds[i], report.phaseStepsPerSecond[i]);
+    }
+    Logger::info("Dynamic props alive: {}", dynamicProps.size());
+    return 0;
+}
+
 } // namespace
 
-int main() {
+int main(int argc, char** argv) {
     using namespace rex;
 
+    const RuntimeOptions options = parseOptions(argc, argv);
+    if (!options.logPath.empty()) {
+        auto sink = std::make_shared<core::diagnostics::RotatingFileLogSink>(options.logPath);
+        if (sink->isOpen()) {
+            Logger::addSink(std::move(sink));
+        } else {
+            Logger::warn("Failed to open log file: {}", options.logPath);
+        }
+    }
+    if (!options.cookMeshInput.empty()) return cookMesh(options);
+    if (!options.packInput.empty()) return packAssets(options);
+    mountAssets(options);
+    startTracing(options);
+    if (options.headless) {
+        const int result = runHeadless(options);
+        finishTracing(options);
+        return result;
+    }
+    const bool pipelined = options.pipelined;
+
     Window window({
         .title = "Rex Block Sandbox (Deferred + Rust Physics)",
         .width = 1600,
         .height = 900,
-        .vsync = true,
+        .vsync = options.vsync,
     });
 
     Renderer renderer;
-    auto& post = renderer.deferredPipeline().postProcess().settings();
+    // Owned by the main thread; handed to the renderer with each frame.
+    gfx::PostProcessSettings post = renderer.deferredPipeline().postProcess().settings();
     post.enableBloom = false;
     post.autoExposure = false;
     post.exposure = 1.05f;
@@ -328,53 +954,75 @@ int main() {
     CellMap entityToCell;
     std::vector<EntityId> dynamicProps;
 
-    const EntityId sun = scene.createEntity();
-    scene.addComponent<Transform>(sun, Vec3{0.0f, 80.0f, 0.0f}).rotation = {-54.0f, 22.0f, 0.0f};
-    Light& sunLight = scene.addComponent<Light>(sun, Vec3{1.0f, 0.97f, 0.93f}, 4.6f, Light::Directional);
-    sunLight.castShadows = true;
-    sunLight.volumetric = false;
-
-    const EntityId skyFill = scene.createEntity();
-    scene.addComponent<Transform>(skyFill, Vec3{0.0f, 40.0f, 0.0f}).rotation = {32.0f, -140.0f, 0.0f};
-    Light& fill = scene.addComponent<Light>(skyFill, Vec3{0.42f, 0.50f, 0.62f}, 0.8f, Light::Directional);
-    fill.castShadows = false;
+    const SandboxLights lights = createSandboxLights(scene);
+    const EntityId sun = lights.sun;
+    const EntityId skyFill = lights.skyFill;
 
-    const int worldHalf = 14;
-    int spawnedBlocks = 0;
+    const int worldHalf = kWorldHalf;
+    const int spawnedBlocks = buildSandboxWorld(scene, cube, blocks, entityToCell);
 
-    for (int x = -worldHalf; x <= worldHalf; ++x) {
-        for (int z = -worldHalf; z <= worldHalf; ++z) {
-            const int h = terrainHeight(x, z);
-            for (int y = 0; y <= h; ++y) {
-                BlockKind kind = BlockKind::Stone;
-                if (y == 0) {
-                    kind = BlockKind::Bedrock;
-                } else if (y == h) {
-                    kind = (h <= 3) ? BlockKind::Sand : BlockKind::Grass;
-                } else if (y >= h - 2) {
-                    kind = BlockKind::Dirt;
-                }
+    Logger::info("Rex Block Sandbox ready. spawned blocks: {}", spawnedBlocks);
 
-                if (spawnBlock(scene, cube, {x, y, z}, kind, blocks, entityToCell)) {
-                    ++spawnedBlocks;
-                }
-            }
-        }
+    // Meshes are parsed on the job pool and uploaded by whichever thread owns the GL context.
+    // Declared before the render thread so its callback never outlives them.
+    core::job::ThreadPool loadJobs(2);
+    core::event::AsyncEventQueue resourceEvents;
+    core::event::EventBus events;
+    gfx::MeshLibrary meshes(loadJobs, {.uploadBudgetBytes = options.uploadBudgetBytes}, &resourceEvents);
+    renderer.deferredPipeline().setMeshLibrary(&meshes);
+    gfx::MeshHandle modelHandle{};
+    // Hot reload replaces meshes by their normalized source path, so with --watch the model is
+    // acquired under that key (the VFS falls back to the real file for it).
+    const std::string modelPath = options.watchDirectory.empty() || options.modelPath.empty()
+        ? options.modelPath
+        : editor::asset::ImportPipeline::normalizeSourcePath(options.modelPath);
+    if (!modelPath.empty()) {
+        // The renderer resolves the handle every frame; the cube stands in until the mesh is resident.
+        modelHandle = meshes.acquire(modelPath);
+        const EntityId showcase = scene.createEntity();
+        Transform& t = scene.addComponent<Transform>(showcase, Vec3{0.0f, 12.0f, 0.0f});
+        t.scale = {2.0f, 2.0f, 2.0f};
+        scene.addComponent<MeshRenderer>(showcase, modelHandle, core::resource::assetIdOf(modelPath), cube, Vec3{0.85f, 0.82f, 0.78f}, 0.1f, 0.4f, 1.0f);
+        events.subscribe<std::string>(core::event::EngineEventType::ResourceLoaded, [&](const std::string& path) {
+            if (path == modelPath) Logger::info("Streamed model ready: {}", path);
+        });
+        Logger::info("Streaming model {} (upload budget {} KB/frame)", modelPath, options.uploadBudgetBytes / 1024);
     }
 
-    for (int i = 0; i < 14; ++i) {
-        const int x = -worldHalf + 2 + (i * 7) % (worldHalf * 2 - 3);
-        const int z = -worldHalf + 2 + (i * 11) % (worldHalf * 2 - 3);
-        const int baseH = terrainHeight(x, z);
-        const int towerH = 3 + (i % 4);
-        for (int y = baseH + 1; y <= baseH + towerH; ++y) {
-            if (spawnBlock(scene, cube, {x, y, z}, BlockKind::Stone, blocks, entityToCell)) {
-                ++spawnedBlocks;
-            }
+    // Reimports run on loadJobs and are applied at the top of a main-thread frame. Meshes go through
+    // MeshLibrary::replace (uploaded by processUploads on the GL thread) and shader programs through
+    // DeferredPipeline::replaceShader (linked at the start of the next render), so neither thread
+    // waits on a reload. Programs named gbuffer or lighting replace the pipeline's built-in ones.
+    editor::asset::ImportPipeline importPipeline;
+    editor::asset::DependencyGraph assetDependencies;
+    editor::asset::HotReloadService hotReload(importPipeline, assetDependencies, loadJobs);
+    if (!options.watchDirectory.empty()) {
+        editor::asset::registerHotReloadImporters(importPipeline);
+        const size_t tracked = editor::asset::trackWatchedAssets(options.watchDirectory, importPipeline, assetDependencies);
+        if (hotReload.watch(options.watchDirectory)) {
+            Logger::info("Hot reload: watching {} ({} assets)", options.watchDirectory, tracked);
         }
+        hotReload.setApplyHandler([&](std::span<const editor::asset::ImportResult> results) {
+            for (const editor::asset::ImportResult& result : results) {
+                if (!result.success || !result.artifact) continue;
+                const auto request = importPipeline.findRequest(result.assetId);
+                if (!request) continue;
+                if (request->importer == "obj") {
+                    // The artifact belongs to this batch only.
+                    auto& data = *std::static_pointer_cast<gfx::MeshData>(result.artifact);
+                    if (!meshes.replace(request->sourcePath, std::move(data))) {
+                        Logger::info("Hot reload: {} is not in use", result.assetId);
+                    }
+                } else if (request->importer == "shader") {
+                    auto& sources = *std::static_pointer_cast<editor::asset::ShaderSources>(result.artifact);
+                    const std::string program = std::filesystem::path(request->sourcePath).filename().string();
+                    if (!renderer.deferredPipeline().replaceShader(program, std::move(sources.vertex), std::move(sources.fragment))) {
+                        Logger::info("Hot reload: no pipeline program named {}", program);
+                    }
+                }
+            }
+        });
     }
-
-    Logger::info("Rex Block Sandbox ready. spawned blocks: {}", spawnedBlocks);
     Logger::info("Controls:");
     Logger::info("WASD + QE: move camera, Shift: speed boost");
     Logger::info("RMB hold + mouse: free look");
@@ -385,10 +1033,63 @@ int main() {
     Logger::info("F1/F2/F3/F4/F5/F6: post-process tuning");
     Logger::info("Delete: remove last spawned prop, Esc: quit");
 
+    core::execution::RenderSnapshotBuffer<RenderSnapshot> snapshots;
+    RenderSnapshotBuilder snapshotBuilder;
+    core::execution::RenderThread renderThread;
+    if (pipelined) {
+        window.releaseContext();
+        renderThread.start(
+            [&](const core::execution::FrameContext& frame) {
+                REX_TRACE_SCOPE("RenderFrame");
+                REX_TRACE_FLOW_END("Frame", frame.frameIndex);
+                RenderSnapshot& snap = snapshots.front();
+                meshes.processUploads();
+                renderer.deferredPipeline().postProcess().settings() = snap.post;
+                renderer.render(snap.scene, snap.camera, snap.view, snap.viewPos, snap.width, snap.height, 0);
+                window.swapBuffers();
+            },
+            [&] {
+                REX_TRACE_THREAD_NAME("Render");
+                window.makeContextCurrent();
+            },
+            [&] { window.releaseContext(); });
+        Logger::info("Pipelined rendering enabled");
+    }
+
     uint64_t prevCounter = SDL_GetPerformanceCounter();
     const uint64_t perfFreq = SDL_GetPerformanceFrequency();
+    uint64_t frameIndex = 0;
+
+    using FrameClock = core::time::FramePacer::Clock;
+    core::time::FramePacerConfig pacerConfig{};
+    pacerConfig.targetFps = options.targetFps;
+    core::time::FramePacer pacer(pacerConfig);
+    core::time::FrameTimingStats frameStats;
+    FrameClock::time_point frameStart = FrameClock::now();
+    FrameClock::time_point lastStatsLog = frameStart;
+    // GPU pass timings resolve a few frames late; record each resolved frame once.
+    // Render counters are copied here too, at points where the render thread is idle.
+    // In pipelined mode the watchdog gets the counters of the frame the render thread just finished.
+    uint64_t lastPassFrame = 0;
+    gfx::RenderStats renderStats{};
+    core::diagnostics::FrameWatchdog watchdog;
+    startWatchdog(options, watchdog);
+    const auto recordRenderStats = [&] {
+        renderStats = gfx::RenderDevice::frameStats();
+        recordRenderCounters(watchdog, renderStats);
+        recordFrameMemory(watchdog, "Render lists KB", "Render lists overflows", renderer.deferredPipeline().frameMemory());
+        const gfx::RenderPassProfiler& profiler = renderer.deferredPipeline().passProfiler();
+        if (profiler.latestFrameIndex() == lastPassFrame) return;
+        lastPassFrame = profiler.latestFrameIndex();
+        frameStats.recordPasses(profiler.latest());
+    };
+    if (options.targetFps > 0.0) {
+        Logger::info("Frame pacer target: {:.1f} fps (vsync {})", options.targetFps, options.vsync ? "on" : "off");
+    }
 
     while (running) {
+        REX_TRACE_SCOPE("Frame");
+        watchdog.beginFrame(frameIndex);
         const uint64_t now = SDL_GetPerformanceCounter();
         float dt = float(now - prevCounter) / float(perfFreq);
         prevCounter = now;
@@ -528,6 +1229,10 @@ int main() {
             }
         }
 
+        hotReload.update();
+        resourceEvents.flush(events);
+        watchdog.setCounter("Mesh upload KB", static_cast<double>(meshes.stats().uploadedBytesLastFrame) / 1024.0);
+
         const Uint8* keys = SDL_GetKeyboardState(nullptr);
         const Vec3 forward = forwardFromYawPitch(camYaw, camPitch);
         const Vec3 right = rightFromForward(forward);
@@ -557,14 +1262,88 @@ int main() {
             t->rotation.y = -140.0f + std::cos(worldTime * 0.03f) * 12.0f;
         }
 
-        physics.update(scene, paused ? 0.0f : dt);
+        {
+            REX_TRACE_SCOPE("Physics");
+            const FrameClock::time_point physicsBegin = FrameClock::now();
+            physics.update(scene, paused ? 0.0f : dt);
+            watchdog.setCounter("Physics ms",
+                                std::chrono::duration<double, std::milli>(FrameClock::now() - physicsBegin).count());
+            recordFrameMemory(watchdog, "Physics scratch KB", "Physics scratch overflows", physics.frameMemory());
+        }
+        REX_TRACE_COUNTER("DynamicProps", dynamicProps.size());
 
         const Mat4 view = Mat4::lookAtLH(camPos, camPos + forward, {0.0f, 1.0f, 0.0f});
-        renderer.render(scene, camera, view, camPos, window.getWidth(), window.getHeight(), 0);
-        window.swapBuffers();
+        FrameClock::time_point cpuEnd{};
+        const FrameClock::time_point renderBegin = FrameClock::now();
+        if (!pipelined) {
+            REX_TRACE_SCOPE("Render");
+            meshes.processUploads();
+            renderer.deferredPipeline().postProcess().settings() = post;
+            renderer.render(scene, camera, view, camPos, window.getWidth(), window.getHeight(), 0);
+            cpuEnd = FrameClock::now();
+            window.swapBuffers();
+            recordRenderStats();
+            watchdog.setCounter("Render ms", std::chrono::duration<double, std::milli>(cpuEnd - renderBegin).count());
+            watchdog.setCounter("Swap ms", std::chrono::duration<double, std::milli>(FrameClock::now() - cpuEnd).count());
+        } else {
+            core::execution::FrameContext frame{};
+            frame.frameIndex = frameIndex;
+            frame.deltaTime = dt;
+            frame.interpolationAlpha = physics.interpolationAlpha();
+
+            // The render thread may still be drawing the front snapshot here.
+            RenderSnapshot& snap = snapshots.back();
+            REX_TRACE_SCOPE("PrepareRender");
+            snapshotBuilder.build(scene, physics, frame.interpolationAlpha, snap);
+            snap.camera = camera;
+            snap.view = view;
+            snap.viewPos = camPos;
+            snap.post = post;
+            snap.width = window.getWidth();
+            snap.height = window.getHeight();
+
+            cpuEnd = FrameClock::now();
+            {
+                REX_TRACE_SCOPE("WaitRender");
+                renderThread.waitIdle();
+            }
+            // The render thread is idle, so its profiler results and counters are safe to read.
+            recordRenderStats();
+            watchdog.setCounter("Prepare render ms", std::chrono::duration<double, std::milli>(cpuEnd - renderBegin).count());
+            watchdog.setCounter("Render wait ms", std::chrono::duration<double, std::milli>(FrameClock::now() - cpuEnd).count());
+            snapshots.publish();
+            REX_TRACE_FLOW_BEGIN("Frame", frame.frameIndex);
+            renderThread.submit(frame);
+        }
+        ++frameIndex;
+
+        // The pacer's sleep is idle time, not frame work; close the watchdog frame before it.
+        watchdog.endFrame();
+        FrameClock::time_point nextFrameStart{};
+        {
+            REX_TRACE_SCOPE("PacerWait");
+            nextFrameStart = pacer.wait();
+        }
+        frameStats.recordFrame(
+            std::chrono::duration<double, std::milli>(nextFrameStart - frameStart).count(),
+            std::chrono::duration<double, std::milli>(cpuEnd - frameStart).count());
+        frameStart = nextFrameStart;
+
+        if (nextFrameStart - lastStatsLog >= std::chrono::seconds(5)) {
+            lastStatsLog = nextFrameStart;
+            logFrameStats(frameStats, renderStats);
+        }
+    }
+
+    if (pipelined) {
+        // Take the GL context back so GL objects are destroyed on this thread.
+        renderThread.stop();
+        window.makeContextCurrent();
     }
 
     SDL_SetRelativeMouseMode(SDL_FALSE);
+    if (modelHandle) meshes.release(modelHandle);
     delete cube;
+    finishTracing(options);
     return 0;
 }
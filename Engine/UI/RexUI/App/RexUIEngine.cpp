@@ -1,6 +1,7 @@
 #include "RexUIEngine.h"
 
 #include <algorithm>
+#include <utility>
 
 #include "../../../Core/Logger.h"
 
@@ -43,6 +44,10 @@ const runtime::tree::WidgetTree& RexUIEngine::widgetTree() const {
     return widgetTree_;
 }
 
+const ::rex::core::memory::FrameMemoryResource& RexUIEngine::frameMemory() const {
+    return frameMemory_;
+}
+
 bool RexUIEngine::runFrame(float dt, std::uint64_t frameIndex) {
     (void)dt;
     if (!backend_) return false;
@@ -58,7 +63,14 @@ bool RexUIEngine::runFrame(float dt, std::uint64_t frameIndex) {
     };
     layoutEngine_.compute(widgetTree_, constraints, frameIndex);
 
-    const auto drawList = drawBuilder_.build(widgetTree_);
+    // 지난 프레임 명령이 프레임 메모리를 참조하므로 되감기 전에 비운다.
+    const std::size_t lastCommandCount = renderGraph_.flattened().size();
+    renderGraph_.beginFrame();
+    frameMemory_.beginFrame();
+
+    runtime::render::DrawList drawList(frameMemory_.resource());
+    drawList.reserve(lastCommandCount);
+    drawBuilder_.build(widgetTree_, drawList);
     if (frameIndex == 0) {
         Logger::info("RexUI frame0 draw commands: {} (viewport {}x{})",
                      drawList.size(),
@@ -66,8 +78,7 @@ bool RexUIEngine::runFrame(float dt, std::uint64_t frameIndex) {
                      viewportHeight_);
     }
 
-    renderGraph_.beginFrame();
-    renderGraph_.addDrawList(drawList);
+    renderGraph_.addDrawList(std::move(drawList));
 
     const renderer::RenderFrameContext frameCtx{
         viewportWidth_,
@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <memory>
 
+#include "../../../Core/Memory/MemoryResource.h"
 #include "../Core/Widget.h"
 #include "../Framework/Binding/BindingContext.h"
 #include "../Framework/Binding/BindingExpression.h"
@@ -35,6 +36,9 @@ public:
 
     bool runFrame(float dt, std::uint64_t frameIndex);
 
+    // 직전 프레임 draw list가 쓴 프레임 메모리. 사용량 관측용.
+    const ::rex::core::memory::FrameMemoryResource& frameMemory() const;
+
 private:
     renderer::IRenderBackend* backend_ = nullptr;
     std::uint32_t viewportWidth_ = 0;
@@ -44,6 +48,7 @@ private:
     runtime::layout::ConstraintSolver constraintSolver_{};
     runtime::layout::LayoutCache layoutCache_{};
     runtime::layout::LayoutEngine layoutEngine_{&constraintSolver_, &layoutCache_};
+    ::rex::core::memory::FrameMemoryResource frameMemory_{1024 * 1024};
     runtime::render::DrawListBuilder drawBuilder_{};
     runtime::render::RenderGraph renderGraph_{};
 
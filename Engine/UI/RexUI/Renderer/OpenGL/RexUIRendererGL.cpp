@@ -256,7 +256,7 @@ void RexUIRendererGL::submitBorder(const core::Rect& rect, const core::Color& co
     submitRect({rect.x + rect.w - t, rect.y, t, rect.h}, color);
 }
 
-void RexUIRendererGL::submitText(const core::Rect& rect, const std::string& text, const core::Color& color) {
+void RexUIRendererGL::submitText(const core::Rect& rect, std::string_view text, const core::Color& color) {
     if (!fontReady_ || text.empty()) return;
 
     std::vector<TextVertex> verts;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <string_view>
 #include <vector>
 
 #include "../../../../Graphics/Shader.h"
@@ -24,7 +25,7 @@ private:
     void destroyGpuResources();
     void submitRect(const core::Rect& rect, const core::Color& color);
     void submitBorder(const core::Rect& rect, const core::Color& color, float thickness);
-    void submitText(const core::Rect& rect, const std::string& text, const core::Color& color);
+    void submitText(const core::Rect& rect, std::string_view text, const core::Color& color);
     void applyClipState();
     core::Rect intersectClips(const core::Rect& a, const core::Rect& b) const;
 
@@ -27,7 +27,7 @@ bool RexUIRendererRexGraphics::submit(const runtime::render::DrawList& drawList)
         out.rect = cmd.rect;
         out.color = cmd.color;
         out.textureId = cmd.textureId;
-        out.text = cmd.text;
+        out.text.assign(cmd.text.data(), cmd.text.size());
 
         switch (cmd.type) {
             case runtime::render::DrawCommandType::Rect:
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory_resource>
 #include <string>
 #include <vector>
 
@@ -22,12 +23,13 @@ struct DrawCommand {
     DrawCommandType type = DrawCommandType::Rect;
     core::Rect rect{};
     core::Color color{};
-    std::string text;
+    std::pmr::string text;
     std::uint64_t textureId = 0;
     float thickness = 0.0f;
 };
 
-using DrawList = std::vector<DrawCommand>;
+// DrawList와 텍스트는 같은 memory_resource(보통 프레임 메모리)에서 할당된다.
+using DrawList = std::pmr::vector<DrawCommand>;
 
 // TODO [RexUI-Runtime-Render-001]:
 // 책임: 백엔드 중립 DrawCommand 포맷 정의
@@ -30,11 +30,14 @@ public:
 
     void drawText(const core::Rect& rect, const std::string& text, const core::Color& color) override {
         if (!drawList_) return;
-        DrawCommand cmd;
-        cmd.type = DrawCommandType::Text;
-        cmd.rect = rect;
-        cmd.color = color;
-        cmd.text = text;
+        DrawCommand cmd{
+            DrawCommandType::Text,
+            rect,
+            color,
+            std::pmr::string(text, drawList_->get_allocator().resource()),
+            0,
+            0.0f
+        };
         drawList_->push_back(std::move(cmd));
     }
 
@@ -63,14 +66,12 @@ private:
 };
 } // namespace
 
-DrawList DrawListBuilder::build(const tree::WidgetTree& tree) const {
-    DrawList drawList;
+void DrawListBuilder::build(const tree::WidgetTree& tree, DrawList& out) const {
     const auto root = tree.root();
-    if (!root) return drawList;
+    if (!root) return;
 
-    DrawPaintContext ctx(&drawList);
+    DrawPaintContext ctx(&out);
     root->paint(ctx);
-    return drawList;
 }
 
 } // namespace rex::ui::runtime::render
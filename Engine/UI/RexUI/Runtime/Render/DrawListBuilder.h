@@ -10,7 +10,7 @@ namespace rex::ui::runtime::render {
 
 class DrawListBuilder {
 public:
-    DrawList build(const tree::WidgetTree& tree) const;
+    void build(const tree::WidgetTree& tree, DrawList& out) const;
 };
 
 // TODO [RexUI-Runtime-Render-002]:
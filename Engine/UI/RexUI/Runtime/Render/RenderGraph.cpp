@@ -1,6 +1,7 @@
 #include "RenderGraph.h"
 
 #include <algorithm>
+#include <iterator>
 
 namespace rex::ui::runtime::render {
 
@@ -13,6 +14,13 @@ void RenderGraph::addDrawList(const DrawList& drawList) {
     flattened_.insert(flattened_.end(), drawList.begin(), drawList.end());
 }
 
+void RenderGraph::addDrawList(DrawList&& drawList) {
+    flattened_.reserve(flattened_.size() + drawList.size());
+    flattened_.insert(flattened_.end(),
+                      std::make_move_iterator(drawList.begin()),
+                      std::make_move_iterator(drawList.end()));
+}
+
 const DrawList& RenderGraph::flattened() const {
     return flattened_;
 }
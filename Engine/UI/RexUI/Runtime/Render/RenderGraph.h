@@ -8,6 +8,7 @@ class RenderGraph {
 public:
     void beginFrame();
     void addDrawList(const DrawList& drawList);
+    void addDrawList(DrawList&& drawList);
     const DrawList& flattened() const;
     void clear();
 